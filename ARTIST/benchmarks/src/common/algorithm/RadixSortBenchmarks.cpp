@@ -0,0 +1,77 @@
+/**
+ * @file RadixSortBenchmarks.cpp
+ * @brief Sorting draws by 64-bit key: radix sort against std::stable_sort, over the draw count.
+ *
+ * Keys follow the opaque draw key layout, with a handful of passes and programs, a few hundred
+ * materials and random depths, as a frame would produce.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <common/algorithm/RadixSort.hpp>
+#include <graphic/pipeline/DrawKey.hpp>
+
+namespace algorithm = artist::common::algorithm;
+using artist::graphic::pipeline::DrawKeyLayout;
+
+namespace
+{
+    struct Draw
+    {
+        std::uint64_t key;   ///< Sort key.
+        std::uint32_t index; ///< Index of the draw in the frame.
+    };
+
+    std::vector<Draw> makeDraws(std::size_t count)
+    {
+        const DrawKeyLayout layout = DrawKeyLayout::opaque();
+        std::mt19937 random(3);
+        std::uniform_real_distribution<float> depth(0.0f, 1.0f);
+        std::vector<Draw> draws(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            draws[i] = {layout.encode({.pass = static_cast<std::uint32_t>(random() % 3),
+                                       .program = static_cast<std::uint32_t>(random() % 16),
+                                       .renderState = static_cast<std::uint32_t>(random() % 4),
+                                       .material = static_cast<std::uint32_t>(random() % 300),
+                                       .depth = depth(random)}),
+                        static_cast<std::uint32_t>(i)};
+        }
+        return draws;
+    }
+}
+
+static void BM_RadixSort(benchmark::State &state)
+{
+    const std::vector<Draw> frame = makeDraws(static_cast<std::size_t>(state.range(0)));
+    std::vector<Draw> draws(frame.size());
+    std::vector<Draw> scratch(frame.size());
+    for (auto _ : state)
+    {
+        draws = frame;
+        algorithm::radixSort(std::span<Draw>(draws), std::span<Draw>(scratch), [](const Draw &draw)
+                             { return draw.key; });
+        benchmark::DoNotOptimize(draws.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_RadixSort)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+static void BM_StableSort(benchmark::State &state)
+{
+    const std::vector<Draw> frame = makeDraws(static_cast<std::size_t>(state.range(0)));
+    std::vector<Draw> draws(frame.size());
+    for (auto _ : state)
+    {
+        draws = frame;
+        std::ranges::stable_sort(draws, {}, &Draw::key);
+        benchmark::DoNotOptimize(draws.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_StableSort)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+BENCHMARK_MAIN();
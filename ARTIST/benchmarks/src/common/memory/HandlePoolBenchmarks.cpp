@@ -0,0 +1,98 @@
+/**
+ * @file HandlePoolBenchmarks.cpp
+ * @brief Walking the uniforms of every pass: shared_ptr graph against HandlePool columns, over the pass count.
+ *
+ * The graph mirrors PassContext, a hash map of shared_ptr uniforms per pass, allocated among other
+ * blocks as a loaded scene would leave the heap. The pool holds the same locations in one column.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <common/memory/HandlePool.hpp>
+
+using artist::common::memory::HandlePool;
+
+namespace
+{
+    constexpr int UNIFORMS_PER_PASS = 8;
+
+    struct Uniform
+    {
+        std::int32_t location; ///< Location in the program.
+        std::uint32_t type;    ///< GL type.
+    };
+
+    struct Pass
+    {
+        std::unordered_map<std::string, std::shared_ptr<Uniform>> uniforms; ///< Uniforms by name.
+    };
+
+    struct UniformTag;
+    using UniformPool = HandlePool<UniformTag, std::int32_t, std::uint32_t, std::uint32_t>; // location, type, pass
+
+    std::vector<std::shared_ptr<Pass>> makeGraph(std::size_t passCount, std::vector<std::unique_ptr<char[]>> &clutter)
+    {
+        std::mt19937 random(3);
+        std::vector<std::shared_ptr<Pass>> passes;
+        for (std::size_t pass = 0; pass < passCount; ++pass)
+        {
+            passes.push_back(std::make_shared<Pass>());
+            for (int uniform = 0; uniform < UNIFORMS_PER_PASS; ++uniform)
+            {
+                clutter.push_back(std::make_unique<char[]>(16 + random() % 256));
+                passes.back()->uniforms["uniform" + std::to_string(uniform)] = std::make_shared<Uniform>(Uniform{uniform, 0x1406});
+            }
+        }
+        return passes;
+    }
+}
+
+static void BM_SharedPtrGraph(benchmark::State &state)
+{
+    std::vector<std::unique_ptr<char[]>> clutter;
+    const std::vector<std::shared_ptr<Pass>> passes = makeGraph(static_cast<std::size_t>(state.range(0)), clutter);
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (const auto &pass : passes)
+        {
+            for (const auto &[name, uniform] : pass->uniforms)
+            {
+                sum += uniform->location;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * UNIFORMS_PER_PASS);
+}
+BENCHMARK(BM_SharedPtrGraph)->RangeMultiplier(10)->Range(100, 100'000);
+
+static void BM_HandlePoolColumn(benchmark::State &state)
+{
+    UniformPool uniforms;
+    for (std::uint32_t pass = 0; pass < static_cast<std::uint32_t>(state.range(0)); ++pass)
+    {
+        for (int uniform = 0; uniform < UNIFORMS_PER_PASS; ++uniform)
+        {
+            uniforms.create(uniform, 0x1406, pass);
+        }
+    }
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::int32_t location : uniforms.column<0>())
+        {
+            sum += location;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0) * UNIFORMS_PER_PASS);
+}
+BENCHMARK(BM_HandlePoolColumn)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+/**
+ * @file ParallelRecordingBenchmarks.cpp
+ * @brief Time to record the commands of a 50k-object frame, against the number of recording threads.
+ *
+ * Each object computes its model matrix, then records its pass, the matrix and an indexed draw.
+ * Recording makes no OpenGL call, so the measure is the CPU preparation of a frame, merge included.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/command/ParallelRecorder.hpp>
+
+namespace api = artist::graphic::api;
+namespace command = artist::graphic::opengl::command;
+namespace pipeline = artist::graphic::pipeline;
+using artist::common::thread::ThreadPool;
+using artist::graphic::opengl::buffer::IndexBuffer;
+using artist::graphic::opengl::context::OpenGLPassContext;
+
+namespace
+{
+    constexpr std::size_t OBJECT_COUNT = 50'000;
+
+    std::vector<command::PassView> makePasses()
+    {
+        std::vector<command::PassView> views;
+        for (GLuint program = 1; program <= 4; ++program)
+        {
+            OpenGLPassContext pass;
+            pass.setPassID(program);
+            pass.setCurrentVertexArray(program);
+            auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+            uniform->getContext()->setUniformID(0);
+            pass.addUniform("model", uniform);
+            auto indices = std::make_shared<IndexBuffer>();
+            indices->describe(GL_UNSIGNED_INT, 64 * 36);
+            pass.setIndexBuffer(indices);
+            views.push_back(command::PassView::capture(pass));
+        }
+        return views;
+    }
+
+    void recordObjects(const std::vector<command::PassView> &passes, command::ThreadCommandList &list, std::size_t first, std::size_t last)
+    {
+        for (std::size_t object = first; object < last; ++object)
+        {
+            const float angle = static_cast<float>(object) * 0.001f;
+            glm::mat4 model(1.0f);
+            model[0][0] = std::cos(angle);
+            model[0][2] = -std::sin(angle);
+            model[2][0] = std::sin(angle);
+            model[2][2] = std::cos(angle);
+            model[3] = glm::vec4(angle, 0.0f, -angle, 1.0f);
+            command::CommandRecorder &recorder = list.beginDraw(passes[object % passes.size()], object % passes.size());
+            recorder.uniform("model", model);
+            recorder.drawIndexed(static_cast<GLsizei>(object % 64) * 36, 36);
+        }
+    }
+}
+
+static void BM_RecordFrame(benchmark::State &state)
+{
+    const std::vector<command::PassView> passes = makePasses();
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)) - 1); // The calling thread records too
+    for (auto _ : state)
+    {
+        command::CommandList frame = command::recordParallel(pool, OBJECT_COUNT, 1024, [&passes](command::ThreadCommandList &list, std::size_t first, std::size_t last)
+                                                             { recordObjects(passes, list, first, last); });
+        benchmark::DoNotOptimize(frame.getCommands().data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * OBJECT_COUNT));
+}
+BENCHMARK(BM_RecordFrame)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
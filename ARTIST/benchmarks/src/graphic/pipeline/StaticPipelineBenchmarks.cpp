@@ -0,0 +1,169 @@
+/**
+ * @file StaticPipelineBenchmarks.cpp
+ * @brief Cost of using the passes of a Pipeline against a StaticPipeline of the same passes.
+ *
+ * The passes run on a null API whose components only record the program they would make current,
+ * so the measures are the dispatch overhead of each pipeline and nothing else.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/context/PassContext.hpp>
+#include <graphic/context/PipelineContext.hpp>
+#include <graphic/pipeline/Pipeline.hpp>
+#include <graphic/pipeline/StaticPipeline.hpp>
+
+namespace null
+{
+    enum class Profile
+    {
+        Classic
+    };
+
+    class ShaderContext;
+    class UniformContext;
+    class PassContext;
+    class PipelineContext;
+
+    class NullApi
+    {
+    public:
+        using ShaderContext = null::ShaderContext;
+        using UniformContext = null::UniformContext;
+        using PassContext = null::PassContext;
+        using PipelineContext = null::PipelineContext;
+        using Validator = artist::graphic::opengl::validator::Validator;
+    };
+
+    inline unsigned int currentProgram = 0; ///< Program the last User made current.
+
+    /**
+     * @brief Component doing nothing, as a stand-in for GL calls that cost the same in both pipelines.
+     */
+    template <typename Context>
+    struct NullComponent
+    {
+        static void on(Context &) {}
+    };
+
+    template <auto PROFILE>
+    struct NullUser
+    {
+        static void on(PassContext &context);
+    };
+
+    template <auto PROFILE>
+    struct NullPipelineUser
+    {
+        static void on(PipelineContext &context);
+    };
+
+    template <auto PROFILE>
+    struct NullPipelineResetter
+    {
+        static void on(PipelineContext &context);
+    };
+
+    class ShaderContext
+    {
+    public:
+        [[nodiscard]] std::string getShaderCode() const
+        {
+            return {};
+        }
+    };
+
+    class UniformContext
+    {
+    public:
+        template <typename T>
+        using Setter = NullComponent<UniformContext>;
+    };
+
+    class PassContext : public artist::graphic::context::PassContext<NullApi>
+    {
+    public:
+        template <auto PROFILE>
+        using Loader = NullComponent<PassContext>;
+        template <auto PROFILE>
+        using Freer = NullComponent<PassContext>;
+        template <auto PROFILE>
+        using ShaderAttacher = NullComponent<PassContext>;
+        template <auto PROFILE>
+        using UniformReader = NullComponent<PassContext>;
+        template <auto PROFILE>
+        using AttributeReader = NullComponent<PassContext>;
+        template <auto PROFILE>
+        using User = NullUser<PROFILE>;
+        template <auto PROFILE>
+        using VertexArrayBinder = NullComponent<PassContext>;
+
+        unsigned int program = 0;
+    };
+
+    class PipelineContext : public artist::graphic::context::PipelineContext<NullApi>
+    {
+    public:
+        template <auto PROFILE>
+        using User = NullPipelineUser<PROFILE>;
+        template <auto PROFILE>
+        using Resetter = NullPipelineResetter<PROFILE>;
+    };
+
+    template <auto PROFILE>
+    void NullUser<PROFILE>::on(PassContext &context)
+    {
+        currentProgram = context.program;
+    }
+
+    template <auto PROFILE>
+    void NullPipelineUser<PROFILE>::on(PipelineContext &context)
+    {
+        context.getPass(context.getCurrentPass())->use();
+    }
+
+    template <auto PROFILE>
+    void NullPipelineResetter<PROFILE>::on(PipelineContext &context)
+    {
+        context.setCurrentPass(-1);
+    }
+
+    using NullPass = artist::graphic::pipeline::Pass<NullApi, Profile::Classic>;
+
+    std::shared_ptr<NullPass> makePass(unsigned int program)
+    {
+        auto pass = std::make_shared<NullPass>(std::initializer_list<std::shared_ptr<artist::graphic::pipeline::IShader<NullApi>>>{});
+        pass->getContext()->program = program;
+        return pass;
+    }
+}
+
+static void BM_DynamicPipeline(benchmark::State &state)
+{
+    artist::graphic::pipeline::Pipeline<null::NullApi, null::Profile::Classic> pipeline({null::makePass(1), null::makePass(2), null::makePass(3), null::makePass(4)});
+    for (auto _ : state)
+    {
+        for (int pass = 0; pass < pipeline.getPassesCount(); ++pass)
+        {
+            pipeline.use(pass);
+            benchmark::DoNotOptimize(null::currentProgram);
+        }
+        pipeline.reset();
+    }
+}
+BENCHMARK(BM_DynamicPipeline);
+
+static void BM_StaticPipeline(benchmark::State &state)
+{
+    artist::graphic::pipeline::StaticPipeline<null::NullApi, null::NullPass, null::NullPass, null::NullPass, null::NullPass> pipeline(null::makePass(1), null::makePass(2), null::makePass(3), null::makePass(4));
+    for (auto _ : state)
+    {
+        pipeline.run([](auto, null::NullPass &)
+                     { benchmark::DoNotOptimize(null::currentProgram); });
+    }
+}
+BENCHMARK(BM_StaticPipeline);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+/**
+ * @file ComponentCallBenchmarks.cpp
+ * @brief Cost of a component call taking its context by shared_ptr against one taking it by reference.
+ *
+ * A shared_ptr passed by value is copied for the call and released after it: two atomic operations
+ * on the reference count, which every thread using the same context contends on. A reference costs
+ * nothing beyond the pointer. Both components do the same work, reading the program of a context
+ * shared by every thread, so the difference between the measures is the reference counting alone.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <graphic/validator/ComponentConcept.hpp>
+
+namespace
+{
+    struct Context
+    {
+        unsigned int program = 1;
+    };
+
+    thread_local unsigned int currentProgram = 0; ///< Program the last User made current on this thread.
+
+    /**
+     * @brief Former component contract: the context is shared with the component for the call.
+     */
+    struct SharedUser
+    {
+        [[gnu::noinline]] static void on(std::shared_ptr<Context> context)
+        {
+            currentProgram = context->program;
+        }
+    };
+
+    /**
+     * @brief Current component contract: the component borrows the context of its owner.
+     */
+    struct BorrowedUser
+    {
+        [[gnu::noinline]] static void on(Context &context)
+        {
+            currentProgram = context.program;
+        }
+    };
+
+    static_assert(artist::graphic::validator::HasOnMethod<BorrowedUser, Context>);
+
+    const std::shared_ptr<Context> context = std::make_shared<Context>(); ///< Context of every thread, as a pass used from several threads.
+}
+
+static void BM_SharedContextCall(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        SharedUser::on(context);
+        benchmark::DoNotOptimize(currentProgram);
+    }
+}
+BENCHMARK(BM_SharedContextCall)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_BorrowedContextCall(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        BorrowedUser::on(*context);
+        benchmark::DoNotOptimize(currentProgram);
+    }
+}
+BENCHMARK(BM_BorrowedContextCall)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 #include <graphic/opengl/pipeline/component/pass/AttributeReader.hpp>
 #include <graphic/opengl/pipeline/component/pass/Loader.hpp>
 #include <graphic/opengl/pipeline/component/pass/User.hpp>
+#include <graphic/opengl/pipeline/component/pass/VertexArrayBinder.hpp>
 #include <graphic/opengl/pipeline/component/pass/Freer.hpp>
 
 #include <graphic/Api.hpp>
@@ -0,0 +1,93 @@
+/**
+ * @file RadixSort.hpp
+ * @brief Stable least-significant-digit radix sort of items by a 64-bit key.
+ *
+ * Comparison sorts cost O(n log n) comparisons; sorting thousands of draws every frame by their
+ * keys does not need comparisons at all. The sort distributes the items by one byte of their key
+ * at a time, from the least significant byte up, each pass being a stable counting sort: O(n) per
+ * byte. The histograms of all bytes are computed in a single read of the keys, and bytes where
+ * every key holds the same value are skipped: keys whose high fields are unused cost no pass.
+ *
+ * @code
+ * std::vector<Draw> draws = collect();
+ * radixSort(draws, [](const Draw &draw) { return draw.key; });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace artist::common::algorithm
+{
+    /**
+     * @brief Sorts items by increasing key, keeping the order of items with equal keys.
+     *
+     * @param items Items to sort.
+     * @param scratch Buffer of at least items.size() items, overwritten.
+     * @param key Callable returning the std::uint64_t key of an item.
+     */
+    template <typename T, typename Key>
+    void radixSort(std::span<T> items, std::span<T> scratch, Key &&key)
+    {
+        constexpr std::size_t BYTES = sizeof(std::uint64_t);
+        constexpr std::size_t BUCKETS = 256;
+        if (items.size() < 2)
+        {
+            return;
+        }
+
+        std::array<std::array<std::size_t, BUCKETS>, BYTES> histograms{};
+        for (const T &item : items)
+        {
+            const std::uint64_t value = key(item);
+            for (std::size_t byte = 0; byte < BYTES; ++byte)
+            {
+                ++histograms[byte][(value >> (byte * 8)) & 0xFF];
+            }
+        }
+
+        std::span<T> source = items;
+        std::span<T> destination = scratch.first(items.size());
+        for (std::size_t byte = 0; byte < BYTES; ++byte)
+        {
+            std::array<std::size_t, BUCKETS> &histogram = histograms[byte];
+            if (std::ranges::find(histogram, items.size()) != histogram.end())
+            {
+                continue; // Every key has the same byte: the pass would not move anything
+            }
+            std::size_t offset = 0;
+            for (std::size_t &count : histogram)
+            {
+                offset += std::exchange(count, offset);
+            }
+            for (T &item : source)
+            {
+                destination[histogram[(key(item) >> (byte * 8)) & 0xFF]++] = std::move(item);
+            }
+            std::swap(source, destination);
+        }
+        if (source.data() != items.data())
+        {
+            std::ranges::move(source, items.begin());
+        }
+    }
+
+    /**
+     * @brief Sorts items by increasing key, keeping the order of items with equal keys.
+     *
+     * Allocates its own scratch buffer; pass one to the span overload to reuse it across frames.
+     */
+    template <typename T, typename Key>
+    void radixSort(std::vector<T> &items, Key &&key)
+    {
+        std::vector<T> scratch(items.size());
+        radixSort(std::span<T>(items), std::span<T>(scratch), std::forward<Key>(key));
+    }
+}
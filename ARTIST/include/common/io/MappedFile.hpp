@@ -0,0 +1,149 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The contents of the file are paged in by the operating system on first access, straight from
+ * the page cache, without being read into an intermediate buffer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <span>
+#include <common/exception/TraceableException.hpp>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace artist::common::io
+{
+    /**
+     * @class MappedFile
+     * @brief Maps a file into memory for its lifetime.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @throws common::exception::TraceableException If the file cannot be opened or mapped.
+         */
+        explicit MappedFile(const std::filesystem::path &path)
+        {
+#if defined(_WIN32)
+            m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            LARGE_INTEGER size{};
+            if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size))
+            {
+                close();
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::MAPPED_FILE::OPEN_FAILED: {}", path.string()));
+            }
+            m_size = static_cast<std::size_t>(size.QuadPart);
+            if (m_size == 0)
+            {
+                return;
+            }
+            m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            m_data = m_mapping ? static_cast<const std::byte *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+            m_descriptor = ::open(path.c_str(), O_RDONLY);
+            struct stat status{};
+            if (m_descriptor < 0 || ::fstat(m_descriptor, &status) != 0)
+            {
+                close();
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::MAPPED_FILE::OPEN_FAILED: {}", path.string()));
+            }
+            m_size = static_cast<std::size_t>(status.st_size);
+            if (m_size == 0)
+            {
+                return;
+            }
+            void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_descriptor, 0);
+            m_data = data == MAP_FAILED ? nullptr : static_cast<const std::byte *>(data);
+            if (m_data)
+            {
+                // The file is read front to back once: read ahead aggressively and start paging it in now
+                ::madvise(data, m_size, MADV_SEQUENTIAL);
+                ::madvise(data, m_size, MADV_WILLNEED);
+            }
+#endif
+            if (!m_data)
+            {
+                close();
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::MAPPED_FILE::MAP_FAILED: {}", path.string()));
+            }
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile()
+        {
+            close();
+        }
+
+        /**
+         * @brief The contents of the file.
+         */
+        [[nodiscard]] std::span<const std::byte> getData() const
+        {
+            return {m_data, m_data ? m_size : 0};
+        }
+
+        [[nodiscard]] std::size_t getSize() const
+        {
+            return m_size;
+        }
+
+    private:
+        void close()
+        {
+#if defined(_WIN32)
+            if (m_data)
+            {
+                UnmapViewOfFile(m_data);
+            }
+            if (m_mapping)
+            {
+                CloseHandle(m_mapping);
+            }
+            if (m_file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_file);
+            }
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+#else
+            if (m_data)
+            {
+                ::munmap(const_cast<std::byte *>(m_data), m_size);
+            }
+            if (m_descriptor >= 0)
+            {
+                ::close(m_descriptor);
+            }
+            m_descriptor = -1;
+#endif
+            m_data = nullptr;
+        }
+
+#if defined(_WIN32)
+        HANDLE m_file = INVALID_HANDLE_VALUE; ///< Handle of the file.
+        HANDLE m_mapping = nullptr;           ///< Handle of the file mapping.
+#else
+        int m_descriptor = -1;                ///< File descriptor.
+#endif
+        const std::byte *m_data = nullptr; ///< First byte of the mapping.
+        std::size_t m_size = 0;            ///< Size of the file in bytes.
+    };
+}
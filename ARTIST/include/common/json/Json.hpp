@@ -0,0 +1,464 @@
+/**
+ * @file Json.hpp
+ * @brief Minimal JSON document model and parser.
+ *
+ * Enough JSON to read asset descriptions such as glTF: the whole text is parsed into a tree of
+ * values at once. Objects keep their members in file order and are searched linearly, which is
+ * faster than hashing for the handful of members asset objects have.
+ *
+ * @code
+ * json::Value document = json::parse(text);
+ * for (const json::Value &mesh : document.at("meshes").getArray())
+ * {
+ *     std::string_view name = mesh.getString("name", "unnamed");
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::common::json
+{
+    /**
+     * @class Value
+     * @brief A JSON value: null, boolean, number, string, array or object.
+     */
+    class Value
+    {
+    public:
+        using Array = std::vector<Value>;
+        using Object = std::vector<std::pair<std::string, Value>>;
+
+        Value() = default;
+
+        template <typename T>
+            requires std::is_constructible_v<std::variant<std::nullptr_t, bool, double, std::string, Array, Object>, T &&>
+        explicit Value(T &&value) : m_value(std::forward<T>(value))
+        {
+        }
+
+        [[nodiscard]] bool isNull() const
+        {
+            return std::holds_alternative<std::nullptr_t>(m_value);
+        }
+
+        [[nodiscard]] bool isNumber() const
+        {
+            return std::holds_alternative<double>(m_value);
+        }
+
+        [[nodiscard]] bool isString() const
+        {
+            return std::holds_alternative<std::string>(m_value);
+        }
+
+        [[nodiscard]] bool isArray() const
+        {
+            return std::holds_alternative<Array>(m_value);
+        }
+
+        [[nodiscard]] bool isObject() const
+        {
+            return std::holds_alternative<Object>(m_value);
+        }
+
+        /**
+         * @throws common::exception::TraceableException If the value is not of the requested type.
+         */
+        [[nodiscard]] bool getBool() const
+        {
+            return get<bool>("boolean");
+        }
+
+        [[nodiscard]] double getNumber() const
+        {
+            return get<double>("number");
+        }
+
+        [[nodiscard]] const std::string &getString() const
+        {
+            return get<std::string>("string");
+        }
+
+        [[nodiscard]] const Array &getArray() const
+        {
+            return get<Array>("array");
+        }
+
+        [[nodiscard]] const Object &getObject() const
+        {
+            return get<Object>("object");
+        }
+
+        /**
+         * @brief Member of an object.
+         * @return The member, or nullptr if the value is not an object or has no such member.
+         */
+        [[nodiscard]] const Value *find(std::string_view key) const
+        {
+            if (const Object *object = std::get_if<Object>(&m_value))
+            {
+                for (const auto &[name, value] : *object)
+                {
+                    if (name == key)
+                    {
+                        return &value;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Member of an object.
+         * @throws common::exception::TraceableException If there is no such member.
+         */
+        [[nodiscard]] const Value &at(std::string_view key) const
+        {
+            const Value *value = find(key);
+            if (!value)
+            {
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::JSON::MISSING_MEMBER: {}", key));
+            }
+            return *value;
+        }
+
+        /**
+         * @brief Element of an array.
+         * @throws common::exception::TraceableException If the value is not an array or the index is out of range.
+         */
+        [[nodiscard]] const Value &at(std::size_t index) const
+        {
+            const Array &array = getArray();
+            if (index >= array.size())
+            {
+                throw exception::TraceableException<std::out_of_range>(std::format("ERROR::JSON::INDEX_OUT_OF_RANGE: {} in an array of {}", index, array.size()));
+            }
+            return array[index];
+        }
+
+        /**
+         * @brief Number member of an object, or a default value if there is no such member.
+         */
+        [[nodiscard]] double getNumber(std::string_view key, double fallback) const
+        {
+            const Value *value = find(key);
+            return value ? value->getNumber() : fallback;
+        }
+
+        /**
+         * @brief String member of an object, or a default value if there is no such member.
+         */
+        [[nodiscard]] std::string_view getString(std::string_view key, std::string_view fallback) const
+        {
+            const Value *value = find(key);
+            return value ? std::string_view(value->getString()) : fallback;
+        }
+
+        /**
+         * @brief Boolean member of an object, or a default value if there is no such member.
+         */
+        [[nodiscard]] bool getBool(std::string_view key, bool fallback) const
+        {
+            const Value *value = find(key);
+            return value ? value->getBool() : fallback;
+        }
+
+    private:
+        template <typename T>
+        const T &get(std::string_view type) const
+        {
+            const T *value = std::get_if<T>(&m_value);
+            if (!value)
+            {
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::JSON::TYPE_MISMATCH: The value is not a {}", type));
+            }
+            return *value;
+        }
+
+        std::variant<std::nullptr_t, bool, double, std::string, Array, Object> m_value; ///< Contents of the value.
+    };
+
+    namespace detail
+    {
+        /**
+         * @class Parser
+         * @brief Recursive descent parser over a text held in memory.
+         */
+        class Parser
+        {
+        public:
+            static constexpr std::size_t MAX_DEPTH = 256; ///< Nesting limit, guards the stack against hostile inputs.
+
+            explicit Parser(std::string_view text) : m_text(text)
+            {
+            }
+
+            Value parseDocument()
+            {
+                Value value = parseValue(0);
+                skipWhitespace();
+                if (m_position != m_text.size())
+                {
+                    fail("trailing characters");
+                }
+                return value;
+            }
+
+        private:
+            [[noreturn]] void fail(std::string_view reason) const
+            {
+                throw exception::TraceableException<std::runtime_error>(std::format("ERROR::JSON::PARSE_FAILED: {} at offset {}", reason, m_position));
+            }
+
+            void skipWhitespace()
+            {
+                while (m_position < m_text.size() && (m_text[m_position] == ' ' || m_text[m_position] == '\t' || m_text[m_position] == '\n' || m_text[m_position] == '\r'))
+                {
+                    ++m_position;
+                }
+            }
+
+            char peek()
+            {
+                skipWhitespace();
+                if (m_position == m_text.size())
+                {
+                    fail("unexpected end of text");
+                }
+                return m_text[m_position];
+            }
+
+            void expect(char c)
+            {
+                if (peek() != c)
+                {
+                    fail(std::format("expected '{}'", c));
+                }
+                ++m_position;
+            }
+
+            bool consume(std::string_view word)
+            {
+                if (m_text.substr(m_position, word.size()) != word)
+                {
+                    return false;
+                }
+                m_position += word.size();
+                return true;
+            }
+
+            Value parseValue(std::size_t depth)
+            {
+                if (depth > MAX_DEPTH)
+                {
+                    fail("nesting too deep");
+                }
+                switch (peek())
+                {
+                case '{':
+                    return parseObject(depth);
+                case '[':
+                    return parseArray(depth);
+                case '"':
+                    return Value(parseString());
+                default:
+                    break;
+                }
+                if (consume("true"))
+                {
+                    return Value(true);
+                }
+                if (consume("false"))
+                {
+                    return Value(false);
+                }
+                if (consume("null"))
+                {
+                    return Value();
+                }
+                return Value(parseNumber());
+            }
+
+            Value parseObject(std::size_t depth)
+            {
+                expect('{');
+                Value::Object object;
+                if (peek() == '}')
+                {
+                    ++m_position;
+                    return Value(std::move(object));
+                }
+                do
+                {
+                    if (peek() != '"')
+                    {
+                        fail("expected a member name");
+                    }
+                    std::string name = parseString();
+                    expect(':');
+                    object.emplace_back(std::move(name), parseValue(depth + 1));
+                } while (peek() == ',' && ++m_position);
+                expect('}');
+                return Value(std::move(object));
+            }
+
+            Value parseArray(std::size_t depth)
+            {
+                expect('[');
+                Value::Array array;
+                if (peek() == ']')
+                {
+                    ++m_position;
+                    return Value(std::move(array));
+                }
+                do
+                {
+                    array.push_back(parseValue(depth + 1));
+                } while (peek() == ',' && ++m_position);
+                expect(']');
+                return Value(std::move(array));
+            }
+
+            double parseNumber()
+            {
+                const char *first = m_text.data() + m_position;
+                const char *last = m_text.data() + m_text.size();
+                double number = 0;
+                auto [end, error] = std::from_chars(first, last, number);
+                if (error != std::errc() || end == first)
+                {
+                    fail("invalid value");
+                }
+                m_position += static_cast<std::size_t>(end - first);
+                return number;
+            }
+
+            std::uint32_t parseHex()
+            {
+                std::uint32_t code = 0;
+                auto [end, error] = std::from_chars(m_text.data() + m_position, m_text.data() + std::min(m_position + 4, m_text.size()), code, 16);
+                if (error != std::errc() || end != m_text.data() + m_position + 4)
+                {
+                    fail("invalid unicode escape");
+                }
+                m_position += 4;
+                return code;
+            }
+
+            void appendUtf8(std::string &out, std::uint32_t code)
+            {
+                if (code < 0x80)
+                {
+                    out += static_cast<char>(code);
+                }
+                else if (code < 0x800)
+                {
+                    out += static_cast<char>(0xc0 | (code >> 6));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                else if (code < 0x10000)
+                {
+                    out += static_cast<char>(0xe0 | (code >> 12));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                else
+                {
+                    out += static_cast<char>(0xf0 | (code >> 18));
+                    out += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                }
+            }
+
+            std::string parseString()
+            {
+                expect('"');
+                std::string out;
+                while (true)
+                {
+                    if (m_position == m_text.size())
+                    {
+                        fail("unterminated string");
+                    }
+                    const char c = m_text[m_position++];
+                    if (c == '"')
+                    {
+                        return out;
+                    }
+                    if (c != '\\')
+                    {
+                        out += c;
+                        continue;
+                    }
+                    if (m_position == m_text.size())
+                    {
+                        fail("unterminated string");
+                    }
+                    switch (const char escaped = m_text[m_position++])
+                    {
+                    case 'b':
+                        out += '\b';
+                        break;
+                    case 'f':
+                        out += '\f';
+                        break;
+                    case 'n':
+                        out += '\n';
+                        break;
+                    case 'r':
+                        out += '\r';
+                        break;
+                    case 't':
+                        out += '\t';
+                        break;
+                    case 'u':
+                    {
+                        std::uint32_t code = parseHex();
+                        if (code >= 0xd800 && code < 0xdc00 && consume("\\u"))
+                        {
+                            // Surrogate pair
+                            const std::uint32_t low = parseHex();
+                            if (low < 0xdc00 || low > 0xdfff)
+                            {
+                                fail("invalid low surrogate");
+                            }
+                            code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                        }
+                        appendUtf8(out, code);
+                        break;
+                    }
+                    default:
+                        out += escaped;
+                        break;
+                    }
+                }
+            }
+
+            std::string_view m_text;    ///< Text being parsed.
+            std::size_t m_position = 0; ///< Offset of the next character to read.
+        };
+    }
+
+    /**
+     * @brief Parses a JSON text.
+     * @throws common::exception::TraceableException If the text is not valid JSON.
+     */
+    inline Value parse(std::string_view text)
+    {
+        return detail::Parser(text).parseDocument();
+    }
+}
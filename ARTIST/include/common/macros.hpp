@@ -1,10 +1,10 @@
 #define PARENS () // Note space before (), so object-like macro
 
-#define EXPAND(arg) EXPAND1(EXPAND1(EXPAND1(EXPAND1(arg))))
-#define EXPAND1(arg) EXPAND2(EXPAND2(EXPAND2(EXPAND2(arg))))
-#define EXPAND2(arg) EXPAND3(EXPAND3(EXPAND3(EXPAND3(arg))))
-#define EXPAND3(arg) EXPAND4(EXPAND4(EXPAND4(EXPAND4(arg))))
-#define EXPAND4(arg) arg
+#define EXPAND(...) EXPAND1(EXPAND1(EXPAND1(EXPAND1(__VA_ARGS__))))
+#define EXPAND1(...) EXPAND2(EXPAND2(EXPAND2(EXPAND2(__VA_ARGS__))))
+#define EXPAND2(...) EXPAND3(EXPAND3(EXPAND3(EXPAND3(__VA_ARGS__))))
+#define EXPAND3(...) EXPAND4(EXPAND4(EXPAND4(EXPAND4(__VA_ARGS__))))
+#define EXPAND4(...) __VA_ARGS__
 
 #define FOR_EACH(macro, ...) \
     __VA_OPT__(EXPAND(FOR_EACH_HELPER(macro, __VA_ARGS__)))
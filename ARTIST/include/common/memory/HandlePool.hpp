@@ -0,0 +1,223 @@
+/**
+ * @file HandlePool.hpp
+ * @brief Objects stored column by column, referred to by generational handles.
+ *
+ * Objects linked by shared_ptr live wherever the allocator put them, and walking over them chases
+ * one pointer per object. A handle pool stores each field of its objects in an array of its own
+ * (structure of arrays), with the live objects packed at the front: a loop over one field reads
+ * contiguous memory only. Objects are referred to by handles, an index into a slot table and the
+ * generation of the slot. Destroying an object bumps the generation of its slot, so that handles to
+ * it no longer match once the slot is reused: checking a handle is one comparison.
+ *
+ * @code
+ * struct MeshTag;
+ * HandlePool<MeshTag, GLuint, GLsizei> meshes; // vertex array, index count
+ * const Handle<MeshTag> mesh = meshes.create(vertexArray, 36);
+ * for (GLsizei count : meshes.column<1>()) { total += count; }
+ * meshes.destroy(mesh);
+ * meshes.isValid(mesh); // false
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::common::memory
+{
+    /**
+     * @struct Handle
+     * @brief Reference to an object of a HandlePool, typed by a tag so that handles of different pools do not mix.
+     *
+     * A default-constructed handle refers to nothing and is never valid.
+     */
+    template <typename Tag>
+    struct Handle
+    {
+        static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t index = NONE;     ///< Slot of the object in its pool.
+        std::uint32_t generation = 0;   ///< Generation of the slot when the object was created.
+
+        [[nodiscard]] bool isNull() const
+        {
+            return index == NONE;
+        }
+
+        bool operator==(const Handle &) const = default;
+    };
+
+    /**
+     * @class HandlePool
+     * @brief Pool of objects made of the given columns, packed at the front of each column.
+     *
+     * Destroying an object moves the last object into its place, so the order of the columns is not
+     * stable across destructions; handles stay valid. Slots start at generation 1, so that no handle
+     * of generation 0 is ever valid.
+     */
+    template <typename Tag, typename... Columns>
+    class HandlePool
+    {
+    public:
+        using HandleType = Handle<Tag>;
+
+        template <std::size_t COLUMN>
+        using ColumnType = std::tuple_element_t<COLUMN, std::tuple<Columns...>>;
+
+        /**
+         * @brief Adds an object, reusing the slot of a destroyed one if any.
+         */
+        HandleType create(Columns... values)
+        {
+            std::uint32_t slot;
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                slot = static_cast<std::uint32_t>(m_slots.size());
+                m_slots.push_back({0, 1});
+            }
+            m_slots[slot].dense = static_cast<std::uint32_t>(m_owners.size());
+            m_owners.push_back(slot);
+            emplace(std::index_sequence_for<Columns...>{}, std::move(values)...);
+            return {slot, m_slots[slot].generation};
+        }
+
+        /**
+         * @brief Removes an object: every handle to it becomes invalid.
+         * @return False if the handle was not valid, in which case nothing happens.
+         */
+        bool destroy(HandleType handle)
+        {
+            if (!isValid(handle))
+            {
+                return false;
+            }
+            const std::uint32_t dense = m_slots[handle.index].dense;
+            const std::uint32_t last = static_cast<std::uint32_t>(m_owners.size() - 1);
+            if (dense != last)
+            {
+                moveLast(std::index_sequence_for<Columns...>{}, dense);
+                m_owners[dense] = m_owners[last];
+                m_slots[m_owners[dense]].dense = dense;
+            }
+            popLast(std::index_sequence_for<Columns...>{});
+            m_owners.pop_back();
+            ++m_slots[handle.index].generation;
+            m_freeSlots.push_back(handle.index);
+            return true;
+        }
+
+        /**
+         * @brief Whether a handle refers to a live object of this pool, in constant time.
+         */
+        [[nodiscard]] bool isValid(HandleType handle) const
+        {
+            return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+        }
+
+        /**
+         * @brief A field of an object.
+         * @throws common::exception::TraceableException If the handle is not valid.
+         */
+        template <std::size_t COLUMN>
+        [[nodiscard]] ColumnType<COLUMN> &get(HandleType handle)
+        {
+            return std::get<COLUMN>(m_columns)[denseIndex(handle)];
+        }
+
+        template <std::size_t COLUMN>
+        [[nodiscard]] const ColumnType<COLUMN> &get(HandleType handle) const
+        {
+            return std::get<COLUMN>(m_columns)[denseIndex(handle)];
+        }
+
+        /**
+         * @brief A field of every live object, contiguous. Entry i belongs to getHandle(i).
+         */
+        template <std::size_t COLUMN>
+        [[nodiscard]] std::span<ColumnType<COLUMN>> column()
+        {
+            return std::get<COLUMN>(m_columns);
+        }
+
+        template <std::size_t COLUMN>
+        [[nodiscard]] std::span<const ColumnType<COLUMN>> column() const
+        {
+            return std::get<COLUMN>(m_columns);
+        }
+
+        /**
+         * @brief The handle of the object at a position of the columns.
+         */
+        [[nodiscard]] HandleType getHandle(std::size_t dense) const
+        {
+            const std::uint32_t slot = m_owners[dense];
+            return {slot, m_slots[slot].generation};
+        }
+
+        /**
+         * @return The number of live objects.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_owners.size();
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_owners.empty();
+        }
+
+    private:
+        struct Slot
+        {
+            std::uint32_t dense;      ///< Position of the object in the columns.
+            std::uint32_t generation; ///< Bumped each time the object of the slot is destroyed.
+        };
+
+        std::uint32_t denseIndex(HandleType handle) const
+        {
+            if (!isValid(handle))
+            {
+                throw exception::TraceableException<std::out_of_range>(std::format("ERROR::HANDLE_POOL::INVALID_HANDLE: Slot {} generation {}", handle.index, handle.generation));
+            }
+            return m_slots[handle.index].dense;
+        }
+
+        template <std::size_t... COLUMN>
+        void emplace(std::index_sequence<COLUMN...>, Columns &&...values)
+        {
+            (std::get<COLUMN>(m_columns).push_back(std::move(values)), ...);
+        }
+
+        template <std::size_t... COLUMN>
+        void moveLast(std::index_sequence<COLUMN...>, std::uint32_t dense)
+        {
+            ((std::get<COLUMN>(m_columns)[dense] = std::move(std::get<COLUMN>(m_columns).back())), ...);
+        }
+
+        template <std::size_t... COLUMN>
+        void popLast(std::index_sequence<COLUMN...>)
+        {
+            (std::get<COLUMN>(m_columns).pop_back(), ...);
+        }
+
+        std::tuple<std::vector<Columns>...> m_columns; ///< One array per field, live objects only.
+        std::vector<std::uint32_t> m_owners;           ///< Slot of the object at each position of the columns.
+        std::vector<Slot> m_slots;                     ///< Position and generation of each slot.
+        std::vector<std::uint32_t> m_freeSlots;        ///< Slots of destroyed objects, reused first.
+    };
+}
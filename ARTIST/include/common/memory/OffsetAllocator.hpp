@@ -0,0 +1,152 @@
+/**
+ * @file OffsetAllocator.hpp
+ * @brief Sub-allocation of offsets inside a fixed-size block of memory.
+ *
+ * The allocator only manages offsets, it never touches the memory itself, so it can carve ranges
+ * out of GPU buffers as well as CPU arenas. Free blocks are kept in segregated lists, one per
+ * power-of-two size class, each sorted by size: an allocation looks for the best fit in its own
+ * class first, then takes the smallest block of the next non-empty class. Freed blocks are merged
+ * with their free neighbours.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+
+namespace artist::common::memory
+{
+    /**
+     * @class OffsetAllocator
+     * @brief Best-fit allocator of [offset, offset + size) ranges with size-class free lists.
+     */
+    class OffsetAllocator
+    {
+    public:
+        explicit OffsetAllocator(std::size_t capacity)
+            : m_capacity(capacity)
+        {
+            reset();
+        }
+
+        /**
+         * @brief Allocates a range of the given size.
+         * @return The offset of the range, or std::nullopt if no free block is large enough.
+         */
+        std::optional<std::size_t> allocate(std::size_t size)
+        {
+            if (size == 0)
+            {
+                return std::nullopt;
+            }
+            for (std::size_t bin = binOf(size); bin < m_bins.size(); ++bin)
+            {
+                auto it = m_bins[bin].lower_bound({size, 0});
+                if (it == m_bins[bin].end())
+                {
+                    continue;
+                }
+                auto [blockSize, offset] = *it;
+                m_bins[bin].erase(it);
+                m_blocks.erase(offset);
+                if (blockSize > size)
+                {
+                    insert(offset + size, blockSize - size);
+                }
+                m_freeSize -= size;
+                return offset;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Releases a range previously returned by allocate().
+         */
+        void free(std::size_t offset, std::size_t size)
+        {
+            m_freeSize += size;
+            auto next = m_blocks.lower_bound(offset);
+            if (next != m_blocks.end() && offset + size == next->first)
+            {
+                size += next->second;
+                next = erase(next);
+            }
+            if (next != m_blocks.begin())
+            {
+                auto previous = std::prev(next);
+                if (previous->first + previous->second == offset)
+                {
+                    offset = previous->first;
+                    size += previous->second;
+                    erase(previous);
+                }
+            }
+            insert(offset, size);
+        }
+
+        /**
+         * @brief Releases every range at once.
+         */
+        void reset()
+        {
+            m_blocks.clear();
+            for (auto &bin : m_bins)
+            {
+                bin.clear();
+            }
+            m_freeSize = m_capacity;
+            if (m_capacity > 0)
+            {
+                insert(0, m_capacity);
+            }
+        }
+
+        [[nodiscard]] std::size_t getCapacity() const
+        {
+            return m_capacity;
+        }
+
+        [[nodiscard]] std::size_t getFreeSize() const
+        {
+            return m_freeSize;
+        }
+
+        /**
+         * @brief Number of disjoint free blocks, 1 when the free space is not fragmented.
+         */
+        [[nodiscard]] std::size_t getFreeBlockCount() const
+        {
+            return m_blocks.size();
+        }
+
+    private:
+        static std::size_t binOf(std::size_t size)
+        {
+            return static_cast<std::size_t>(std::bit_width(size)) - 1;
+        }
+
+        void insert(std::size_t offset, std::size_t size)
+        {
+            m_blocks.emplace(offset, size);
+            m_bins[binOf(size)].emplace(size, offset);
+        }
+
+        std::map<std::size_t, std::size_t>::iterator erase(std::map<std::size_t, std::size_t>::iterator block)
+        {
+            m_bins[binOf(block->second)].erase({block->second, block->first});
+            return m_blocks.erase(block);
+        }
+
+        using Bin = std::set<std::pair<std::size_t, std::size_t>>;
+
+        std::size_t m_capacity;                          ///< Size of the managed block.
+        std::size_t m_freeSize = 0;                      ///< Sum of the free block sizes.
+        std::map<std::size_t, std::size_t> m_blocks;     ///< Free blocks: offset to size.
+        std::array<Bin, sizeof(std::size_t) * 8> m_bins; ///< Free blocks per size class: (size, offset).
+    };
+}
@@ -0,0 +1,115 @@
+/**
+ * @file CpuFeatures.hpp
+ * @brief Runtime selection of SIMD code paths.
+ *
+ * Kernels are compiled for several instruction sets in the same binary, each with the target
+ * attribute of its instruction set, and the best one supported by the running CPU is picked at
+ * runtime. The binary therefore still runs on CPUs without AVX2 while using it where available.
+ *
+ * @code
+ * ARTIST_TARGET("avx2") inline void kernelAvx2(...);
+ *
+ * if (common::simd::getSimdLevel() >= common::simd::SimdLevel::Avx2)
+ * {
+ *     kernelAvx2(...);
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ARTIST_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(ARTIST_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define ARTIST_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ARTIST_TARGET(isa)
+#endif
+
+namespace artist::common::simd
+{
+    /**
+     * @enum SimdLevel
+     * @brief Instruction sets with dedicated kernels, ordered from the least to the most capable.
+     */
+    enum class SimdLevel
+    {
+        Scalar, ///< Portable C++.
+        Sse41,  ///< SSE up to 4.1, 128-bit vectors.
+        Avx2,   ///< AVX, AVX2 and F16C, 256-bit vectors.
+    };
+
+    /**
+     * @brief Queries the instruction sets supported by the CPU and the operating system.
+     */
+    inline SimdLevel detectSimdLevel()
+    {
+#if defined(ARTIST_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c"))
+        {
+            return SimdLevel::Avx2;
+        }
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            return SimdLevel::Sse41;
+        }
+#elif defined(ARTIST_SIMD_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        const bool sse41 = (info[2] & (1 << 19)) != 0;
+        const bool osAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        const bool f16c = (info[2] & (1 << 29)) != 0;
+        __cpuidex(info, 7, 0);
+        if (osAvx && f16c && (info[1] & (1 << 5)) != 0)
+        {
+            return SimdLevel::Avx2;
+        }
+        if (sse41)
+        {
+            return SimdLevel::Sse41;
+        }
+#endif
+        return SimdLevel::Scalar;
+    }
+
+    namespace detail
+    {
+        inline std::atomic<SimdLevel> &simdLevel()
+        {
+            static std::atomic<SimdLevel> level{detectSimdLevel()};
+            return level;
+        }
+    }
+
+    /**
+     * @brief Level of the kernels used by dispatching functions.
+     */
+    inline SimdLevel getSimdLevel()
+    {
+        return detail::simdLevel().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Restricts the kernels used by dispatching functions, e.g. to compare them in tests.
+     *
+     * The level is clamped to the one supported by the CPU.
+     *
+     * @return The level actually selected.
+     */
+    inline SimdLevel setSimdLevel(SimdLevel level)
+    {
+        const SimdLevel supported = detectSimdLevel();
+        const SimdLevel selected = level < supported ? level : supported;
+        detail::simdLevel().store(selected, std::memory_order_relaxed);
+        return selected;
+    }
+}
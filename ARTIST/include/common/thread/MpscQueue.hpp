@@ -0,0 +1,128 @@
+/**
+ * @file MpscQueue.hpp
+ * @brief Bounded lock-free queue with any number of producers and a single consumer.
+ *
+ * The queue is a ring of cells, each with a sequence number telling whose turn it is: a producer
+ * claims the next cell with a compare-and-swap on the enqueue position, writes its value, then
+ * publishes the cell by advancing its sequence; the consumer reads cells in order once they are
+ * published and hands them back to producers one lap later. Producers never wait on each other
+ * beyond retrying the compare-and-swap, and never wait on the consumer unless the ring is full.
+ *
+ * @code
+ * MpscQueue<Command> queue(1024);
+ * queue.tryPush(std::move(command)); // any thread
+ * Command next;
+ * while (queue.tryPop(next)) { next(); } // one thread
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::common::thread
+{
+    /**
+     * @class MpscQueue
+     * @brief Ring buffer of T, written by several threads and read by one.
+     */
+    template <typename T>
+    class MpscQueue
+    {
+    public:
+        /**
+         * @param capacity Number of values the queue holds, a power of two.
+         * @throws common::exception::TraceableException If the capacity is not a power of two.
+         */
+        explicit MpscQueue(std::size_t capacity)
+            : m_cells(std::make_unique<Cell[]>(capacity)), m_mask(capacity - 1)
+        {
+            if (!std::has_single_bit(capacity))
+            {
+                throw exception::TraceableException<std::invalid_argument>(std::format("ERROR::MPSC_QUEUE::INVALID_CAPACITY: {} is not a power of two", capacity));
+            }
+            for (std::size_t i = 0; i < capacity; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        /**
+         * @brief Appends a value, from any thread.
+         * @return False if the queue is full, in which case value is left untouched.
+         */
+        bool tryPush(T &&value)
+        {
+            std::size_t position = m_enqueue.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell &cell = m_cells[position & m_mask];
+                const auto lag = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - position);
+                if (lag == 0)
+                {
+                    if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false; // The consumer has not freed the cell from the previous lap
+                }
+                else
+                {
+                    position = m_enqueue.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Takes the oldest published value, from the consumer thread only.
+         * @return False if no value is published.
+         */
+        bool tryPop(T &value)
+        {
+            Cell &cell = m_cells[m_dequeue & m_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != m_dequeue + 1)
+            {
+                return false;
+            }
+            value = std::move(cell.value);
+            cell.value = T{};
+            cell.sequence.store(m_dequeue + m_mask + 1, std::memory_order_release);
+            ++m_dequeue;
+            return true;
+        }
+
+        [[nodiscard]] std::size_t getCapacity() const
+        {
+            return m_mask + 1;
+        }
+
+    private:
+        static constexpr std::size_t CACHE_LINE = 64; ///< Keeps producer and consumer positions on separate cache lines.
+
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence; ///< Position the cell is expected at: published when position + 1.
+            T value;                           ///< Value of the cell.
+        };
+
+        std::unique_ptr<Cell[]> m_cells;                                ///< The ring.
+        std::size_t m_mask;                                             ///< Capacity minus one.
+        alignas(CACHE_LINE) std::atomic<std::size_t> m_enqueue = 0;     ///< Next position claimed by a producer.
+        alignas(CACHE_LINE) std::size_t m_dequeue = 0;                  ///< Next position read by the consumer.
+    };
+}
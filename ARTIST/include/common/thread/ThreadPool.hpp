@@ -0,0 +1,191 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Fixed set of worker threads running submitted tasks.
+ *
+ * Besides one-off tasks, the pool splits loops into chunks run by the workers and by the calling
+ * thread together. The caller never blocks on a queued task, so loops may be nested inside tasks.
+ *
+ * @code
+ * ThreadPool pool;
+ * pool.parallelFor(vertexCount, 4096, [&](std::size_t first, std::size_t last)
+ *                  { decode(first, last); });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace artist::common::thread
+{
+    /**
+     * @class ThreadPool
+     * @brief Runs tasks on worker threads, in submission order.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @param threadCount Number of worker threads. Defaults to one per hardware thread.
+         */
+        explicit ThreadPool(std::size_t threadCount = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            m_workers.reserve(threadCount);
+            for (std::size_t i = 0; i < threadCount; ++i)
+            {
+                m_workers.emplace_back([this](std::stop_token stop)
+                                       { work(stop); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief Stops the workers once they finish their current task. Queued tasks are abandoned.
+         */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                for (auto &worker : m_workers)
+                {
+                    worker.request_stop();
+                }
+            }
+            m_condition.notify_all();
+        }
+
+        /**
+         * @brief Queues a task. Thread-safe.
+         * @return A future holding the result of the task, or the exception it threw.
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<F>> submit(F &&task)
+        {
+            auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task));
+            std::future<std::invoke_result_t<F>> future = packaged->get_future();
+            {
+                std::lock_guard lock(m_mutex);
+                m_tasks.emplace_back([packaged]()
+                                     { (*packaged)(); });
+            }
+            m_condition.notify_one();
+            return future;
+        }
+
+        /**
+         * @brief Calls body(first, last) over [0, count) split in chunks of grain items, in parallel.
+         *
+         * Returns once every chunk has run. If chunks throw, the first exception is rethrown.
+         */
+        template <typename F>
+        void parallelFor(std::size_t count, std::size_t grain, F &&body)
+        {
+            grain = std::max<std::size_t>(grain, 1);
+            const std::size_t chunks = (count + grain - 1) / grain;
+            if (chunks <= 1 || m_workers.empty())
+            {
+                if (count > 0)
+                {
+                    body(std::size_t{0}, count);
+                }
+                return;
+            }
+
+            struct Loop
+            {
+                std::atomic<std::size_t> next = 0;  ///< Next chunk to run.
+                std::atomic<std::size_t> done = 0;  ///< Chunks finished, thrown included.
+                std::mutex mutex;                   ///< Guards error.
+                std::exception_ptr error;           ///< First exception thrown by a chunk.
+            };
+            auto loop = std::make_shared<Loop>();
+            auto run = [loop, chunks, count, grain, &body]()
+            {
+                for (std::size_t chunk = loop->next++; chunk < chunks; chunk = loop->next++)
+                {
+                    try
+                    {
+                        body(chunk * grain, std::min(count, (chunk + 1) * grain));
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(loop->mutex);
+                        if (!loop->error)
+                        {
+                            loop->error = std::current_exception();
+                        }
+                    }
+                    if (++loop->done == chunks)
+                    {
+                        loop->done.notify_all();
+                    }
+                }
+            };
+
+            // Helpers that start after the loop is over find no chunk left and never touch body
+            const std::size_t helpers = std::min(m_workers.size(), chunks - 1);
+            {
+                std::lock_guard lock(m_mutex);
+                for (std::size_t i = 0; i < helpers; ++i)
+                {
+                    m_tasks.emplace_back(run);
+                }
+            }
+            m_condition.notify_all();
+            run();
+            for (std::size_t done = loop->done; done < chunks; done = loop->done)
+            {
+                loop->done.wait(done);
+            }
+            if (loop->error)
+            {
+                std::rethrow_exception(loop->error);
+            }
+        }
+
+        [[nodiscard]] std::size_t getThreadCount() const
+        {
+            return m_workers.size();
+        }
+
+    private:
+        void work(std::stop_token stop)
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_condition.wait(lock, [this, &stop]()
+                                     { return stop.stop_requested() || !m_tasks.empty(); });
+                    if (stop.stop_requested())
+                    {
+                        return;
+                    }
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex m_mutex;                        ///< Guards the task queue.
+        std::condition_variable m_condition;       ///< Signals queued tasks and stop requests.
+        std::deque<std::function<void()>> m_tasks; ///< Tasks waiting for a worker.
+        std::vector<std::jthread> m_workers;       ///< Worker threads, joined on destruction.
+    };
+}
@@ -3,9 +3,12 @@
 #pragma once
 #include <string>
 #include <format>
-#include <any>
 #include <memory>
+#include <span>
+#include <cstddef>
+#include <typeindex>
 #include <common/exception/TraceableException.hpp>
+#include <graphic/context/DirtyRanges.hpp>
 
 namespace artist::graphic::context
 {
@@ -18,38 +21,117 @@ namespace artist::graphic::context
         template <typename T>
         std::shared_ptr<T> getValue() const
         {
-            if (m_value.has_value())
+            if (!m_value)
             {
-                try
-                {
-                    return std::any_cast<std::shared_ptr<T>>(m_value);
-                }
-                catch (const std::bad_any_cast &)
-                {
-                    throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the attribute variable ({})", typeid(T).name(), typeid(m_value).name()));
-                }
+                return nullptr;
             }
-            return nullptr;
+            if (m_type != typeid(T))
+            {
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the attribute variable ({})", typeid(T).name(), m_type.name()));
+            }
+            return std::static_pointer_cast<T>(m_value);
         }
 
         template <typename T>
         void setValue(std::shared_ptr<T> value)
         {
-            if (m_value.has_value())
+            checkType<T>();
+            m_value = value;
+            m_data = value ? std::as_bytes(std::span<const T>(value.get(), 1)) : std::span<const std::byte>();
+            m_dirty.clear();
+            m_dirty.mark(0, m_data.size());
+        }
+
+        /**
+         * @brief Sets an array of values to upload for the attribute.
+         *
+         * The values are not copied: the caller keeps ownership of the storage until it has been
+         * uploaded by the API-specific setter.
+         *
+         * @tparam T The type of one vertex.
+         * @param values The vertices to upload.
+         */
+        template <typename T>
+        void setValues(std::span<const T> values)
+        {
+            checkType<T>();
+            m_value.reset();
+            m_data = std::as_bytes(values);
+            m_dirty.clear();
+            m_dirty.mark(0, m_data.size());
+        }
+
+        /**
+         * @brief Sets an array of values of which only a part changed since the last upload.
+         *
+         * Only the given range of vertices is marked dirty. If the array does not have the same size
+         * as the previous one, the whole array is marked dirty.
+         *
+         * @tparam T The type of one vertex.
+         * @param values The whole vertex array.
+         * @param first Index of the first modified vertex.
+         * @param count Number of modified vertices.
+         */
+        template <typename T>
+        void updateValues(std::span<const T> values, std::size_t first, std::size_t count)
+        {
+            if (first > values.size() || count > values.size() - first)
             {
-                try
-                {
-                    std::any_cast<std::shared_ptr<T>>(m_value);
-                }
-                catch (const std::bad_any_cast &)
-                {
-                    throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the attribute variable ({})", typeid(value).name(), typeid(m_value).name()));
-                }
+                throw artist::common::exception::TraceableException<std::out_of_range>(std::format("ERROR::ATTRIBUTE::UPDATE::OUT_OF_RANGE: Vertices [{}, {}) are outside of an array of {} vertices", first, first + count, values.size()));
             }
-            m_value = value;
+            checkType<T>();
+            std::span<const std::byte> data = std::as_bytes(values);
+            if (m_value || data.size() != m_data.size())
+            {
+                m_value.reset();
+                m_data = data;
+                m_dirty.clear();
+                m_dirty.mark(0, m_data.size());
+                return;
+            }
+            m_data = data;
+            m_dirty.mark(first * sizeof(T), count * sizeof(T));
+        }
+
+        /**
+         * @brief Get the raw bytes to upload for the attribute.
+         * @return The bytes of the last value or values set.
+         */
+        [[nodiscard]] std::span<const std::byte> getData() const
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Get the byte ranges of the data modified since the last upload.
+         */
+        [[nodiscard]] const DirtyRanges &getDirtyRanges() const
+        {
+            return m_dirty;
+        }
+
+        /**
+         * @brief Marks the data as uploaded.
+         */
+        void clearDirtyRanges()
+        {
+            m_dirty.clear();
         }
 
     private:
-        std::any m_value; ///< The value of the attribute variable.
+        template <typename T>
+        void checkType()
+        {
+            if (m_type != typeid(void) && m_type != typeid(T))
+            {
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the attribute variable ({})", typeid(T).name(), m_type.name()));
+            }
+            m_type = typeid(T);
+        }
+
+        std::shared_ptr<void> m_value;         ///< Keeps the single value set alive, typed by m_type.
+        std::span<const std::byte> m_data;     ///< The bytes uploaded for the attribute variable.
+        std::type_index m_type = typeid(void); ///< The type of one element of the attribute variable.
+        DirtyRanges m_dirty;                   ///< The bytes modified since the last upload.
     };
 }
@@ -0,0 +1,109 @@
+/**
+ * @file DirtyRanges.hpp
+ * @brief Tracking of the modified byte ranges of a buffer.
+ *
+ * Ranges are kept sorted and merged as they are marked, so an API-specific setter can upload
+ * each modified region with one call instead of re-uploading the whole buffer.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace artist::graphic::context
+{
+    /**
+     * @struct DirtyRange
+     * @brief A modified region of a buffer, in bytes.
+     */
+    struct DirtyRange
+    {
+        std::size_t offset = 0; ///< First modified byte.
+        std::size_t size = 0;   ///< Number of modified bytes.
+
+        [[nodiscard]] std::size_t end() const
+        {
+            return offset + size;
+        }
+
+        bool operator==(const DirtyRange &) const = default;
+    };
+
+    /**
+     * @class DirtyRanges
+     * @brief Sorted set of disjoint modified ranges of a buffer.
+     *
+     * Overlapping and adjacent ranges are merged when marked.
+     */
+    class DirtyRanges
+    {
+    public:
+        /**
+         * @brief Marks a region as modified.
+         * @param offset First modified byte.
+         * @param size Number of modified bytes. Empty regions are ignored.
+         */
+        void mark(std::size_t offset, std::size_t size)
+        {
+            if (size == 0)
+            {
+                return;
+            }
+            DirtyRange range{offset, size};
+
+            // First range that may touch the new one, i.e. which does not end before it starts
+            auto first = std::ranges::lower_bound(m_ranges, range.offset, {}, &DirtyRange::end);
+            auto last = first;
+            while (last != m_ranges.end() && last->offset <= range.end())
+            {
+                std::size_t end = std::max(range.end(), last->end());
+                range.offset = std::min(range.offset, last->offset);
+                range.size = end - range.offset;
+                ++last;
+            }
+            first = m_ranges.erase(first, last);
+            m_ranges.insert(first, range);
+        }
+
+        /**
+         * @brief Checks whether the modified regions cover the whole [0, size) buffer.
+         */
+        [[nodiscard]] bool covers(std::size_t size) const
+        {
+            return m_ranges.size() == 1 && m_ranges.front().offset == 0 && m_ranges.front().size >= size;
+        }
+
+        /**
+         * @brief Total number of dirty bytes.
+         */
+        [[nodiscard]] std::size_t getByteCount() const
+        {
+            std::size_t bytes = 0;
+            for (const auto &range : m_ranges)
+            {
+                bytes += range.size;
+            }
+            return bytes;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_ranges.empty();
+        }
+
+        void clear()
+        {
+            m_ranges.clear();
+        }
+
+        [[nodiscard]] const std::vector<DirtyRange> &getRanges() const
+        {
+            return m_ranges;
+        }
+
+    private:
+        std::vector<DirtyRange> m_ranges; ///< Disjoint, non-adjacent ranges sorted by offset.
+    };
+}
@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <graphic/Api.hpp>
+#include <graphic/pipeline/DrawKey.hpp>
 #include <graphic/pipeline/Pass.hpp>
 
 namespace artist::graphic::context
@@ -20,7 +21,7 @@ namespace artist::graphic::context
             m_passes.push_back(pass);
         }
 
-        [[nodiscard]] std::shared_ptr<pipeline::IPass<API>> getPass(const int &index) const
+        [[nodiscard]] const std::shared_ptr<pipeline::IPass<API>> &getPass(const int &index) const
         {
             return m_passes[index];
         }
@@ -40,8 +41,25 @@ namespace artist::graphic::context
             return m_currentPass;
         }
 
+        /**
+         * @brief Sets how the draws of the pipeline encode their sort keys.
+         *
+         * Command recorders encode the key of each draw packet with this layout, so that merging
+         * orders the draws as the pipeline needs, e.g. back to front for transparent passes.
+         */
+        void setDrawKeyLayout(const pipeline::DrawKeyLayout &layout)
+        {
+            m_drawKeyLayout = layout;
+        }
+
+        [[nodiscard]] const pipeline::DrawKeyLayout &getDrawKeyLayout() const
+        {
+            return m_drawKeyLayout;
+        }
+
     private:
         std::vector<std::shared_ptr<pipeline::IPass<API>>> m_passes;
         int m_currentPass = -1;
+        pipeline::DrawKeyLayout m_drawKeyLayout = pipeline::DrawKeyLayout::opaque(); ///< Layout of the sort keys of the draws
     };
 }
\ No newline at end of file
@@ -3,49 +3,80 @@
 #pragma once
 #include <string>
 #include <format>
-#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
 #include <common/exception/TraceableException.hpp>
 
 namespace artist::graphic::context
 {
+    /**
+     * @class UniformContext
+     * @brief Stores the value of a uniform variable inline, tagged by the type of the API setter.
+     *
+     * The value is copied into a fixed buffer sized for the largest uniform type (a 4x4 matrix of
+     * doubles), so setting a value never allocates. The tag is the type constant of the API setter of
+     * the value type (OpenGLUniformSetter<T>::glType for OpenGL): the first value set fixes it, and a
+     * later value of another type is rejected.
+     */
     template <typename API>
     class UniformContext
     {
     public:
+        static constexpr std::size_t STORAGE_SIZE = 16 * sizeof(double); ///< Size of a dmat4, the largest uniform type.
+
         virtual ~UniformContext() = default;
 
         template <typename T>
         const T &getValue() const
         {
-            if (m_value.has_value())
-            {
-                try
-                {
-                    std::any_cast<T>(&m_value);
-                }
-                catch (const std::bad_any_cast &)
-                {
-                    throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::UNIFORM::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the uniform variable ({})", typeid(T).name(), typeid(m_value).name()));
-                }
-            }
-            return *std::any_cast<T>(&m_value);
+            checkTag<T>(typeTag<T>(), "GET");
+            return *std::launder(reinterpret_cast<const T *>(m_storage.data()));
         }
 
         template <typename T>
         void setValue(const T &value)
         {
-            try
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= STORAGE_SIZE && alignof(T) <= alignof(std::max_align_t), "Uniform values are trivially copyable and fit in the inline storage");
+            const std::uint32_t tag = typeTag<T>();
+            if (m_tag != NO_TAG)
             {
-                std::any_cast<T>(&m_value);
+                checkTag<T>(tag, "SET");
             }
-            catch (const std::bad_any_cast &)
+            std::memcpy(m_storage.data(), &value, sizeof(T));
+            m_tag = tag;
+        }
+
+        /**
+         * @brief Checks whether a value has been set.
+         */
+        [[nodiscard]] bool hasValue() const
+        {
+            return m_tag != NO_TAG;
+        }
+
+    private:
+        static constexpr std::uint32_t NO_TAG = 0;
+
+        template <typename T>
+        static constexpr std::uint32_t typeTag()
+        {
+            return static_cast<std::uint32_t>(API::UniformContext::template Setter<T>::glType);
+        }
+
+        template <typename T>
+        void checkTag(std::uint32_t tag, const char *operation) const
+        {
+            if (tag != m_tag)
             {
-                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::UNIFORM::SET::TYPE_MISMATCH: The type of the value ({}) does not match the type of the uniform variable ({})", typeid(value).name(), typeid(m_value).name()));
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::UNIFORM::{}::TYPE_MISMATCH: The type of the value ({}, 0x{:04X}) does not match the type of the uniform variable (0x{:04X})", operation, typeid(T).name(), tag, m_tag));
             }
-            m_value = value;
         }
 
-    private:
-        std::any m_value; ///< The value of the uniform variable.
+        alignas(std::max_align_t) std::array<std::byte, STORAGE_SIZE> m_storage{}; ///< The value of the uniform variable.
+        std::uint32_t m_tag = NO_TAG;                                              ///< The type of the value, 0 if unset.
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Frustum.hpp
+ * @brief View frustum planes for CPU-side visibility tests.
+ *
+ * The planes are extracted from a projection matrix with the Gribb-Hartmann method. Extracted from
+ * a model-view-projection matrix, they are expressed in the object space of the model, so bounds
+ * computed at import time can be tested without being transformed.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace artist::graphic::geometry
+{
+    /**
+     * @struct Frustum
+     * @brief Six planes (a, b, c, d) with normals pointing inside: a point p is inside when a*x + b*y + c*z + d >= 0 for every plane.
+     */
+    struct Frustum
+    {
+        std::array<std::array<float, 4>, 6> planes{}; ///< Left, right, bottom, top, near and far planes, normalized.
+
+        /**
+         * @brief Extracts the planes of an OpenGL clip space (-w <= z <= w) projection.
+         * @param matrix Column-major 4x4 matrix, e.g. glm::value_ptr of a glm::mat4.
+         */
+        static Frustum fromMatrix(std::span<const float, 16> matrix)
+        {
+            auto row = [&matrix](std::size_t r)
+            {
+                return std::array<float, 4>{matrix[r], matrix[4 + r], matrix[8 + r], matrix[12 + r]};
+            };
+            const auto x = row(0);
+            const auto y = row(1);
+            const auto z = row(2);
+            const auto w = row(3);
+            Frustum frustum;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                frustum.planes[0][k] = w[k] + x[k];
+                frustum.planes[1][k] = w[k] - x[k];
+                frustum.planes[2][k] = w[k] + y[k];
+                frustum.planes[3][k] = w[k] - y[k];
+                frustum.planes[4][k] = w[k] + z[k];
+                frustum.planes[5][k] = w[k] - z[k];
+            }
+            for (auto &plane : frustum.planes)
+            {
+                const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+                if (length > 0.0f)
+                {
+                    for (float &value : plane)
+                    {
+                        value /= length;
+                    }
+                }
+            }
+            return frustum;
+        }
+
+        /**
+         * @brief Checks whether a sphere is at least partly inside the frustum.
+         */
+        [[nodiscard]] bool intersectsSphere(const std::array<float, 3> &center, float radius) const
+        {
+            for (const auto &plane : planes)
+            {
+                if (plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3] < -radius)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
@@ -0,0 +1,356 @@
+/**
+ * @file IndexOptimizer.hpp
+ * @brief Import-time reordering of triangle indices for the post-transform vertex cache and overdraw.
+ *
+ * GPUs and software rasterizers cache the results of the vertex shader for the last few indices;
+ * drawing triangles that share vertices close together in the index stream avoids shading the
+ * same vertex several times. `optimizeVertexCache` reorders triangles with Tom Forsyth's linear-speed
+ * algorithm. `optimizeOverdraw` then reorders the resulting clusters so that triangles facing away
+ * from the mesh center are drawn first, which lets the depth test reject more hidden fragments,
+ * without breaking the cache locality inside each cluster.
+ *
+ * Both functions only permute whole triangles: the set of triangles and their winding are kept.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <numeric>
+#include <span>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::geometry
+{
+    namespace detail
+    {
+        inline void checkTriangles(std::span<const std::uint32_t> indices, std::size_t vertexCount)
+        {
+            if (indices.size() % 3 != 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::GEOMETRY::NOT_A_TRIANGLE_LIST: {} indices", indices.size()));
+            }
+            for (std::uint32_t index : indices)
+            {
+                if (index >= vertexCount)
+                {
+                    throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::GEOMETRY::INDEX_OUT_OF_RANGE: Index {} addresses one of {} vertices", index, vertexCount));
+                }
+            }
+        }
+
+        /**
+         * @brief Score of a vertex in Forsyth's algorithm, from its cache position and remaining triangles.
+         */
+        inline float vertexScore(int cachePosition, std::uint32_t remainingTriangles, std::size_t cacheSize)
+        {
+            if (remainingTriangles == 0)
+            {
+                return -1.0f;
+            }
+            float score = 0.0f;
+            if (cachePosition >= 0)
+            {
+                if (cachePosition < 3)
+                {
+                    // The last triangle's vertices are scored lower, to avoid strips of thin triangles
+                    score = 0.75f;
+                }
+                else
+                {
+                    const float scale = 1.0f / static_cast<float>(cacheSize - 3);
+                    score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, 1.5f);
+                }
+            }
+            // Boost vertices with few triangles left, so they get finished and leave the cache
+            return score + 2.0f / std::sqrt(static_cast<float>(remainingTriangles));
+        }
+    }
+
+    /**
+     * @brief Average number of vertex shader invocations per triangle with a FIFO cache.
+     *
+     * 3.0 means no reuse at all; well ordered regular meshes get close to 0.5.
+     */
+    inline float analyzeVertexCache(std::span<const std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize = 16)
+    {
+        if (indices.size() < 3)
+        {
+            return 0.0f;
+        }
+        std::vector<std::size_t> insertedAt(vertexCount, 0);
+        std::size_t misses = 0;
+        for (std::uint32_t index : indices)
+        {
+            // A vertex is in the cache if fewer than cacheSize misses happened since it was inserted
+            if (insertedAt[index] == 0 || misses - insertedAt[index] >= cacheSize)
+            {
+                ++misses;
+                insertedAt[index] = misses;
+            }
+        }
+        return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+    }
+
+    /**
+     * @brief Reorders triangles to maximize post-transform vertex cache hits (Forsyth's algorithm).
+     * @param indices Triangle list, reordered in place.
+     * @param vertexCount Number of vertices addressed by the indices.
+     * @param cacheSize Size of the simulated LRU cache, at least 4.
+     */
+    inline void optimizeVertexCache(std::span<std::uint32_t> indices, std::size_t vertexCount, std::size_t cacheSize = 32)
+    {
+        detail::checkTriangles(indices, vertexCount);
+        cacheSize = std::max<std::size_t>(cacheSize, 4);
+        const std::size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+        {
+            return;
+        }
+
+        // Triangles of each vertex, in compressed rows; the first `remaining` entries are not emitted yet
+        std::vector<std::uint32_t> remaining(vertexCount, 0);
+        for (std::uint32_t index : indices)
+        {
+            ++remaining[index];
+        }
+        std::vector<std::uint32_t> firstTriangle(vertexCount + 1, 0);
+        std::partial_sum(remaining.begin(), remaining.end(), firstTriangle.begin() + 1);
+        std::vector<std::uint32_t> adjacency(indices.size());
+        {
+            std::vector<std::uint32_t> fill(firstTriangle.begin(), firstTriangle.end() - 1);
+            for (std::size_t i = 0; i < indices.size(); ++i)
+            {
+                adjacency[fill[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+            }
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScores(vertexCount);
+        for (std::size_t v = 0; v < vertexCount; ++v)
+        {
+            vertexScores[v] = detail::vertexScore(-1, remaining[v], cacheSize);
+        }
+        std::vector<float> triangleScores(triangleCount);
+        for (std::size_t t = 0; t < triangleCount; ++t)
+        {
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+        }
+
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<std::uint32_t> output;
+        output.reserve(indices.size());
+        std::vector<std::uint32_t> cache;
+        std::vector<std::uint32_t> nextCache;
+        cache.reserve(cacheSize + 3);
+        nextCache.reserve(cacheSize + 3);
+
+        std::size_t best = static_cast<std::size_t>(std::ranges::max_element(triangleScores) - triangleScores.begin());
+        std::size_t cursor = 0;
+        for (std::size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+        {
+            emitted[best] = true;
+            const std::array<std::uint32_t, 3> triangle{indices[best * 3], indices[best * 3 + 1], indices[best * 3 + 2]};
+            output.insert(output.end(), triangle.begin(), triangle.end());
+
+            // Remove the triangle from the adjacency of its vertices
+            for (std::uint32_t v : triangle)
+            {
+                auto begin = adjacency.begin() + firstTriangle[v];
+                auto end = begin + remaining[v];
+                auto it = std::find(begin, end, static_cast<std::uint32_t>(best));
+                if (it != end)
+                {
+                    std::iter_swap(it, end - 1);
+                    --remaining[v];
+                }
+            }
+
+            // The triangle's vertices move to the front of the LRU cache
+            nextCache.clear();
+            for (std::uint32_t v : triangle)
+            {
+                if (std::ranges::find(nextCache, v) == nextCache.end())
+                {
+                    nextCache.push_back(v); // Degenerate triangles repeat a vertex
+                }
+            }
+            for (std::uint32_t v : cache)
+            {
+                if (std::ranges::find(triangle, v) == triangle.end())
+                {
+                    nextCache.push_back(v);
+                }
+            }
+            for (std::size_t i = cacheSize; i < nextCache.size(); ++i)
+            {
+                cachePosition[nextCache[i]] = -1;
+            }
+
+            // Rescore the cached and evicted vertices, and propagate the change to their triangles
+            for (std::size_t i = 0; i < nextCache.size(); ++i)
+            {
+                const std::uint32_t v = nextCache[i];
+                if (i < cacheSize)
+                {
+                    cachePosition[v] = static_cast<int>(i);
+                }
+                const float score = detail::vertexScore(cachePosition[v], remaining[v], cacheSize);
+                const float delta = score - vertexScores[v];
+                vertexScores[v] = score;
+                for (std::uint32_t k = 0; k < remaining[v]; ++k)
+                {
+                    triangleScores[adjacency[firstTriangle[v] + k]] += delta;
+                }
+            }
+
+            // Next triangle: the best one using a cached vertex
+            best = triangleCount;
+            float bestScore = -1.0f;
+            for (std::size_t i = 0; i < std::min(nextCache.size(), cacheSize); ++i)
+            {
+                const std::uint32_t v = nextCache[i];
+                for (std::uint32_t k = 0; k < remaining[v]; ++k)
+                {
+                    const std::uint32_t t = adjacency[firstTriangle[v] + k];
+                    if (triangleScores[t] > bestScore)
+                    {
+                        bestScore = triangleScores[t];
+                        best = t;
+                    }
+                }
+            }
+            if (nextCache.size() > cacheSize)
+            {
+                nextCache.resize(cacheSize);
+            }
+            std::swap(cache, nextCache);
+
+            if (best == triangleCount)
+            {
+                // Dead end: no cached vertex has triangles left, restart from the next triangle in input order
+                while (cursor < triangleCount && emitted[cursor])
+                {
+                    ++cursor;
+                }
+                best = cursor;
+            }
+        }
+        std::ranges::copy(output, indices.begin());
+    }
+
+    /**
+     * @brief Reorders the clusters of a cache-optimized triangle list to reduce overdraw.
+     *
+     * The list is split where the vertex cache restarts (a triangle with three cache misses), so
+     * moving clusters keeps the cache efficiency. Clusters are then sorted by how much they face away
+     * from the mesh centroid: outer surfaces are drawn first and occlude the inner ones.
+     *
+     * @param indices Triangle list, reordered in place. Run optimizeVertexCache first.
+     * @param positions Vertex positions, 3 floats per vertex.
+     * @param cacheSize Size of the FIFO cache used to find the cluster boundaries.
+     */
+    inline void optimizeOverdraw(std::span<std::uint32_t> indices, std::span<const float> positions, std::size_t cacheSize = 16)
+    {
+        const std::size_t vertexCount = positions.size() / 3;
+        detail::checkTriangles(indices, vertexCount);
+        const std::size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+        {
+            return;
+        }
+
+        // Split into clusters at cache restarts
+        std::vector<std::size_t> clusterStarts;
+        std::vector<std::size_t> insertedAt(vertexCount, 0);
+        std::size_t misses = 0;
+        for (std::size_t t = 0; t < triangleCount; ++t)
+        {
+            std::size_t triangleMisses = 0;
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const std::uint32_t index = indices[t * 3 + k];
+                if (insertedAt[index] == 0 || misses - insertedAt[index] >= cacheSize)
+                {
+                    ++misses;
+                    ++triangleMisses;
+                    insertedAt[index] = misses;
+                }
+            }
+            if (t == 0 || triangleMisses == 3)
+            {
+                clusterStarts.push_back(t);
+            }
+        }
+        clusterStarts.push_back(triangleCount);
+
+        auto position = [&positions](std::uint32_t index)
+        {
+            return std::array<float, 3>{positions[index * 3], positions[index * 3 + 1], positions[index * 3 + 2]};
+        };
+
+        std::array<float, 3> meshCenter{0.0f, 0.0f, 0.0f};
+        for (std::uint32_t index : indices)
+        {
+            const auto p = position(index);
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                meshCenter[c] += p[c] / static_cast<float>(indices.size());
+            }
+        }
+
+        const std::size_t clusterCount = clusterStarts.size() - 1;
+        std::vector<float> sortKeys(clusterCount);
+        for (std::size_t cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            // Area-weighted centroid and normal of the cluster
+            std::array<float, 3> center{0.0f, 0.0f, 0.0f};
+            std::array<float, 3> normal{0.0f, 0.0f, 0.0f};
+            float area = 0.0f;
+            for (std::size_t t = clusterStarts[cluster]; t < clusterStarts[cluster + 1]; ++t)
+            {
+                const auto a = position(indices[t * 3]);
+                const auto b = position(indices[t * 3 + 1]);
+                const auto c = position(indices[t * 3 + 2]);
+                const std::array<float, 3> ab{b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+                const std::array<float, 3> ac{c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+                const std::array<float, 3> cross{ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0]};
+                const float triangleArea = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    center[k] += (a[k] + b[k] + c[k]) / 3.0f * triangleArea;
+                    normal[k] += cross[k];
+                }
+                area += triangleArea;
+            }
+            const float normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            float key = 0.0f;
+            if (area > 0.0f && normalLength > 0.0f)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    key += (center[k] / area - meshCenter[k]) * normal[k] / normalLength;
+                }
+            }
+            sortKeys[cluster] = key;
+        }
+
+        std::vector<std::size_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&sortKeys](std::size_t lhs, std::size_t rhs)
+                                 { return sortKeys[lhs] > sortKeys[rhs]; });
+
+        std::vector<std::uint32_t> output;
+        output.reserve(indices.size());
+        for (std::size_t cluster : order)
+        {
+            output.insert(output.end(), indices.begin() + static_cast<std::ptrdiff_t>(clusterStarts[cluster] * 3), indices.begin() + static_cast<std::ptrdiff_t>(clusterStarts[cluster + 1] * 3));
+        }
+        std::ranges::copy(output, indices.begin());
+    }
+}
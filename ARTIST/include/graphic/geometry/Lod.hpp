@@ -0,0 +1,432 @@
+/**
+ * @file Lod.hpp
+ * @brief Import-time simplification of triangle lists into levels of detail, and their selection.
+ *
+ * `simplify` collapses edges in order of their quadric error (Garland-Heckbert): each vertex keeps
+ * the sum of the squared distances to the planes of its triangles, and an edge is collapsed onto the
+ * endpoint that moves the surface the least. Vertices are only merged into other existing vertices,
+ * so every level of detail indexes the vertices of the original mesh and only the indices differ.
+ *
+ * Border vertices and vertices split by attribute seams (same position, different attributes) are
+ * locked, so simplified levels keep the silhouette of open meshes and do not tear along UV seams.
+ *
+ * @code
+ * std::vector<geometry::LodLevel> chain = geometry::buildLodChain(indices, positions);
+ * mesh::LodMesh lods = mesh::uploadLodChain(chain, vertexCount, arena);
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/geometry/IndexOptimizer.hpp>
+
+namespace artist::graphic::geometry
+{
+    /**
+     * @struct Simplification
+     * @brief Indices of a simplified triangle list and the geometric error it introduced.
+     */
+    struct Simplification
+    {
+        std::vector<std::uint32_t> indices; ///< Triangle list over the vertices of the source mesh.
+        float error = 0.0f;                 ///< Largest collapse error, as a distance in mesh units.
+    };
+
+    /**
+     * @struct LodLevel
+     * @brief One level of a LOD chain.
+     */
+    struct LodLevel
+    {
+        std::vector<std::uint32_t> indices; ///< Triangle list over the vertices of the source mesh.
+        float error = 0.0f;                 ///< Distance to the source surface, in mesh units. 0 for the source itself.
+    };
+
+    /**
+     * @struct LodProjection
+     * @brief How object-space errors map to pixels for the current camera and viewport.
+     */
+    struct LodProjection
+    {
+        float pixelScale = 0.0f; ///< Pixels covered by one unit at a distance of one unit. 0 disables LOD selection.
+        float threshold = 1.0f;  ///< Largest error allowed on screen, in pixels.
+
+        /**
+         * @param verticalFov Vertical field of view, in radians.
+         * @param viewportHeight Height of the viewport, in pixels.
+         * @param threshold Largest error allowed on screen, in pixels.
+         */
+        static LodProjection perspective(float verticalFov, float viewportHeight, float threshold = 1.0f)
+        {
+            return {viewportHeight / (2.0f * std::tan(verticalFov * 0.5f)), threshold};
+        }
+
+        /**
+         * @brief Size on screen, in pixels, of an error seen from a distance.
+         */
+        [[nodiscard]] float project(float error, float distance) const
+        {
+            return error * pixelScale / std::max(distance, std::numeric_limits<float>::min());
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @struct Quadric
+         * @brief Symmetric 4x4 matrix summing squared distances to planes (a, b, c, d).
+         */
+        struct Quadric
+        {
+            double a2 = 0, b2 = 0, c2 = 0, ab = 0, ac = 0, bc = 0, ad = 0, bd = 0, cd = 0, d2 = 0;
+
+            void addPlane(double a, double b, double c, double d)
+            {
+                a2 += a * a;
+                b2 += b * b;
+                c2 += c * c;
+                ab += a * b;
+                ac += a * c;
+                bc += b * c;
+                ad += a * d;
+                bd += b * d;
+                cd += c * d;
+                d2 += d * d;
+            }
+
+            Quadric &operator+=(const Quadric &other)
+            {
+                a2 += other.a2;
+                b2 += other.b2;
+                c2 += other.c2;
+                ab += other.ab;
+                ac += other.ac;
+                bc += other.bc;
+                ad += other.ad;
+                bd += other.bd;
+                cd += other.cd;
+                d2 += other.d2;
+                return *this;
+            }
+
+            /**
+             * @brief Sum of the squared distances from a point to the planes.
+             */
+            [[nodiscard]] double evaluate(const std::array<float, 3> &p) const
+            {
+                const double x = p[0], y = p[1], z = p[2];
+                const double value = x * x * a2 + y * y * b2 + z * z * c2 + 2.0 * (x * y * ab + x * z * ac + y * z * bc) + 2.0 * (x * ad + y * bd + z * cd) + d2;
+                return std::max(value, 0.0);
+            }
+        };
+
+        /**
+         * @brief Normal of a triangle, not normalized.
+         */
+        inline std::array<double, 3> triangleNormal(const std::array<float, 3> &a, const std::array<float, 3> &b, const std::array<float, 3> &c)
+        {
+            const double ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+            const double vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+            return {uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx};
+        }
+
+        inline std::uint64_t edgeKey(std::uint32_t a, std::uint32_t b)
+        {
+            return a < b ? (static_cast<std::uint64_t>(a) << 32) | b : (static_cast<std::uint64_t>(b) << 32) | a;
+        }
+
+        /**
+         * @brief Marks the vertices that must not move: mesh borders and attribute seams.
+         */
+        inline std::vector<bool> findLockedVertices(std::span<const std::uint32_t> indices, std::span<const float> positions)
+        {
+            const std::size_t vertexCount = positions.size() / 3;
+            std::vector<bool> locked(vertexCount, false);
+
+            // Vertices sharing a position with another one sit on a seam
+            std::unordered_multimap<std::uint64_t, std::uint32_t> firstAtPosition;
+            std::vector<std::uint32_t> canonical(vertexCount);
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                const std::uint64_t hash = (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(positions[v * 3])) * 73856093u) ^
+                                           (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(positions[v * 3 + 1])) * 19349663u) ^
+                                           (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(positions[v * 3 + 2])) * 83492791u);
+                canonical[v] = v;
+                for (auto [it, end] = firstAtPosition.equal_range(hash); it != end; ++it)
+                {
+                    const std::uint32_t other = it->second;
+                    if (positions[other * 3] == positions[v * 3] && positions[other * 3 + 1] == positions[v * 3 + 1] && positions[other * 3 + 2] == positions[v * 3 + 2])
+                    {
+                        canonical[v] = other;
+                        locked[v] = locked[other] = true;
+                        break;
+                    }
+                }
+                if (canonical[v] == v)
+                {
+                    firstAtPosition.emplace(hash, v);
+                }
+            }
+
+            // Edges used by a single triangle are on the border, once seams are welded
+            std::unordered_map<std::uint64_t, std::uint32_t> edgeUses;
+            edgeUses.reserve(indices.size());
+            for (std::size_t t = 0; t < indices.size(); t += 3)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    ++edgeUses[edgeKey(canonical[indices[t + k]], canonical[indices[t + (k + 1) % 3]])];
+                }
+            }
+            for (std::size_t t = 0; t < indices.size(); t += 3)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    const std::uint32_t a = indices[t + k];
+                    const std::uint32_t b = indices[t + (k + 1) % 3];
+                    if (edgeUses[edgeKey(canonical[a], canonical[b])] == 1)
+                    {
+                        locked[a] = locked[b] = true;
+                    }
+                }
+            }
+            return locked;
+        }
+    }
+
+    /**
+     * @brief Reduces a triangle list by collapsing edges, within an error budget.
+     *
+     * Collapses stop once the index count reaches targetIndexCount, or when the next collapse would
+     * move the surface by more than targetError. The result is never larger than the input.
+     *
+     * @param indices Triangle list.
+     * @param positions Vertex positions, 3 floats per vertex.
+     * @param targetIndexCount Index count to reach.
+     * @param targetError Largest distance the surface may move, in mesh units.
+     * @throws common::exception::TraceableException If the indices are not a triangle list of the vertices.
+     */
+    inline Simplification simplify(std::span<const std::uint32_t> indices, std::span<const float> positions, std::size_t targetIndexCount, float targetError = std::numeric_limits<float>::max())
+    {
+        const std::size_t vertexCount = positions.size() / 3;
+        detail::checkTriangles(indices, vertexCount);
+        auto position = [&positions](std::uint32_t v)
+        {
+            return std::array<float, 3>{positions[v * 3], positions[v * 3 + 1], positions[v * 3 + 2]};
+        };
+
+        Simplification result;
+        result.indices.assign(indices.begin(), indices.end());
+        const std::vector<bool> locked = detail::findLockedVertices(indices, positions);
+
+        std::vector<detail::Quadric> quadrics(vertexCount);
+        for (std::size_t t = 0; t < indices.size(); t += 3)
+        {
+            const auto a = position(indices[t]);
+            const auto normal = detail::triangleNormal(a, position(indices[t + 1]), position(indices[t + 2]));
+            const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            if (length == 0.0)
+            {
+                continue;
+            }
+            const double nx = normal[0] / length, ny = normal[1] / length, nz = normal[2] / length;
+            const double d = -(nx * a[0] + ny * a[1] + nz * a[2]);
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                quadrics[indices[t + k]].addPlane(nx, ny, nz, d);
+            }
+        }
+
+        struct Collapse
+        {
+            std::uint32_t from;
+            std::uint32_t to;
+            double cost;
+        };
+        const double maxCost = static_cast<double>(targetError) * targetError;
+        double worstCost = 0.0;
+        std::vector<std::uint32_t> firstTriangle(vertexCount + 1);
+        std::vector<std::uint32_t> adjacency;
+        std::vector<std::uint64_t> edges;
+        std::vector<Collapse> collapses;
+        std::vector<std::uint32_t> remap(vertexCount);
+        std::vector<bool> touched(vertexCount);
+
+        // Each pass collapses a set of independent edges, cheapest first, then rewrites the indices
+        while (result.indices.size() > targetIndexCount)
+        {
+            const std::vector<std::uint32_t> &current = result.indices;
+
+            // Triangles around each vertex, as offsets into adjacency
+            std::ranges::fill(firstTriangle, 0);
+            for (std::uint32_t index : current)
+            {
+                ++firstTriangle[index + 1];
+            }
+            for (std::size_t v = 0; v < vertexCount; ++v)
+            {
+                firstTriangle[v + 1] += firstTriangle[v];
+            }
+            adjacency.assign(current.size(), 0);
+            std::vector<std::uint32_t> fill(firstTriangle.begin(), firstTriangle.end() - 1);
+            for (std::size_t i = 0; i < current.size(); ++i)
+            {
+                adjacency[fill[current[i]]++] = static_cast<std::uint32_t>(i / 3);
+            }
+
+            edges.clear();
+            for (std::size_t t = 0; t < current.size(); t += 3)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    edges.push_back(detail::edgeKey(current[t + k], current[t + (k + 1) % 3]));
+                }
+            }
+            std::ranges::sort(edges);
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+            collapses.clear();
+            for (std::uint64_t edge : edges)
+            {
+                const auto a = static_cast<std::uint32_t>(edge >> 32);
+                const auto b = static_cast<std::uint32_t>(edge);
+                detail::Quadric merged = quadrics[a];
+                merged += quadrics[b];
+                const double toB = locked[a] ? std::numeric_limits<double>::infinity() : merged.evaluate(position(b));
+                const double toA = locked[b] ? std::numeric_limits<double>::infinity() : merged.evaluate(position(a));
+                if (std::min(toA, toB) <= maxCost)
+                {
+                    collapses.push_back(toB <= toA ? Collapse{a, b, toB} : Collapse{b, a, toA});
+                }
+            }
+            std::ranges::sort(collapses, {}, &Collapse::cost);
+
+            // Moving from onto to must not flip any triangle that survives the collapse
+            auto flips = [&](const Collapse &collapse)
+            {
+                for (std::uint32_t i = firstTriangle[collapse.from]; i < firstTriangle[collapse.from + 1]; ++i)
+                {
+                    const std::size_t t = adjacency[i] * std::size_t{3};
+                    std::array<std::uint32_t, 3> corners{current[t], current[t + 1], current[t + 2]};
+                    if (std::ranges::find(corners, collapse.to) != corners.end())
+                    {
+                        continue; // Degenerates and disappears
+                    }
+                    const auto before = detail::triangleNormal(position(corners[0]), position(corners[1]), position(corners[2]));
+                    std::ranges::replace(corners, collapse.from, collapse.to);
+                    const auto after = detail::triangleNormal(position(corners[0]), position(corners[1]), position(corners[2]));
+                    if (before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0.0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                remap[v] = v;
+            }
+            std::fill(touched.begin(), touched.end(), false);
+            std::size_t triangleCount = current.size() / 3;
+            const std::size_t targetTriangles = targetIndexCount / 3;
+            bool collapsed = false;
+            for (const Collapse &collapse : collapses)
+            {
+                if (triangleCount <= targetTriangles)
+                {
+                    break;
+                }
+                if (touched[collapse.from] || touched[collapse.to] || flips(collapse))
+                {
+                    continue;
+                }
+                // The triangles around from change shape: their vertices wait for the next pass
+                for (std::uint32_t i = firstTriangle[collapse.from]; i < firstTriangle[collapse.from + 1]; ++i)
+                {
+                    const std::size_t t = adjacency[i] * std::size_t{3};
+                    const bool removed = current[t] == collapse.to || current[t + 1] == collapse.to || current[t + 2] == collapse.to;
+                    triangleCount -= removed ? 1 : 0;
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        touched[current[t + k]] = true;
+                    }
+                }
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to] += quadrics[collapse.from];
+                worstCost = std::max(worstCost, collapse.cost);
+                collapsed = true;
+            }
+            if (!collapsed)
+            {
+                break;
+            }
+
+            std::vector<std::uint32_t> next;
+            next.reserve(triangleCount * 3);
+            for (std::size_t t = 0; t < current.size(); t += 3)
+            {
+                const std::uint32_t a = remap[current[t]];
+                const std::uint32_t b = remap[current[t + 1]];
+                const std::uint32_t c = remap[current[t + 2]];
+                if (a != b && b != c && a != c)
+                {
+                    next.insert(next.end(), {a, b, c});
+                }
+            }
+            result.indices = std::move(next);
+        }
+        result.error = static_cast<float>(std::sqrt(worstCost));
+        return result;
+    }
+
+    /**
+     * @brief Builds a chain of levels of detail, each simplified from the previous one.
+     *
+     * The chain starts with the source triangles. It stops after maxLevels levels, or as soon as a
+     * level cannot be reduced by at least a tenth without exceeding maxError.
+     *
+     * @param indices Triangle list.
+     * @param positions Vertex positions, 3 floats per vertex.
+     * @param maxLevels Maximum number of levels, source included.
+     * @param reduction Index count of each level relative to the previous one, in (0, 1).
+     * @param maxError Largest distance from the source surface, in mesh units.
+     * @throws common::exception::TraceableException If the indices are not a triangle list of the
+     *         vertices, or the reduction is not in (0, 1).
+     */
+    inline std::vector<LodLevel> buildLodChain(std::span<const std::uint32_t> indices, std::span<const float> positions, std::size_t maxLevels = 4, float reduction = 0.5f, float maxError = std::numeric_limits<float>::max())
+    {
+        if (!(reduction > 0.0f && reduction < 1.0f))
+        {
+            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::GEOMETRY::INVALID_LOD_REDUCTION: {}", reduction));
+        }
+        detail::checkTriangles(indices, positions.size() / 3);
+        std::vector<LodLevel> chain;
+        chain.push_back({std::vector<std::uint32_t>(indices.begin(), indices.end()), 0.0f});
+        while (chain.size() < maxLevels)
+        {
+            const LodLevel &previous = chain.back();
+            const std::size_t target = static_cast<std::size_t>(static_cast<float>(previous.indices.size() / 3) * reduction) * 3;
+            // Errors of successive simplifications add up, as each one starts from an already moved surface
+            Simplification simplified = simplify(previous.indices, positions, target, maxError - previous.error);
+            if (simplified.indices.empty() || simplified.indices.size() * 10 > previous.indices.size() * 9)
+            {
+                break;
+            }
+            chain.push_back({std::move(simplified.indices), previous.error + simplified.error});
+        }
+        return chain;
+    }
+}
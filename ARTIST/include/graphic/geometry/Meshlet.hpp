@@ -0,0 +1,240 @@
+/**
+ * @file Meshlet.hpp
+ * @brief Import-time split of triangle lists into small clusters with culling bounds.
+ *
+ * Large meshes are mostly off-screen or facing away from the camera, yet drawn as a whole. Split
+ * into meshlets of a bounded number of vertices and triangles, each with a bounding sphere and a
+ * cone containing the normals of its triangles, they can be culled cluster by cluster: a meshlet
+ * is skipped when its sphere is outside the frustum or when the camera is behind every triangle
+ * of its cone.
+ *
+ * @code
+ * geometry::optimizeVertexCache(indices, vertexCount);
+ * geometry::MeshletSet meshlets = geometry::buildMeshlets(indices, positions);
+ * clusterBuffer.set(meshlets, vertexCount);
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/geometry/Frustum.hpp>
+#include <graphic/geometry/IndexOptimizer.hpp>
+
+namespace artist::graphic::geometry
+{
+    /**
+     * @struct Meshlet
+     * @brief A cluster of triangles, contiguous in the index list of its MeshletSet.
+     */
+    struct Meshlet
+    {
+        std::uint32_t firstIndex = 0;      ///< First index of the cluster.
+        std::uint32_t indexCount = 0;      ///< Number of indices, three per triangle.
+        std::uint32_t vertexCount = 0;     ///< Number of distinct vertices referenced.
+        std::array<float, 3> center{};     ///< Center of the bounding sphere.
+        float radius = 0.0f;               ///< Radius of the bounding sphere.
+        std::array<float, 3> coneApex{};   ///< Apex of the normal cone.
+        std::array<float, 3> coneAxis{};   ///< Average normal of the triangles, normalized.
+        float coneCutoff = 1.0f;           ///< Sine of the cone spread. 1 when the cone cannot cull.
+    };
+
+    /**
+     * @struct MeshletSet
+     * @brief Meshlets of a mesh and the triangle list they are ranges of.
+     */
+    struct MeshletSet
+    {
+        std::vector<Meshlet> meshlets;      ///< Clusters, in index order.
+        std::vector<std::uint32_t> indices; ///< Triangle list of the mesh, meshlet after meshlet.
+    };
+
+    namespace detail
+    {
+        using Vector3 = std::array<float, 3>;
+
+        inline Vector3 subtract(const Vector3 &a, const Vector3 &b)
+        {
+            return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+        }
+
+        inline float dot(const Vector3 &a, const Vector3 &b)
+        {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        inline Vector3 cross(const Vector3 &a, const Vector3 &b)
+        {
+            return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+        }
+
+        inline Vector3 normalize(const Vector3 &v)
+        {
+            const float length = std::sqrt(dot(v, v));
+            return length > 0.0f ? Vector3{v[0] / length, v[1] / length, v[2] / length} : Vector3{0.0f, 0.0f, 0.0f};
+        }
+
+        /**
+         * @brief Computes the bounding sphere and normal cone of the triangles of a meshlet.
+         */
+        inline void computeBounds(Meshlet &meshlet, std::span<const std::uint32_t> indices, std::span<const float> positions)
+        {
+            auto position = [&positions](std::uint32_t index)
+            {
+                return Vector3{positions[index * 3], positions[index * 3 + 1], positions[index * 3 + 2]};
+            };
+            std::span<const std::uint32_t> triangles = indices.subspan(meshlet.firstIndex, meshlet.indexCount);
+
+            // Sphere around the center of the bounding box: not minimal, but tight enough for small clusters
+            Vector3 low{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+            Vector3 high{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+            for (std::uint32_t index : triangles)
+            {
+                const Vector3 p = position(index);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    low[k] = std::min(low[k], p[k]);
+                    high[k] = std::max(high[k], p[k]);
+                }
+            }
+            meshlet.center = {(low[0] + high[0]) * 0.5f, (low[1] + high[1]) * 0.5f, (low[2] + high[2]) * 0.5f};
+            float radiusSquared = 0.0f;
+            for (std::uint32_t index : triangles)
+            {
+                const Vector3 offset = subtract(position(index), meshlet.center);
+                radiusSquared = std::max(radiusSquared, dot(offset, offset));
+            }
+            meshlet.radius = std::sqrt(radiusSquared);
+
+            // Normal cone: average normal, and the widest angle between it and a triangle normal
+            std::vector<std::array<Vector3, 2>> planes; // Corner and unit normal of each triangle
+            planes.reserve(triangles.size() / 3);
+            Vector3 sum{0.0f, 0.0f, 0.0f};
+            for (std::size_t t = 0; t < triangles.size(); t += 3)
+            {
+                const Vector3 a = position(triangles[t]);
+                const Vector3 normal = normalize(cross(subtract(position(triangles[t + 1]), a), subtract(position(triangles[t + 2]), a)));
+                if (dot(normal, normal) == 0.0f)
+                {
+                    continue; // Degenerate triangle, invisible from anywhere
+                }
+                planes.push_back({a, normal});
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    sum[k] += normal[k];
+                }
+            }
+            meshlet.coneAxis = normalize(sum);
+            meshlet.coneApex = meshlet.center;
+            meshlet.coneCutoff = 1.0f;
+            float minimumDot = 1.0f;
+            for (const auto &[corner, normal] : planes)
+            {
+                minimumDot = std::min(minimumDot, dot(meshlet.coneAxis, normal));
+            }
+            // Below ~84 degrees of spread the cone rejects too few views to be worth testing
+            if (planes.empty() || minimumDot <= 0.1f)
+            {
+                return;
+            }
+            meshlet.coneCutoff = std::sqrt(1.0f - minimumDot * minimumDot);
+
+            // Move the apex back along the axis until it is behind every triangle plane
+            float distance = 0.0f;
+            for (const auto &[corner, normal] : planes)
+            {
+                distance = std::max(distance, dot(subtract(meshlet.center, corner), normal) / dot(meshlet.coneAxis, normal));
+            }
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                meshlet.coneApex[k] = meshlet.center[k] - meshlet.coneAxis[k] * distance;
+            }
+        }
+    }
+
+    /**
+     * @brief Groups consecutive triangles into meshlets and computes their culling bounds.
+     *
+     * Triangles are taken in index order, so run optimizeVertexCache first: its ordering keeps
+     * neighbouring triangles together, which makes the meshlets compact.
+     *
+     * @param indices Triangle list.
+     * @param positions Vertex positions, 3 floats per vertex.
+     * @param maxVertices Maximum number of distinct vertices per meshlet, at least 3.
+     * @param maxTriangles Maximum number of triangles per meshlet, at least 1.
+     * @throws common::exception::TraceableException If the indices are not a triangle list of the
+     *         vertices, or the limits cannot hold one triangle.
+     */
+    inline MeshletSet buildMeshlets(std::span<const std::uint32_t> indices, std::span<const float> positions, std::size_t maxVertices = 64, std::size_t maxTriangles = 124)
+    {
+        const std::size_t vertexCount = positions.size() / 3;
+        detail::checkTriangles(indices, vertexCount);
+        if (maxVertices < 3 || maxTriangles < 1)
+        {
+            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::GEOMETRY::INVALID_MESHLET_LIMITS: {} vertices, {} triangles", maxVertices, maxTriangles));
+        }
+
+        MeshletSet set;
+        set.indices.assign(indices.begin(), indices.end());
+        // Meshlet each vertex was last counted in, offset by one so that 0 means never
+        std::vector<std::uint32_t> lastMeshlet(vertexCount, 0);
+        Meshlet current;
+        for (std::size_t t = 0; t < indices.size(); t += 3)
+        {
+            const std::uint32_t a = indices[t];
+            const std::uint32_t b = indices[t + 1];
+            const std::uint32_t c = indices[t + 2];
+            auto stamp = static_cast<std::uint32_t>(set.meshlets.size() + 1);
+            const std::size_t newVertices = (lastMeshlet[a] != stamp) + (lastMeshlet[b] != stamp && b != a) + (lastMeshlet[c] != stamp && c != a && c != b);
+            if (current.indexCount != 0 && (current.vertexCount + newVertices > maxVertices || current.indexCount / 3 == maxTriangles))
+            {
+                set.meshlets.push_back(current);
+                current = Meshlet{};
+                current.firstIndex = static_cast<std::uint32_t>(t);
+                ++stamp;
+            }
+            for (std::uint32_t index : {a, b, c})
+            {
+                if (lastMeshlet[index] != stamp)
+                {
+                    lastMeshlet[index] = stamp;
+                    ++current.vertexCount;
+                }
+            }
+            current.indexCount += 3;
+        }
+        if (current.indexCount != 0)
+        {
+            set.meshlets.push_back(current);
+        }
+        for (Meshlet &meshlet : set.meshlets)
+        {
+            detail::computeBounds(meshlet, set.indices, positions);
+        }
+        return set;
+    }
+
+    /**
+     * @brief Checks whether a meshlet may be visible: inside the frustum and not entirely back-facing.
+     *
+     * The frustum and the camera position are in the object space of the mesh.
+     */
+    inline bool isMeshletVisible(const Meshlet &meshlet, const Frustum &frustum, const std::array<float, 3> &camera)
+    {
+        if (!frustum.intersectsSphere(meshlet.center, meshlet.radius))
+        {
+            return false;
+        }
+        const auto view = detail::normalize(detail::subtract(meshlet.coneApex, camera));
+        return meshlet.coneCutoff >= 1.0f || detail::dot(view, meshlet.coneAxis) < meshlet.coneCutoff;
+    }
+}
@@ -0,0 +1,24 @@
+/**
+ * @file BufferAllocation.hpp
+ * @brief A range of an OpenGL buffer owned by one attribute or index array.
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @struct BufferAllocation
+     * @brief Location of data inside a shared buffer object.
+     *
+     * The location may change when the owning arena compacts its buffers, so users read it on each use.
+     */
+    struct BufferAllocation
+    {
+        GLuint bufferId = 0; ///< Buffer holding the data, 0 once released.
+        GLintptr offset = 0; ///< Byte offset of the data in the buffer.
+        GLsizeiptr size = 0; ///< Number of bytes reserved for the data.
+    };
+}
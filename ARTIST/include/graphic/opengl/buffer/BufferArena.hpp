@@ -0,0 +1,238 @@
+/**
+ * @file BufferArena.hpp
+ * @brief Sub-allocation of many small vertex and index ranges out of a few large buffers.
+ *
+ * Giving each attribute its own buffer object means one glGenBuffers and one bind per attribute.
+ * The arena instead allocates large pages and hands out (buffer, offset, size) ranges inside them,
+ * so thousands of small meshes share a handful of buffer objects, which keeps binds down and lets
+ * draws be batched with multi-draw calls.
+ *
+ * @code
+ * BufferArena arena;
+ * auto allocation = arena.allocate(positions.size_bytes());
+ * positionAttribute->getContext()->setAllocation(allocation);
+ * positionAttribute->bind();
+ * positionAttribute->set<glm::vec3>(positions);
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <common/memory/OffsetAllocator.hpp>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @class BufferArena
+     * @brief Allocates ranges of large OpenGL buffers, with compaction of fragmented pages.
+     *
+     * Allocations are shared with their users: when compaction moves an allocation to another
+     * buffer or offset, the users see the new location on their next use. Pages are deleted through
+     * BufferNames, so that the vertex array objects still reading a moved allocation from its former
+     * buffer are evicted before that buffer's name is handed out again.
+     *
+     * Live allocations are indexed by buffer and offset: freeing one is a lookup, and the allocations
+     * of a page are a contiguous, offset-ordered run of the index.
+     */
+    class BufferArena
+    {
+    public:
+        static constexpr GLsizeiptr DEFAULT_PAGE_SIZE = 4 * 1024 * 1024;
+
+        /**
+         * @param pageSize Size of each buffer object. Larger allocations get a dedicated page.
+         * @param alignment Alignment of every allocation offset, in bytes. Must be a power of two.
+         * @param usage Usage hint of the buffer objects.
+         */
+        explicit BufferArena(GLsizeiptr pageSize = DEFAULT_PAGE_SIZE, GLsizeiptr alignment = 16, GLenum usage = GL_STATIC_DRAW)
+            : m_pageSize(pageSize), m_alignment(alignment), m_usage(usage)
+        {
+            if (pageSize <= 0 || alignment <= 0 || (alignment & (alignment - 1)) != 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::BUFFER_ARENA::INVALID_LAYOUT: page size {}, alignment {}", pageSize, alignment));
+            }
+        }
+
+        BufferArena(const BufferArena &) = delete;
+        BufferArena &operator=(const BufferArena &) = delete;
+
+        ~BufferArena()
+        {
+            for (const auto &page : m_pages)
+            {
+                BufferNames::release(page.bufferId);
+            }
+        }
+
+        /**
+         * @brief Allocates a range of at least size bytes.
+         */
+        std::shared_ptr<BufferAllocation> allocate(GLsizeiptr size)
+        {
+            if (size <= 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::BUFFER_ARENA::EMPTY_ALLOCATION");
+            }
+            const auto alignedSize = alignUp(size);
+            for (std::size_t i = 0; i < m_pages.size(); ++i)
+            {
+                if (auto offset = m_pages[i].allocator.allocate(alignedSize))
+                {
+                    return track(i, static_cast<GLintptr>(*offset), size);
+                }
+            }
+            std::size_t page = addPage(std::max(m_pageSize, alignedSize));
+            return track(page, static_cast<GLintptr>(*m_pages[page].allocator.allocate(alignedSize)), size);
+        }
+
+        /**
+         * @brief Releases an allocation. Its range may be handed out again.
+         */
+        void free(const std::shared_ptr<BufferAllocation> &allocation)
+        {
+            auto it = allocation ? m_allocations.find({allocation->bufferId, allocation->offset}) : m_allocations.end();
+            if (it == m_allocations.end() || it->second != allocation)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::BUFFER_ARENA::UNKNOWN_ALLOCATION");
+            }
+            Page &page = pageOf(*allocation);
+            page.allocator.free(allocation->offset, alignUp(allocation->size));
+            m_allocations.erase(it);
+            allocation->bufferId = 0;
+        }
+
+        /**
+         * @brief Packs the live allocations of fragmented pages and releases empty pages.
+         *
+         * Each fragmented page is copied into a new buffer with glCopyBufferSubData, its allocations
+         * laid out back to back, and the old buffer is released. Allocations are updated in place.
+         *
+         * @return The number of relocated allocations.
+         */
+        std::size_t compact()
+        {
+            std::size_t moved = 0;
+            for (std::size_t i = 0; i < m_pages.size();)
+            {
+                Page &page = m_pages[i];
+                if (page.allocator.getFreeSize() == page.allocator.getCapacity())
+                {
+                    BufferNames::release(page.bufferId);
+                    m_pages.erase(m_pages.begin() + static_cast<std::ptrdiff_t>(i));
+                    continue;
+                }
+                if (page.allocator.getFreeBlockCount() > 1)
+                {
+                    moved += repack(page);
+                }
+                ++i;
+            }
+            return moved;
+        }
+
+        [[nodiscard]] std::size_t getPageCount() const
+        {
+            return m_pages.size();
+        }
+
+        [[nodiscard]] std::size_t getAllocationCount() const
+        {
+            return m_allocations.size();
+        }
+
+    private:
+        using AllocationKey = std::pair<GLuint, GLintptr>; ///< Buffer ID and offset of an allocation.
+
+        struct Page
+        {
+            GLuint bufferId;                           ///< OpenGL buffer ID
+            common::memory::OffsetAllocator allocator; ///< Free ranges of the buffer.
+        };
+
+        GLsizeiptr alignUp(GLsizeiptr size) const
+        {
+            return (size + m_alignment - 1) & ~(m_alignment - 1);
+        }
+
+        GLuint createBuffer(GLsizeiptr size) const
+        {
+            GLuint bufferId = 0;
+            glGenBuffers(1, &bufferId);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, bufferId);
+            glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, m_usage);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            return bufferId;
+        }
+
+        std::size_t addPage(GLsizeiptr size)
+        {
+            m_pages.push_back({createBuffer(size), common::memory::OffsetAllocator(static_cast<std::size_t>(size))});
+            return m_pages.size() - 1;
+        }
+
+        Page &pageOf(const BufferAllocation &allocation)
+        {
+            auto page = std::ranges::find(m_pages, allocation.bufferId, &Page::bufferId);
+            if (page == m_pages.end())
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::BUFFER_ARENA::UNKNOWN_BUFFER");
+            }
+            return *page;
+        }
+
+        std::shared_ptr<BufferAllocation> track(std::size_t page, GLintptr offset, GLsizeiptr size)
+        {
+            auto allocation = std::make_shared<BufferAllocation>(BufferAllocation{m_pages[page].bufferId, offset, size});
+            m_allocations.emplace(AllocationKey{allocation->bufferId, offset}, allocation);
+            return allocation;
+        }
+
+        std::size_t repack(Page &page)
+        {
+            // The allocations of the page, already sorted by offset, are re-indexed under their new location
+            std::vector<decltype(m_allocations)::node_type> live;
+            for (auto it = m_allocations.lower_bound({page.bufferId, 0}); it != m_allocations.end() && it->first.first == page.bufferId;)
+            {
+                live.push_back(m_allocations.extract(it++));
+            }
+
+            const auto capacity = static_cast<GLsizeiptr>(page.allocator.getCapacity());
+            GLuint bufferId = createBuffer(capacity);
+            glBindBuffer(GL_COPY_READ_BUFFER, page.bufferId);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, bufferId);
+            page.allocator.reset();
+            for (auto &node : live)
+            {
+                BufferAllocation &allocation = *node.mapped();
+                const auto offset = static_cast<GLintptr>(*page.allocator.allocate(alignUp(allocation.size)));
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, allocation.offset, offset, allocation.size);
+                allocation.bufferId = bufferId;
+                allocation.offset = offset;
+                node.key() = {bufferId, offset};
+                m_allocations.insert(std::move(node));
+            }
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            BufferNames::release(page.bufferId);
+            page.bufferId = bufferId;
+            return live.size();
+        }
+
+        GLsizeiptr m_pageSize;                                                   ///< Size of a regular page.
+        GLsizeiptr m_alignment;                                                  ///< Alignment of allocation offsets.
+        GLenum m_usage;                                                          ///< Usage hint of the pages.
+        std::vector<Page> m_pages;                                               ///< Buffer objects carved by the arena.
+        std::map<AllocationKey, std::shared_ptr<BufferAllocation>> m_allocations; ///< Live allocations, by buffer and offset.
+    };
+}
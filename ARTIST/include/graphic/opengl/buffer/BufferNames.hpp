@@ -0,0 +1,104 @@
+/**
+ * @file BufferNames.hpp
+ * @brief Deletion of vertex and index buffers, logged for the caches that know buffers by name.
+ *
+ * OpenGL recycles the name of a deleted buffer: the next glGenBuffers may hand it back for an
+ * unrelated buffer. A cache keyed by buffer name, such as the vertex array objects of a pass, would
+ * then hit an entry recorded for the deleted buffer, whose vertex array object still points at the
+ * freed data store. Buffers that a vertex array object may capture are therefore deleted through
+ * BufferNames::release, which logs their name under a new epoch. A cache remembers the epoch it last
+ * caught up with; on its next use, it evicts the entries naming a buffer released since. Checking
+ * for releases costs one comparison, and eviction happens before the name can be generated again.
+ *
+ * Releases are logged on the GL thread, like every other buffer call.
+ *
+ * @code
+ * BufferNames::release(bufferId);
+ * // on the next use of a cache:
+ * if (cacheEpoch != BufferNames::getEpoch())
+ * {
+ *     if (auto released = BufferNames::getReleasedSince(cacheEpoch)) { evict(*released); }
+ *     else { evictAll(); }
+ *     cacheEpoch = BufferNames::getEpoch();
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @class BufferNames
+     * @brief Log of the buffer names released so far.
+     *
+     * The log keeps the last LOG_SIZE releases at least: a cache further behind than that evicts
+     * all of its entries.
+     */
+    class BufferNames
+    {
+    public:
+        static constexpr std::size_t LOG_SIZE = 1024;
+
+        /**
+         * @brief Deletes a buffer and logs its name. Deleting name 0 does nothing.
+         */
+        static void release(GLuint bufferId)
+        {
+            if (bufferId == 0)
+            {
+                return;
+            }
+            glDeleteBuffers(1, &bufferId);
+            Log &log = getLog();
+            if (log.released.size() == 2 * LOG_SIZE)
+            {
+                log.released.erase(log.released.begin(), log.released.begin() + LOG_SIZE);
+                log.firstEpoch += LOG_SIZE;
+            }
+            log.released.push_back(bufferId);
+        }
+
+        /**
+         * @return The number of releases so far.
+         */
+        [[nodiscard]] static std::uint64_t getEpoch()
+        {
+            const Log &log = getLog();
+            return log.firstEpoch + log.released.size();
+        }
+
+        /**
+         * @return The names released since the given epoch, or nothing if the log no longer goes back that far.
+         */
+        [[nodiscard]] static std::optional<std::span<const GLuint>> getReleasedSince(std::uint64_t epoch)
+        {
+            const Log &log = getLog();
+            if (epoch < log.firstEpoch)
+            {
+                return std::nullopt;
+            }
+            return std::span<const GLuint>(log.released).subspan(static_cast<std::size_t>(epoch - log.firstEpoch));
+        }
+
+    private:
+        struct Log
+        {
+            std::vector<GLuint> released;    ///< Names released since firstEpoch, oldest first.
+            std::uint64_t firstEpoch = 0;    ///< Epoch of the first logged release.
+        };
+
+        static Log &getLog()
+        {
+            static Log log;
+            return log;
+        }
+    };
+}
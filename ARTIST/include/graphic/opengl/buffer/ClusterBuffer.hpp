@@ -0,0 +1,178 @@
+/**
+ * @file ClusterBuffer.hpp
+ * @brief Indices of a meshlet-split mesh, drawn through indirect draws of the visible clusters only.
+ *
+ * The buffer keeps the meshlets of a mesh next to its index buffer. Each frame, the culling stage
+ * tests the meshlet bounds against the frustum and the camera on the CPU and writes one
+ * DrawElementsIndirectCommand per run of consecutive visible meshlets into a GL_DRAW_INDIRECT_BUFFER;
+ * a single glMultiDrawElementsIndirect then draws them. Culled clusters cost no vertex work at all,
+ * which matters most on software rasterizers.
+ *
+ * @code
+ * auto clusters = std::make_shared<ClusterBuffer>();
+ * clusters->set(geometry::buildMeshlets(indices, positions), vertexCount);
+ * passContext->setIndexBuffer(clusters->getIndexBuffer());
+ * // each frame:
+ * clusters->cull(geometry::Frustum::fromMatrix(std::span<const float, 16>(glm::value_ptr(modelViewProjection), 16)), cameraInModelSpace);
+ * pass->use();
+ * clusters->draw();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <graphic/geometry/Frustum.hpp>
+#include <graphic/geometry/Meshlet.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/IndexBuffer.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @struct DrawElementsIndirectCommand
+     * @brief Parameters of one indexed draw, as read by glMultiDrawElementsIndirect.
+     */
+    struct DrawElementsIndirectCommand
+    {
+        GLuint count;         ///< Number of indices.
+        GLuint instanceCount; ///< Number of instances.
+        GLuint firstIndex;    ///< First index, counted in indices from the start of the element buffer.
+        GLint baseVertex;     ///< Value added to every index.
+        GLuint baseInstance;  ///< First instance.
+    };
+
+    /**
+     * @class ClusterBuffer
+     * @brief Meshlets, their indices and the indirect draws of the meshlets that passed culling.
+     */
+    class ClusterBuffer
+    {
+    public:
+        ClusterBuffer() = default;
+        ClusterBuffer(const ClusterBuffer &) = delete;
+        ClusterBuffer &operator=(const ClusterBuffer &) = delete;
+
+        ~ClusterBuffer()
+        {
+            if (m_indirectBufferId != 0)
+            {
+                glDeleteBuffers(1, &m_indirectBufferId);
+            }
+        }
+
+        /**
+         * @brief Stores the indices in a range of a shared buffer instead of a buffer of their own.
+         */
+        void setAllocation(std::shared_ptr<BufferAllocation> allocation)
+        {
+            m_indices->setAllocation(std::move(allocation));
+        }
+
+        /**
+         * @brief Uploads the indices of the meshlets and keeps their bounds for culling.
+         * @throws common::exception::TraceableException If an index is not below vertexCount.
+         */
+        void set(const geometry::MeshletSet &meshlets, std::size_t vertexCount)
+        {
+            m_indices->set(meshlets.indices, vertexCount);
+            m_meshlets = meshlets.meshlets;
+            m_commands.clear();
+            m_commands.reserve(m_meshlets.size());
+        }
+
+        /**
+         * @brief Selects the meshlets that may be visible and uploads their draws.
+         *
+         * The frustum and the camera position are in the object space of the mesh.
+         *
+         * @return The number of visible meshlets.
+         */
+        std::size_t cull(const geometry::Frustum &frustum, const std::array<float, 3> &camera)
+        {
+            // Indirect draws count indices from the start of the element buffer, not from the allocation
+            const GLuint indexSize = m_indices->getIndexType() == GL_UNSIGNED_SHORT ? 2 : 4;
+            const auto baseIndex = static_cast<GLuint>(m_indices->getOffset() / indexSize);
+            std::size_t visible = 0;
+            m_commands.clear();
+            for (const geometry::Meshlet &meshlet : m_meshlets)
+            {
+                if (!geometry::isMeshletVisible(meshlet, frustum, camera))
+                {
+                    continue;
+                }
+                ++visible;
+                const GLuint firstIndex = baseIndex + meshlet.firstIndex;
+                if (!m_commands.empty() && m_commands.back().firstIndex + m_commands.back().count == firstIndex)
+                {
+                    m_commands.back().count += meshlet.indexCount; // Merge runs of visible meshlets into one draw
+                    continue;
+                }
+                m_commands.push_back({meshlet.indexCount, 1, firstIndex, 0, 0});
+            }
+
+            if (m_indirectBufferId == 0)
+            {
+                glGenBuffers(1, &m_indirectBufferId);
+            }
+            // Re-specifying the store orphans the one the GPU may still read from the previous frame
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBufferId);
+            glBufferData(GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(m_commands.size() * sizeof(DrawElementsIndirectCommand)), m_commands.data(), GL_STREAM_DRAW);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+            m_visibleCount = visible;
+            return visible;
+        }
+
+        /**
+         * @brief Draws the meshlets selected by the last cull, with the vertex array object of the pass bound.
+         */
+        void draw(GLenum mode = GL_TRIANGLES) const
+        {
+            if (m_commands.empty())
+            {
+                return;
+            }
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBufferId);
+            glMultiDrawElementsIndirect(mode, m_indices->getIndexType(), nullptr, static_cast<GLsizei>(m_commands.size()), 0);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        }
+
+        /**
+         * @brief Index buffer to bind to the pass, see context::OpenGLPassContext::setIndexBuffer.
+         */
+        [[nodiscard]] const std::shared_ptr<IndexBuffer> &getIndexBuffer() const
+        {
+            return m_indices;
+        }
+
+        [[nodiscard]] const std::vector<geometry::Meshlet> &getMeshlets() const
+        {
+            return m_meshlets;
+        }
+
+        /**
+         * @brief Draws issued by draw(), after merging consecutive visible meshlets.
+         */
+        [[nodiscard]] const std::vector<DrawElementsIndirectCommand> &getCommands() const
+        {
+            return m_commands;
+        }
+
+        [[nodiscard]] std::size_t getVisibleCount() const
+        {
+            return m_visibleCount;
+        }
+
+    private:
+        std::shared_ptr<IndexBuffer> m_indices = std::make_shared<IndexBuffer>(); ///< Indices of every meshlet.
+        std::vector<geometry::Meshlet> m_meshlets;                                 ///< Bounds and index ranges of the meshlets.
+        std::vector<DrawElementsIndirectCommand> m_commands;                       ///< Draws of the visible meshlets.
+        std::size_t m_visibleCount = 0;                                           ///< Meshlets that passed the last cull.
+        GLuint m_indirectBufferId = 0;                                            ///< OpenGL indirect buffer ID
+    };
+}
@@ -0,0 +1,208 @@
+/**
+ * @file IndexBuffer.hpp
+ * @brief Element array buffer with automatic index width selection.
+ *
+ * Indices are given as 32-bit values and stored as 16-bit ones whenever the vertex count allows
+ * it, halving the index memory of most meshes. Run the geometry optimizers on the indices before
+ * setting them to improve post-transform vertex cache reuse and overdraw.
+ *
+ * @code
+ * geometry::optimizeVertexCache(indices, vertexCount);
+ * auto indexBuffer = std::make_shared<IndexBuffer>();
+ * indexBuffer->set(indices, vertexCount);
+ * passContext->setIndexBuffer(indexBuffer);
+ * pass->use();
+ * indexBuffer->draw();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <span>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @class IndexBuffer
+     * @brief Indices of indexed draws, stored in their own buffer or in a shared buffer range.
+     */
+    class IndexBuffer
+    {
+    public:
+        IndexBuffer() = default;
+        IndexBuffer(const IndexBuffer &) = delete;
+        IndexBuffer &operator=(const IndexBuffer &) = delete;
+
+        ~IndexBuffer()
+        {
+            BufferNames::release(m_ownBufferId);
+        }
+
+        /**
+         * @brief Narrowest index type able to address the given number of vertices.
+         */
+        static constexpr GLenum selectIndexType(std::size_t vertexCount)
+        {
+            return vertexCount <= 0x10000 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        }
+
+        /**
+         * @brief Stores indices in a range of a shared buffer instead of a buffer of its own.
+         */
+        void setAllocation(std::shared_ptr<BufferAllocation> allocation)
+        {
+            m_allocation = std::move(allocation);
+        }
+
+        [[nodiscard]] const std::shared_ptr<BufferAllocation> &getAllocation() const
+        {
+            return m_allocation;
+        }
+
+        /**
+         * @brief Uploads indices, 16-bit wide if vertexCount allows it, 32-bit otherwise.
+         * @param indices Indices into the vertex arrays.
+         * @param vertexCount Number of vertices addressed by the indices.
+         * @throws common::exception::TraceableException If an index is not below vertexCount, or
+         *         the indices do not fit in the shared buffer range.
+         */
+        void set(std::span<const std::uint32_t> indices, std::size_t vertexCount)
+        {
+            if (auto it = std::ranges::find_if(indices, [vertexCount](std::uint32_t index)
+                                               { return index >= vertexCount; });
+                it != indices.end())
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::INDEX_BUFFER::INDEX_OUT_OF_RANGE: Index {} addresses one of {} vertices", *it, vertexCount));
+            }
+
+            m_indexType = selectIndexType(vertexCount);
+            m_count = static_cast<GLsizei>(indices.size());
+            if (m_indexType == GL_UNSIGNED_SHORT)
+            {
+                std::vector<std::uint16_t> narrowed(indices.begin(), indices.end());
+                upload(std::as_bytes(std::span<const std::uint16_t>(narrowed)));
+            }
+            else
+            {
+                upload(std::as_bytes(indices));
+            }
+        }
+
+        /**
+         * @brief Uploads indices already stored as indexType, e.g. read from a mesh file.
+         *
+         * The indices are uploaded as they are, without checking them against a vertex count.
+         *
+         * @throws common::exception::TraceableException If the index type is not GL_UNSIGNED_SHORT or
+         *         GL_UNSIGNED_INT, or the indices do not fit in the shared buffer range.
+         */
+        void setEncoded(std::span<const std::byte> data, GLenum indexType)
+        {
+            describe(indexType, static_cast<GLsizei>(data.size() / (indexType == GL_UNSIGNED_SHORT ? 2 : 4)));
+            upload(data);
+        }
+
+        /**
+         * @brief Sets the type and count of indices written into the shared buffer range by other means, e.g. an upload queue.
+         * @throws common::exception::TraceableException If the index type is not GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+         */
+        void describe(GLenum indexType, GLsizei count)
+        {
+            if (indexType != GL_UNSIGNED_SHORT && indexType != GL_UNSIGNED_INT)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::INDEX_BUFFER::INDEX_TYPE_NOT_SUPPORTED: The index type ({}) is not supported", indexType));
+            }
+            m_indexType = indexType;
+            m_count = count;
+        }
+
+        /**
+         * @brief Binds the indices to the bound vertex array object.
+         */
+        void bind() const
+        {
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, getBufferID());
+        }
+
+        /**
+         * @brief Issues an indexed draw of every index, with the vertex array object of the pass bound.
+         */
+        void draw(GLenum mode = GL_TRIANGLES) const
+        {
+            glDrawElements(mode, m_count, m_indexType, reinterpret_cast<const void *>(getOffset()));
+        }
+
+        /**
+         * @brief Issues an indexed draw of count indices starting at firstIndex, e.g. one level of detail.
+         */
+        void draw(GLsizei firstIndex, GLsizei count, GLenum mode = GL_TRIANGLES) const
+        {
+            const GLintptr indexSize = m_indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+            glDrawElements(mode, count, m_indexType, reinterpret_cast<const void *>(getOffset() + firstIndex * indexSize));
+        }
+
+        [[nodiscard]] GLuint getBufferID() const
+        {
+            return m_allocation ? m_allocation->bufferId : m_ownBufferId;
+        }
+
+        /**
+         * @brief Byte offset of the first index in the buffer, to give to glDrawElements.
+         */
+        [[nodiscard]] GLintptr getOffset() const
+        {
+            return m_allocation ? m_allocation->offset : 0;
+        }
+
+        [[nodiscard]] GLenum getIndexType() const
+        {
+            return m_indexType;
+        }
+
+        [[nodiscard]] GLsizei getCount() const
+        {
+            return m_count;
+        }
+
+    private:
+        void upload(std::span<const std::byte> data)
+        {
+            // GL_COPY_WRITE_BUFFER leaves the element binding of the bound vertex array object untouched
+            const auto size = static_cast<GLsizeiptr>(data.size());
+            if (m_allocation)
+            {
+                if (size > m_allocation->size)
+                {
+                    throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::INDEX_BUFFER::ALLOCATION_TOO_SMALL: {} bytes do not fit in an allocation of {} bytes", size, m_allocation->size));
+                }
+                glBindBuffer(GL_COPY_WRITE_BUFFER, m_allocation->bufferId);
+                glBufferSubData(GL_COPY_WRITE_BUFFER, m_allocation->offset, size, data.data());
+            }
+            else
+            {
+                if (m_ownBufferId == 0)
+                {
+                    glGenBuffers(1, &m_ownBufferId);
+                }
+                glBindBuffer(GL_COPY_WRITE_BUFFER, m_ownBufferId);
+                glBufferData(GL_COPY_WRITE_BUFFER, size, data.data(), GL_STATIC_DRAW);
+            }
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+
+        GLuint m_ownBufferId = 0;                       ///< Buffer created for the indices when no allocation is set.
+        std::shared_ptr<BufferAllocation> m_allocation; ///< Range of a shared buffer holding the indices.
+        GLenum m_indexType = GL_UNSIGNED_SHORT;         ///< Type of one index.
+        GLsizei m_count = 0;                            ///< Number of indices.
+    };
+}
@@ -0,0 +1,156 @@
+/**
+ * @file InterleavedBuffer.hpp
+ * @brief One vertex buffer feeding every attribute of an interleaved vertex layout.
+ *
+ * Setting an array of interleaved vertices on each attribute gives every attribute a buffer of its
+ * own, holding the whole array: a layout of N elements is uploaded N times and stored N times, while
+ * each attribute only reads its own element. An interleaved buffer holds the array once. Attaching
+ * an attribute records the format of its element, whose offset inside one vertex sets it apart from
+ * the other elements, and makes it read from the shared buffer. The vertex array object of the pass
+ * then points all the attributes at that buffer.
+ *
+ * @code
+ * struct Vertex { glm::vec3 position; glm::vec3 normal; glm::vec2 uv; };
+ * ARTIST_VERTEX_LAYOUT(Vertex, position, normal, uv)
+ *
+ * InterleavedBuffer<Vertex> vertices;
+ * vertices.set(loadVertices());
+ * vertices.attach(*pass->getContext()); // position, normal and uv read the same buffer
+ * pass->use();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+#include <graphic/opengl/context/AttributeContext.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @class InterleavedBuffer
+     * @brief Buffer of vertices of A, shared by the attributes of the elements of its layout.
+     *
+     * The attributes read the buffer through an allocation spanning it whole, which is cleared when
+     * the buffer is destroyed.
+     *
+     * @tparam A The type of one vertex.
+     */
+    template <typename A>
+        requires layout::HasVertexLayout<A>
+    class InterleavedBuffer
+    {
+    public:
+        explicit InterleavedBuffer(GLenum usage = GL_STATIC_DRAW)
+            : m_allocation(std::make_shared<BufferAllocation>()), m_usage(usage)
+        {
+            glGenBuffers(1, &m_allocation->bufferId);
+        }
+
+        InterleavedBuffer(const InterleavedBuffer &) = delete;
+        InterleavedBuffer &operator=(const InterleavedBuffer &) = delete;
+
+        ~InterleavedBuffer()
+        {
+            BufferNames::release(m_allocation->bufferId);
+            *m_allocation = BufferAllocation{};
+        }
+
+        /**
+         * @brief Uploads the whole vertex array, in one call whatever the number of elements of the layout.
+         *
+         * A buffer of another size is reallocated; one of the same size is orphaned first, so the
+         * driver does not stall on draws still reading the previous vertices.
+         */
+        void set(std::span<const A> vertices)
+        {
+            const auto size = static_cast<GLsizeiptr>(vertices.size_bytes());
+            glBindBuffer(GL_ARRAY_BUFFER, m_allocation->bufferId);
+            if (size != m_allocation->size)
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, vertices.data(), m_usage);
+                m_allocation->size = size;
+            }
+            else
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, nullptr, m_usage);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, size, vertices.data());
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        /**
+         * @brief Re-uploads the modified vertices of the array set last.
+         * @throws common::exception::TraceableException If the range is outside of the buffer.
+         */
+        void update(std::span<const A> vertices, std::size_t first, std::size_t count)
+        {
+            const std::size_t vertexCount = static_cast<std::size_t>(m_allocation->size) / sizeof(A);
+            if (first > vertexCount || count > vertexCount - first || first + count > vertices.size())
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::INTERLEAVED_BUFFER::OUT_OF_RANGE: Vertices [{}, {}) are outside of a buffer of {} vertices", first, first + count, vertexCount));
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, m_allocation->bufferId);
+            glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(first * sizeof(A)), static_cast<GLsizeiptr>(count * sizeof(A)), vertices.data() + first);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        /**
+         * @brief Makes an attribute read the element named after it from this buffer.
+         * @throws common::exception::TraceableException If the layout of A has no element for the attribute.
+         */
+        void attach(context::OpenGLAttributeContext &attribute) const
+        {
+            const layout::VertexElement *element = layout::findElement<A>(attribute.getAttributeName());
+            if (!element)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::INTERLEAVED_BUFFER::ELEMENT_NOT_FOUND: No element named {} in the vertex layout", attribute.getAttributeName()));
+            }
+            attribute.setVertexFormat(*element, layout::VertexLayout<A>::stride);
+            attribute.setAllocation(m_allocation);
+        }
+
+        /**
+         * @brief Attaches every attribute of a pass named after an element of the layout.
+         *
+         * Single-element layouts match any attribute name, so they attach every attribute of the pass.
+         */
+        void attach(const context::OpenGLPassContext &pass) const
+        {
+            for (const auto &[name, attribute] : pass.getAttributes())
+            {
+                if (layout::findElement<A>(name))
+                {
+                    attach(*attribute->getContext());
+                }
+            }
+        }
+
+        [[nodiscard]] GLuint getBufferID() const
+        {
+            return m_allocation->bufferId;
+        }
+
+        /**
+         * @return The number of vertices uploaded.
+         */
+        [[nodiscard]] std::size_t size() const
+        {
+            return static_cast<std::size_t>(m_allocation->size) / sizeof(A);
+        }
+
+    private:
+        std::shared_ptr<BufferAllocation> m_allocation; ///< Whole buffer, as read by the attached attributes.
+        GLenum m_usage;                                 ///< Usage hint of the data store.
+    };
+}
@@ -0,0 +1,240 @@
+/**
+ * @file StreamingBuffer.hpp
+ * @brief Persistently mapped vertex buffer for geometry rewritten every frame.
+ *
+ * The buffer is allocated once with glBufferStorage and stays mapped for its whole lifetime. It is
+ * split into N frame regions used round-robin: the CPU writes the vertices of frame i into region
+ * i % N while the GPU still reads the regions of the previous frames. A fence is inserted after the
+ * draws of each frame and waited on before its region is written again, so writes never race with
+ * the GPU and no memory is allocated per frame.
+ *
+ * @code
+ * StreamingBuffer stream(64 * 1024);
+ *
+ * stream.beginFrame();
+ * auto particles = stream.allocate<glm::vec3>(count);
+ * fillParticles(particles.data);
+ * stream.attach<glm::vec3>(*positionAttribute->getContext(), particles.offset);
+ * pass->use();
+ * // draw...
+ * stream.endFrame();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <span>
+#include <vector>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+#include <graphic/opengl/context/AttributeContext.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+#include <graphic/opengl/layout/VertexTranscoding.hpp>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @struct StreamingAllocation
+     * @brief Memory handed out by a streaming buffer for the current frame.
+     */
+    template <typename T>
+    struct StreamingAllocation
+    {
+        std::span<T> data; ///< GPU-visible memory to write the vertices into.
+        GLintptr offset;   ///< Byte offset of the data in the buffer.
+    };
+
+    /**
+     * @class StreamingBuffer
+     * @brief Persistently mapped buffer divided into fence-guarded frame regions.
+     */
+    class StreamingBuffer
+    {
+    public:
+        static constexpr GLbitfield STORAGE_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        static constexpr std::size_t ALIGNMENT = 16;        ///< Alignment of each allocation, in bytes.
+        static constexpr GLuint64 WAIT_TIMEOUT = 1'000'000; ///< Nanoseconds waited per glClientWaitSync call.
+
+        /**
+         * @brief Allocates and maps the buffer.
+         * @param regionSize Bytes available to one frame.
+         * @param regionCount Number of frames the CPU may be ahead of the GPU, plus one.
+         */
+        explicit StreamingBuffer(std::size_t regionSize, std::size_t regionCount = 3)
+            : m_regionSize(alignUp(regionSize)), m_fences(regionCount, nullptr)
+        {
+            if (regionSize == 0 || regionCount == 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::STREAMING_BUFFER::EMPTY");
+            }
+            const auto size = static_cast<GLsizeiptr>(m_regionSize * regionCount);
+            glGenBuffers(1, &m_bufferId);
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferId);
+            glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, STORAGE_FLAGS);
+            m_mapped = static_cast<std::byte *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, STORAGE_FLAGS));
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            if (!m_mapped)
+            {
+                glDeleteBuffers(1, &m_bufferId);
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::STREAMING_BUFFER::MAP_FAILED");
+            }
+        }
+
+        StreamingBuffer(const StreamingBuffer &) = delete;
+        StreamingBuffer &operator=(const StreamingBuffer &) = delete;
+
+        ~StreamingBuffer()
+        {
+            for (GLsync fence : m_fences)
+            {
+                if (fence)
+                {
+                    glDeleteSync(fence);
+                }
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferId);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            BufferNames::release(m_bufferId);
+        }
+
+        /**
+         * @brief Starts writing a frame, waiting for the GPU to release the region of that frame.
+         */
+        void beginFrame()
+        {
+            GLsync &fence = m_fences[m_region];
+            if (fence)
+            {
+                GLenum status = GL_TIMEOUT_EXPIRED;
+                while (status == GL_TIMEOUT_EXPIRED)
+                {
+                    status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_TIMEOUT);
+                }
+                glDeleteSync(fence);
+                fence = nullptr;
+                if (status == GL_WAIT_FAILED)
+                {
+                    throw common::exception::TraceableException<std::runtime_error>("ERROR::STREAMING_BUFFER::WAIT_FAILED");
+                }
+            }
+            m_cursor = 0;
+        }
+
+        /**
+         * @brief Ends the frame: fences the draws that read the current region and moves to the next one.
+         */
+        void endFrame()
+        {
+            m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            m_region = (m_region + 1) % m_fences.size();
+        }
+
+        /**
+         * @brief Hands out memory of the current region for count values of T.
+         * @throws common::exception::TraceableException If the region has no room left for this frame.
+         */
+        template <typename T>
+        StreamingAllocation<T> allocate(std::size_t count)
+        {
+            const std::size_t size = count * sizeof(T);
+            if (size > m_regionSize - m_cursor)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::STREAMING_BUFFER::REGION_OVERFLOW: {} bytes requested, {} left in the frame region", size, m_regionSize - m_cursor));
+            }
+            const std::size_t offset = m_region * m_regionSize + m_cursor;
+            m_cursor += alignUp(size);
+            return {std::span<T>(reinterpret_cast<T *>(m_mapped + offset), count), static_cast<GLintptr>(offset)};
+        }
+
+        /**
+         * @brief Copies values into the current region.
+         * @return Byte offset of the values in the buffer.
+         */
+        template <typename T>
+        GLintptr write(std::span<const T> values)
+        {
+            StreamingAllocation<T> allocation = allocate<T>(values.size());
+            std::ranges::copy(values, allocation.data.begin());
+            return allocation.offset;
+        }
+
+        /**
+         * @brief Interleaves component arrays straight into the current region, as vertices of A.
+         *
+         * The arrays are given in the element order of the vertex layout of A, see layout::interleaveVertices.
+         *
+         * @return Byte offset of the vertices in the buffer.
+         */
+        template <typename A>
+        GLintptr writeInterleaved(std::span<const float *const> streams, std::size_t count)
+        {
+            StreamingAllocation<A> allocation = allocate<A>(count);
+            layout::interleaveVertices<A>(streams, count, std::as_writable_bytes(allocation.data));
+            return allocation.offset;
+        }
+
+        /**
+         * @brief Makes an attribute read its vertices from this buffer, at the given offset.
+         *
+         * The vertex format is the one of the element of T's layout named after the attribute. The
+         * binding is recorded as the streaming range of the attribute: its own buffer is kept, and
+         * used again once the range is cleared. Values cannot be set on the attribute meanwhile, the
+         * storage of this buffer being immutable.
+         *
+         * @throws common::exception::TraceableException If the layout of T has no element for the attribute.
+         */
+        template <typename T>
+            requires layout::HasVertexLayout<T>
+        void attach(context::OpenGLAttributeContext &attribute, GLintptr offset) const
+        {
+            const layout::VertexElement *element = layout::findElement<T>(attribute.getAttributeName());
+            if (!element)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::STREAMING_BUFFER::ELEMENT_NOT_FOUND: No element named {} in the vertex layout", attribute.getAttributeName()));
+            }
+            attribute.setVertexFormat(*element, layout::VertexLayout<T>::stride);
+            const auto size = static_cast<GLsizeiptr>(m_regionSize * m_fences.size()) - offset;
+            attribute.setStreamingRange(std::make_shared<BufferAllocation>(BufferAllocation{m_bufferId, offset, size}));
+        }
+
+        [[nodiscard]] GLuint getBufferID() const
+        {
+            return m_bufferId;
+        }
+
+        [[nodiscard]] std::size_t getRegionSize() const
+        {
+            return m_regionSize;
+        }
+
+        [[nodiscard]] std::size_t getRegionCount() const
+        {
+            return m_fences.size();
+        }
+
+        [[nodiscard]] std::size_t getCurrentRegion() const
+        {
+            return m_region;
+        }
+
+    private:
+        static constexpr std::size_t alignUp(std::size_t size)
+        {
+            return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        }
+
+        GLuint m_bufferId = 0;         ///< OpenGL buffer ID
+        std::byte *m_mapped = nullptr; ///< Persistent mapping of the whole buffer.
+        std::size_t m_regionSize;      ///< Bytes of one frame region.
+        std::vector<GLsync> m_fences;  ///< Fence of the last frame that used each region.
+        std::size_t m_region = 0;      ///< Region written by the current frame.
+        std::size_t m_cursor = 0;      ///< Bytes already handed out in the current region.
+    };
+}
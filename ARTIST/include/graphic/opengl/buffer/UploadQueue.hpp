@@ -0,0 +1,402 @@
+/**
+ * @file UploadQueue.hpp
+ * @brief Asynchronous buffer uploads spread over frames.
+ *
+ * Uploading a large array with glBufferData/glBufferSubData on the render thread stalls the frame
+ * that does it. With the upload queue, any thread submits data; a worker thread copies it into a
+ * persistently mapped staging buffer; and the GL thread, once per frame, issues glCopyBufferSubData
+ * from staging memory to the destination buffers, never more than a byte budget per frame. A fence
+ * after each frame's copies tells when their staging memory can be reused and completes the futures
+ * returned on submission.
+ *
+ * @code
+ * UploadQueue uploads(16 * 1024 * 1024, 2 * 1024 * 1024);
+ * auto done = uploads.submit(std::move(bytes), vbo, 0); // any thread
+ * // each frame, on the GL thread:
+ * uploads.process();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <format>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @class UploadQueue
+     * @brief Stages submitted data from a worker thread and copies it to GPU buffers under a per-frame budget.
+     *
+     * Submissions complete in order. Uploads larger than the budget are split into chunks copied over
+     * several frames.
+     */
+    class UploadQueue
+    {
+    public:
+        static constexpr GLbitfield STORAGE_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        static constexpr std::size_t ALIGNMENT = 16; ///< Alignment of staging allocations, in bytes.
+
+        /**
+         * @brief Creates and maps the staging buffer. Must be called on the GL thread.
+         * @param stagingSize Size of the staging buffer in bytes.
+         * @param frameBudget Maximum number of bytes copied by one process() call.
+         * @param startWorker Whether to stage submissions on a worker thread. Without it, the owner
+         *        calls stagePending() itself, e.g. from its own job system.
+         */
+        UploadQueue(std::size_t stagingSize, std::size_t frameBudget, bool startWorker = true)
+            : m_stagingSize(stagingSize), m_frameBudget(frameBudget),
+              m_chunkSize(std::min(frameBudget, stagingSize / 2) / ALIGNMENT * ALIGNMENT)
+        {
+            if (m_chunkSize == 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::UPLOAD_QUEUE::INVALID_SIZES: staging {} bytes, budget {} bytes", stagingSize, frameBudget));
+            }
+            glGenBuffers(1, &m_stagingBufferId);
+            glBindBuffer(GL_COPY_READ_BUFFER, m_stagingBufferId);
+            glBufferStorage(GL_COPY_READ_BUFFER, static_cast<GLsizeiptr>(stagingSize), nullptr, STORAGE_FLAGS);
+            m_staging = static_cast<std::byte *>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, static_cast<GLsizeiptr>(stagingSize), STORAGE_FLAGS));
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            if (!m_staging)
+            {
+                glDeleteBuffers(1, &m_stagingBufferId);
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::UPLOAD_QUEUE::MAP_FAILED");
+            }
+            if (startWorker)
+            {
+                m_worker = std::jthread([this](std::stop_token stop)
+                                        { work(stop); });
+            }
+        }
+
+        UploadQueue(const UploadQueue &) = delete;
+        UploadQueue &operator=(const UploadQueue &) = delete;
+
+        /**
+         * @brief Stops the worker and releases the staging buffer. Must be called on the GL thread.
+         *
+         * Unfinished uploads are abandoned: their futures report a broken promise.
+         */
+        ~UploadQueue()
+        {
+            if (m_worker.joinable())
+            {
+                // The stop token wakes the worker up through m_condition, even between its check and its wait
+                m_worker.request_stop();
+                m_worker.join();
+            }
+            std::lock_guard lock(m_mutex);
+            for (const auto &batch : m_inFlight)
+            {
+                glDeleteSync(batch.fence);
+            }
+            glBindBuffer(GL_COPY_READ_BUFFER, m_stagingBufferId);
+            glUnmapBuffer(GL_COPY_READ_BUFFER);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glDeleteBuffers(1, &m_stagingBufferId);
+        }
+
+        /**
+         * @brief Queues a copy of data into a range of a shared buffer. Thread-safe.
+         *
+         * The data is not copied on submission: it must stay alive until the returned future is ready.
+         * The destination is read when the copy is issued, so arena compaction is taken into account.
+         *
+         * @param offset Byte offset inside the allocation.
+         * @return A future ready once the GPU has finished the copy.
+         */
+        std::shared_future<void> submit(std::span<const std::byte> data, std::shared_ptr<BufferAllocation> destination, GLintptr offset = 0)
+        {
+            return enqueue(std::make_shared<Upload>(), data, std::move(destination), offset);
+        }
+
+        /**
+         * @brief Queues a copy of data into a buffer, at the given byte offset. Thread-safe.
+         *
+         * The data must stay alive until the returned future is ready.
+         */
+        std::shared_future<void> submit(std::span<const std::byte> data, GLuint bufferId, GLintptr offset)
+        {
+            return submit(data, std::make_shared<BufferAllocation>(BufferAllocation{bufferId, 0, offset + static_cast<GLsizeiptr>(data.size())}), offset);
+        }
+
+        /**
+         * @brief Queues a copy of owned data into a range of a shared buffer. Thread-safe.
+         */
+        std::shared_future<void> submit(std::vector<std::byte> &&data, std::shared_ptr<BufferAllocation> destination, GLintptr offset = 0)
+        {
+            auto upload = std::make_shared<Upload>();
+            upload->owned = std::move(data);
+            std::span<const std::byte> bytes = upload->owned;
+            return enqueue(std::move(upload), bytes, std::move(destination), offset);
+        }
+
+        /**
+         * @brief Queues a copy of owned data into a buffer, at the given byte offset. Thread-safe.
+         */
+        std::shared_future<void> submit(std::vector<std::byte> &&data, GLuint bufferId, GLintptr offset)
+        {
+            const auto size = offset + static_cast<GLsizeiptr>(data.size());
+            return submit(std::move(data), std::make_shared<BufferAllocation>(BufferAllocation{bufferId, 0, size}), offset);
+        }
+
+        /**
+         * @brief Copies pending chunks into staging memory while there is room. Thread-safe.
+         *
+         * Called by the worker thread; only call it directly when the queue was created without worker.
+         *
+         * @return The number of staged chunks.
+         */
+        std::size_t stagePending()
+        {
+            std::size_t staged = 0;
+            while (stageOne())
+            {
+                ++staged;
+            }
+            return staged;
+        }
+
+        /**
+         * @brief Completes finished uploads and issues the copies of this frame. Must be called on the GL thread.
+         * @return The number of bytes whose copy was issued.
+         */
+        std::size_t process()
+        {
+            retire();
+
+            std::vector<Chunk> batch;
+            std::size_t bytes = 0;
+            {
+                std::lock_guard lock(m_mutex);
+                while (!m_staged.empty() && bytes + m_staged.front().size <= m_frameBudget)
+                {
+                    bytes += m_staged.front().size;
+                    batch.push_back(std::move(m_staged.front()));
+                    m_staged.pop_front();
+                }
+            }
+            if (batch.empty())
+            {
+                return 0;
+            }
+
+            glBindBuffer(GL_COPY_READ_BUFFER, m_stagingBufferId);
+            for (const auto &chunk : batch)
+            {
+                glBindBuffer(GL_COPY_WRITE_BUFFER, chunk.destination->bufferId);
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(chunk.stagingOffset), chunk.destination->offset + chunk.destinationOffset, static_cast<GLsizeiptr>(chunk.size));
+            }
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            std::lock_guard lock(m_mutex);
+            m_inFlight.push_back({fence, std::move(batch)});
+            return bytes;
+        }
+
+        /**
+         * @brief Checks whether every submitted upload has completed.
+         */
+        [[nodiscard]] bool isIdle() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_pending.empty() && m_staged.empty() && m_inFlight.empty();
+        }
+
+        [[nodiscard]] GLuint getStagingBufferID() const
+        {
+            return m_stagingBufferId;
+        }
+
+    private:
+        struct Upload
+        {
+            std::promise<void> promise;   ///< Completed once every chunk has been copied by the GPU.
+            std::size_t remainingChunks;  ///< Chunks not completed yet.
+            std::vector<std::byte> owned; ///< Data owned by the queue, if any.
+        };
+
+        struct Chunk
+        {
+            std::shared_ptr<Upload> upload;                ///< Upload the chunk belongs to.
+            const std::byte *source;                       ///< Data to copy.
+            std::size_t size;                              ///< Number of bytes to copy.
+            std::shared_ptr<BufferAllocation> destination; ///< Destination range.
+            GLintptr destinationOffset;                    ///< Offset of the chunk inside the destination range.
+            std::size_t stagingOffset = 0;                 ///< Offset of the chunk in staging memory.
+            std::size_t footprint = 0;                     ///< Staging bytes to release, padding included.
+        };
+
+        struct Batch
+        {
+            GLsync fence;              ///< Signaled once the GPU has executed the copies.
+            std::vector<Chunk> chunks; ///< Copies issued in one process() call.
+        };
+
+        std::shared_future<void> enqueue(std::shared_ptr<Upload> upload, std::span<const std::byte> data, std::shared_ptr<BufferAllocation> destination, GLintptr offset)
+        {
+            if (!destination || destination->bufferId == 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::UPLOAD_QUEUE::NO_DESTINATION");
+            }
+            if (offset < 0 || offset + static_cast<GLsizeiptr>(data.size()) > destination->size)
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::UPLOAD_QUEUE::OUT_OF_RANGE: {} bytes at offset {} do not fit in {} bytes", data.size(), offset, destination->size));
+            }
+            std::shared_future<void> future = upload->promise.get_future().share();
+            if (data.empty())
+            {
+                upload->promise.set_value();
+                return future;
+            }
+            upload->remainingChunks = (data.size() + m_chunkSize - 1) / m_chunkSize;
+            {
+                std::lock_guard lock(m_mutex);
+                for (std::size_t first = 0; first < data.size(); first += m_chunkSize)
+                {
+                    const std::size_t size = std::min(m_chunkSize, data.size() - first);
+                    m_pending.push_back({upload, data.data() + first, size, destination, offset + static_cast<GLintptr>(first)});
+                }
+                m_signaled = true;
+            }
+            m_condition.notify_all();
+            return future;
+        }
+
+        /**
+         * @brief Reserves contiguous staging memory, FIFO ring style.
+         */
+        std::optional<std::size_t> allocateStaging(std::size_t size, std::size_t &footprint)
+        {
+            std::size_t start = m_ringHead;
+            std::size_t padding = 0;
+            if (start + size > m_stagingSize)
+            {
+                padding = m_stagingSize - start; // The end of the ring is too short, wrap around
+                start = 0;
+            }
+            if (m_ringUsed + padding + size > m_stagingSize)
+            {
+                return std::nullopt;
+            }
+            m_ringHead = start + size;
+            m_ringUsed += padding + size;
+            footprint = padding + size;
+            return start;
+        }
+
+        bool stageOne()
+        {
+            Chunk chunk;
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_pending.empty() || m_staging == nullptr)
+                {
+                    return false;
+                }
+                const std::size_t aligned = (m_pending.front().size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+                auto offset = allocateStaging(aligned, m_pending.front().footprint);
+                if (!offset)
+                {
+                    return false; // Wait for the GPU to release staging memory
+                }
+                m_pending.front().stagingOffset = *offset;
+                chunk = std::move(m_pending.front());
+                m_pending.pop_front();
+            }
+            std::memcpy(m_staging + chunk.stagingOffset, chunk.source, chunk.size);
+            {
+                std::lock_guard lock(m_mutex);
+                m_staged.push_back(std::move(chunk));
+            }
+            return true;
+        }
+
+        void retire()
+        {
+            while (true)
+            {
+                // Only the GL thread adds and removes batches, the front one stays put while unlocked
+                GLsync fence;
+                {
+                    std::lock_guard lock(m_mutex);
+                    if (m_inFlight.empty())
+                    {
+                        return;
+                    }
+                    fence = m_inFlight.front().fence;
+                }
+                GLenum status = glClientWaitSync(fence, 0, 0);
+                if (status == GL_TIMEOUT_EXPIRED)
+                {
+                    return;
+                }
+                if (status == GL_WAIT_FAILED)
+                {
+                    throw common::exception::TraceableException<std::runtime_error>("ERROR::UPLOAD_QUEUE::WAIT_FAILED");
+                }
+                glDeleteSync(fence);
+                {
+                    std::lock_guard lock(m_mutex);
+                    for (auto &chunk : m_inFlight.front().chunks)
+                    {
+                        m_ringUsed -= chunk.footprint;
+                        if (--chunk.upload->remainingChunks == 0)
+                        {
+                            chunk.upload->promise.set_value();
+                        }
+                    }
+                    m_inFlight.pop_front();
+                    m_signaled = true;
+                }
+                m_condition.notify_all();
+            }
+        }
+
+        void work(std::stop_token stop)
+        {
+            while (!stop.stop_requested())
+            {
+                stagePending();
+                std::unique_lock lock(m_mutex);
+                // Woken up by new submissions and by released staging memory
+                if (!m_condition.wait(lock, stop, [this]()
+                                      { return m_signaled; }))
+                {
+                    return; // Stop requested
+                }
+                m_signaled = false;
+            }
+        }
+
+        std::size_t m_stagingSize;               ///< Size of the staging buffer.
+        std::size_t m_frameBudget;               ///< Maximum bytes copied per process() call.
+        std::size_t m_chunkSize;                 ///< Maximum size of one copy.
+        GLuint m_stagingBufferId = 0;            ///< OpenGL staging buffer ID
+        std::byte *m_staging = nullptr;          ///< Persistent mapping of the staging buffer.
+        std::size_t m_ringHead = 0;              ///< Next staging offset to hand out.
+        std::size_t m_ringUsed = 0;              ///< Staging bytes in use, padding included.
+        bool m_signaled = false;                 ///< Something happened that may let the worker stage a chunk.
+        mutable std::mutex m_mutex;              ///< Guards the queues, the batches in flight and the staging ring.
+        std::condition_variable_any m_condition; ///< Signals submissions, released staging memory and stop requests.
+        std::deque<Chunk> m_pending;             ///< Chunks waiting for staging memory.
+        std::deque<Chunk> m_staged;              ///< Chunks in staging memory, waiting for their copy.
+        std::deque<Batch> m_inFlight;            ///< Copies issued to the GPU, oldest first.
+        std::jthread m_worker;                   ///< Stages pending chunks.
+    };
+}
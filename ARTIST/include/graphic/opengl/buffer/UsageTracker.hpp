@@ -0,0 +1,137 @@
+/**
+ * @file UsageTracker.hpp
+ * @brief Choice of a buffer update strategy from the observed update pattern.
+ *
+ * The usage hint given to glBufferData is a guess made by the caller, and a wrong guess makes the
+ * driver place the buffer in the wrong memory. The tracker instead measures how often a buffer is
+ * updated and how much of it changes each time, and after a warm-up window recommends a strategy:
+ * immutable storage for buffers that rarely change, sub-data updates for buffers partially updated,
+ * and persistent streaming for buffers fully rewritten every frame. Averages are exponentially
+ * smoothed, so a buffer migrates again when its pattern changes.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace artist::graphic::opengl::buffer
+{
+    /**
+     * @enum UpdateStrategy
+     * @brief How the data store of a buffer is allocated and updated.
+     */
+    enum class UpdateStrategy
+    {
+        Undecided, ///< Warming up: the usage hint of the caller is used.
+        Immutable, ///< glBufferStorage once, rare glBufferSubData updates.
+        SubData,   ///< GL_DYNAMIC_DRAW store, dirty ranges updated with glBufferSubData.
+        Streaming, ///< Persistently mapped regions rewritten each frame.
+    };
+
+    /**
+     * @class UsageTracker
+     * @brief Smoothed update frequency and dirty fraction of one buffer.
+     */
+    class UsageTracker
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t WARM_UP_UPLOADS = 8;                          ///< Uploads observed before a first recommendation.
+        static constexpr std::chrono::duration<double> RARE_INTERVAL{1.0};         ///< Average interval above which a buffer is immutable.
+        static constexpr std::chrono::duration<double> FRAME_INTERVAL{1.0 / 20.0}; ///< Average interval below which a buffer is updated every frame.
+        static constexpr double FULL_REWRITE = 0.75;                               ///< Dirty fraction above which updates are full rewrites.
+        static constexpr double SMOOTHING = 0.25;                                  ///< Weight of the newest sample in the averages.
+
+        /**
+         * @brief Records an upload and updates the recommendation.
+         * @param now Time of the upload.
+         * @param dirtyBytes Number of bytes written.
+         * @param size Size of the whole buffer data.
+         * @return The recommended strategy.
+         */
+        UpdateStrategy record(Clock::time_point now, std::size_t dirtyBytes, std::size_t size)
+        {
+            const double fraction = size == 0 ? 1.0 : static_cast<double>(dirtyBytes) / static_cast<double>(size);
+            if (m_uploadCount == 0)
+            {
+                m_dirtyFraction = fraction;
+            }
+            else
+            {
+                const std::chrono::duration<double> interval = now - m_lastUpload;
+                m_interval = m_uploadCount == 1 ? interval : smooth(m_interval, interval);
+                m_dirtyFraction = smooth(m_dirtyFraction, fraction);
+            }
+            m_lastUpload = now;
+            ++m_uploadCount;
+
+            if (m_uploadCount >= WARM_UP_UPLOADS)
+            {
+                m_strategy = classify();
+            }
+            return m_strategy;
+        }
+
+        /**
+         * @brief Forgets the observed pattern, e.g. after the data of the buffer is replaced.
+         */
+        void reset()
+        {
+            *this = UsageTracker();
+        }
+
+        [[nodiscard]] UpdateStrategy getStrategy() const
+        {
+            return m_strategy;
+        }
+
+        [[nodiscard]] std::size_t getUploadCount() const
+        {
+            return m_uploadCount;
+        }
+
+        /**
+         * @brief Smoothed time between two uploads.
+         */
+        [[nodiscard]] std::chrono::duration<double> getAverageInterval() const
+        {
+            return m_interval;
+        }
+
+        /**
+         * @brief Smoothed fraction of the buffer written per upload.
+         */
+        [[nodiscard]] double getAverageDirtyFraction() const
+        {
+            return m_dirtyFraction;
+        }
+
+    private:
+        template <typename T>
+        static T smooth(T average, T sample)
+        {
+            return average + (sample - average) * SMOOTHING;
+        }
+
+        UpdateStrategy classify() const
+        {
+            if (m_interval >= RARE_INTERVAL)
+            {
+                return UpdateStrategy::Immutable;
+            }
+            if (m_interval <= FRAME_INTERVAL && m_dirtyFraction >= FULL_REWRITE)
+            {
+                return UpdateStrategy::Streaming;
+            }
+            return UpdateStrategy::SubData;
+        }
+
+        Clock::time_point m_lastUpload;                        ///< Time of the previous upload.
+        std::chrono::duration<double> m_interval{0.0};         ///< Smoothed interval between uploads.
+        double m_dirtyFraction = 0.0;                          ///< Smoothed dirty fraction.
+        std::size_t m_uploadCount = 0;                         ///< Uploads recorded.
+        UpdateStrategy m_strategy = UpdateStrategy::Undecided; ///< Current recommendation.
+    };
+}
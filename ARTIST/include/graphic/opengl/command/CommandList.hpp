@@ -0,0 +1,461 @@
+/**
+ * @file CommandList.hpp
+ * @brief Flat list of OpenGL commands recorded once from a pipeline and replayed every frame.
+ *
+ * Using a pipeline walks the same objects every frame: the virtual use of the pipeline, its User
+ * component, a shared_ptr copy of each pass, their virtual use, the vertex array key rebuilt from
+ * the attributes, then the uniform map lookups of withUniform. When what a frame issues does not
+ * change, the recorder runs that walk once and keeps only the resulting calls: program binds,
+ * vertex array binds, uniform uploads by location, state changes and draws, in one contiguous
+ * vector of plain commands. Uniform values live in a byte payload next to it.
+ *
+ * Replay is a single loop over the commands, switching on their type: no virtual call, no map
+ * lookup, no reference counting. Values that change every frame, such as a view matrix, are
+ * recorded as parameters: the recorder returns a slot, and patching the slot overwrites the value
+ * in the payload before the next replay.
+ *
+ * @code
+ * CommandList frame = recordPipeline(*pipeline, [&](int pass, CommandRecorder &recorder)
+ *                                    {
+ *                                        viewSlot = recorder.parameter("view", glm::mat4(1.0f));
+ *                                        recorder.enable(GL_DEPTH_TEST);
+ *                                        recorder.drawIndexed(0, indexCount);
+ *                                    });
+ * // each frame:
+ * frame.patch(viewSlot, camera.view());
+ * frame.replay();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/Api.hpp>
+#include <graphic/opengl/command/PassView.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/context/PipelineContext.hpp>
+#include <graphic/opengl/pipeline/component/uniform/Setter.hpp>
+#include <graphic/pipeline/Pipeline.hpp>
+
+namespace artist::graphic::opengl::command
+{
+    /**
+     * @brief Kind of a recorded command.
+     */
+    enum class CommandType : std::uint8_t
+    {
+        UseProgram,      ///< glUseProgram(object).
+        BindVertexArray, ///< glBindVertexArray(object).
+        Uniform,         ///< Upload of count values of type glEnum at location object.
+        Enable,          ///< glEnable(glEnum).
+        Disable,         ///< glDisable(glEnum).
+        DrawArrays,      ///< glDrawArrays(glEnum, object, count).
+        DrawElements,    ///< glDrawElements(glEnum, count, indexType, offset).
+    };
+
+    /**
+     * @struct Command
+     * @brief One recorded call. The meaning of the fields depends on the type.
+     */
+    struct Command
+    {
+        CommandType type;     ///< What the command does.
+        GLenum glEnum = 0;    ///< Capability, draw mode or uniform type.
+        GLenum indexType = 0; ///< Index type of DrawElements.
+        GLint object = 0;     ///< Program, vertex array, uniform location or first vertex.
+        GLsizei count = 0;    ///< Number of vertices, indices or uniform values.
+        GLintptr offset = 0;  ///< Offset of the uniform value in the payload, or of the first index in the element buffer.
+    };
+
+    /**
+     * @brief Uniform types whose upload can be replayed from the payload.
+     */
+    template <typename T>
+    concept ReplayableUniform = requires {
+        requires(pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_INT ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_UNSIGNED_INT ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_DOUBLE ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_VEC2 ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_VEC3 ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_VEC4 ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_MAT2 ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_MAT3 ||
+                 pipeline::component::uniform::OpenGLUniformSetter<T>::glType == GL_FLOAT_MAT4);
+    };
+
+    /**
+     * @struct ParameterSlot
+     * @brief Place of a patchable uniform value in the payload of a command list.
+     */
+    template <typename T>
+    struct ParameterSlot
+    {
+        GLintptr offset = -1; ///< Offset of the value in the payload.
+    };
+
+    class CommandRecorder;
+
+    /**
+     * @class CommandList
+     * @brief Recorded commands and the uniform values they upload.
+     */
+    class CommandList
+    {
+    public:
+        /**
+         * @brief Issues every command, in the order they were recorded.
+         */
+        void replay() const
+        {
+            const std::byte *payload = m_payload.data();
+            for (const Command &command : m_commands)
+            {
+                switch (command.type)
+                {
+                case CommandType::UseProgram:
+                    glUseProgram(static_cast<GLuint>(command.object));
+                    break;
+                case CommandType::BindVertexArray:
+                    glBindVertexArray(static_cast<GLuint>(command.object));
+                    break;
+                case CommandType::Uniform:
+                    uploadUniform(command, payload + command.offset);
+                    break;
+                case CommandType::Enable:
+                    glEnable(command.glEnum);
+                    break;
+                case CommandType::Disable:
+                    glDisable(command.glEnum);
+                    break;
+                case CommandType::DrawArrays:
+                    glDrawArrays(command.glEnum, command.object, command.count);
+                    break;
+                case CommandType::DrawElements:
+                    glDrawElements(command.glEnum, command.count, command.indexType, reinterpret_cast<const void *>(command.offset));
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @brief Overwrites the value of a parameter, uploaded at the next replay.
+         * @throws common::exception::TraceableException If the slot does not belong to this list.
+         */
+        template <ReplayableUniform T>
+        void patch(ParameterSlot<T> slot, const T &value)
+        {
+            if (slot.offset < 0 || static_cast<std::size_t>(slot.offset) + sizeof(T) > m_payload.size())
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::COMMAND_LIST::INVALID_SLOT: No parameter at offset {}", slot.offset));
+            }
+            std::memcpy(m_payload.data() + slot.offset, &value, sizeof(T));
+        }
+
+        /**
+         * @brief Appends a command, copying the uniform value it uploads into the payload.
+         * @param value Bytes of the uniform value for a Uniform command, ignored otherwise.
+         */
+        void append(Command command, std::span<const std::byte> value = {})
+        {
+            if (command.type == CommandType::Uniform)
+            {
+                command.offset = static_cast<GLintptr>((m_payload.size() + 7) & ~std::size_t{7});
+                m_payload.resize(static_cast<std::size_t>(command.offset) + value.size());
+                std::ranges::copy(value, m_payload.begin() + command.offset);
+            }
+            m_commands.push_back(command);
+        }
+
+        /**
+         * @brief Reserves room for commands and uniform values, to append without reallocating.
+         */
+        void reserve(std::size_t commandCount, std::size_t payloadSize)
+        {
+            m_commands.reserve(commandCount);
+            m_payload.reserve(payloadSize);
+        }
+
+        /**
+         * @brief Bytes of the uniform value uploaded by a command, empty for other commands.
+         */
+        [[nodiscard]] std::span<const std::byte> getValue(const Command &command) const
+        {
+            if (command.type != CommandType::Uniform)
+            {
+                return {};
+            }
+            return std::span<const std::byte>(m_payload).subspan(static_cast<std::size_t>(command.offset), getUniformSize(command.glEnum) * static_cast<std::size_t>(command.count));
+        }
+
+        /**
+         * @return Size in bytes of one value of a replayable uniform type, or 0 for other types.
+         */
+        [[nodiscard]] static constexpr std::size_t getUniformSize(GLenum glType)
+        {
+            switch (glType)
+            {
+            case GL_FLOAT:
+            case GL_INT:
+            case GL_UNSIGNED_INT:
+                return 4;
+            case GL_DOUBLE:
+            case GL_FLOAT_VEC2:
+                return 8;
+            case GL_FLOAT_VEC3:
+                return 12;
+            case GL_FLOAT_VEC4:
+            case GL_FLOAT_MAT2:
+                return 16;
+            case GL_FLOAT_MAT3:
+                return 36;
+            case GL_FLOAT_MAT4:
+                return 64;
+            default:
+                return 0;
+            }
+        }
+
+        [[nodiscard]] std::span<const Command> getCommands() const
+        {
+            return m_commands;
+        }
+
+        [[nodiscard]] std::size_t getPayloadSize() const
+        {
+            return m_payload.size();
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return m_commands.empty();
+        }
+
+    private:
+        friend class CommandRecorder;
+
+        static void uploadUniform(const Command &command, const std::byte *data)
+        {
+            const GLint location = command.object;
+            switch (command.glEnum)
+            {
+            case GL_FLOAT:
+                glUniform1f(location, read<GLfloat>(data));
+                break;
+            case GL_INT:
+                glUniform1i(location, read<GLint>(data));
+                break;
+            case GL_UNSIGNED_INT:
+                glUniform1ui(location, read<GLuint>(data));
+                break;
+            case GL_DOUBLE:
+                glUniform1d(location, read<GLdouble>(data));
+                break;
+            case GL_FLOAT_VEC2:
+                glUniform2fv(location, command.count, reinterpret_cast<const GLfloat *>(data));
+                break;
+            case GL_FLOAT_VEC3:
+                glUniform3fv(location, command.count, reinterpret_cast<const GLfloat *>(data));
+                break;
+            case GL_FLOAT_VEC4:
+                glUniform4fv(location, command.count, reinterpret_cast<const GLfloat *>(data));
+                break;
+            case GL_FLOAT_MAT2:
+                glUniformMatrix2fv(location, command.count, GL_FALSE, reinterpret_cast<const GLfloat *>(data));
+                break;
+            case GL_FLOAT_MAT3:
+                glUniformMatrix3fv(location, command.count, GL_FALSE, reinterpret_cast<const GLfloat *>(data));
+                break;
+            case GL_FLOAT_MAT4:
+                glUniformMatrix4fv(location, command.count, GL_FALSE, reinterpret_cast<const GLfloat *>(data));
+                break;
+            default:
+                break;
+            }
+        }
+
+        template <typename T>
+        static T read(const std::byte *data)
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        std::vector<Command> m_commands; ///< Commands, in replay order.
+        std::vector<std::byte> m_payload; ///< Uniform values, each aligned on 8 bytes.
+    };
+
+    /**
+     * @class CommandRecorder
+     * @brief Builds a command list from the passes of a pipeline.
+     *
+     * Commands that upload uniforms or draw indices refer to the pass given to the last usePass.
+     * The recorder only reads passes through PassView snapshots, so recorders on different threads
+     * may share the views of the same passes.
+     */
+    class CommandRecorder
+    {
+    public:
+        /**
+         * @brief Records the program and the vertex array object of a pass.
+         *
+         * The view must outlive the commands recorded for the pass.
+         */
+        void usePass(const PassView &pass)
+        {
+            m_pass = &pass;
+            m_list.m_commands.push_back({.type = CommandType::UseProgram, .object = static_cast<GLint>(pass.getProgram())});
+            if (pass.getVertexArray() != 0)
+            {
+                m_list.m_commands.push_back({.type = CommandType::BindVertexArray, .object = static_cast<GLint>(pass.getVertexArray())});
+            }
+        }
+
+        /**
+         * @brief Records the program and the vertex array object of a pass, on the GL thread.
+         *
+         * The pass must have been used since its attributes last changed, so that its vertex array
+         * object exists.
+         */
+        void usePass(const context::OpenGLPassContext &pass)
+        {
+            m_captured = PassView::capture(pass);
+            usePass(*m_captured);
+        }
+
+        /**
+         * @brief Records the upload of a constant value to a uniform of the current pass.
+         * @throws common::exception::TraceableException If no pass is used or the uniform does not exist.
+         */
+        template <ReplayableUniform T>
+        void uniform(const std::string &name, const T &value)
+        {
+            record(name, value);
+        }
+
+        /**
+         * @brief Records the upload of a value to a uniform of the current pass, patchable before each replay.
+         * @param initial Value uploaded until the slot is patched.
+         * @throws common::exception::TraceableException If no pass is used or the uniform does not exist.
+         */
+        template <ReplayableUniform T>
+        [[nodiscard]] ParameterSlot<T> parameter(const std::string &name, const T &initial)
+        {
+            return {record(name, initial)};
+        }
+
+        void enable(GLenum capability)
+        {
+            m_list.m_commands.push_back({.type = CommandType::Enable, .glEnum = capability});
+        }
+
+        void disable(GLenum capability)
+        {
+            m_list.m_commands.push_back({.type = CommandType::Disable, .glEnum = capability});
+        }
+
+        void drawArrays(GLenum mode, GLint first, GLsizei count)
+        {
+            m_list.m_commands.push_back({.type = CommandType::DrawArrays, .glEnum = mode, .object = first, .count = count});
+        }
+
+        /**
+         * @brief Records an indexed draw of a range of the index buffer of the current pass.
+         * @throws common::exception::TraceableException If no pass is used or the pass has no index buffer.
+         */
+        void drawIndexed(GLsizei firstIndex, GLsizei count, GLenum mode = GL_TRIANGLES)
+        {
+            const PassView &pass = currentPass();
+            if (!pass.hasIndices())
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::COMMAND_RECORDER::NO_INDEX_BUFFER");
+            }
+            const GLintptr indexSize = pass.getIndexType() == GL_UNSIGNED_SHORT ? 2 : 4;
+            m_list.m_commands.push_back({.type = CommandType::DrawElements,
+                                         .glEnum = mode,
+                                         .indexType = pass.getIndexType(),
+                                         .count = count,
+                                         .offset = pass.getIndexOffset() + firstIndex * indexSize});
+        }
+
+        /**
+         * @brief The commands recorded so far.
+         */
+        [[nodiscard]] const CommandList &getList() const
+        {
+            return m_list;
+        }
+
+        /**
+         * @brief Returns the recorded list and starts a new one.
+         */
+        [[nodiscard]] CommandList finish()
+        {
+            m_pass = nullptr;
+            return std::exchange(m_list, CommandList{});
+        }
+
+    private:
+        const PassView &currentPass() const
+        {
+            if (!m_pass)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::COMMAND_RECORDER::NO_PASS");
+            }
+            return *m_pass;
+        }
+
+        template <typename T>
+        GLintptr record(const std::string &name, const T &value)
+        {
+            const GLint location = currentPass().findUniform(name);
+            if (location < 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::COMMAND_RECORDER::UNIFORM_NOT_FOUND: Uniform {} not found", name));
+            }
+            m_list.append({.type = CommandType::Uniform,
+                           .glEnum = pipeline::component::uniform::OpenGLUniformSetter<T>::glType,
+                           .object = location,
+                           .count = 1},
+                          std::as_bytes(std::span(&value, 1)));
+            return m_list.m_commands.back().offset;
+        }
+
+        CommandList m_list;                     ///< List being recorded.
+        const PassView *m_pass = nullptr;       ///< Pass of the uniforms and indexed draws.
+        std::optional<PassView> m_captured;     ///< View captured by the last usePass of a pass context.
+    };
+
+    /**
+     * @brief Records one execution of a pipeline.
+     *
+     * Every pass is used once, as a frame would, so that its vertex array object is up to date, then
+     * recorded; draw is called after each pass to record its uniforms and draws.
+     */
+    inline CommandList recordPipeline(graphic::pipeline::IPipeline<graphic::api::OpenGL> &pipeline, const std::function<void(int, CommandRecorder &)> &draw)
+    {
+        CommandRecorder recorder;
+        for (int pass = 0; pass < pipeline.getPassesCount(); ++pass)
+        {
+            pipeline.use(pass);
+            recorder.usePass(*pipeline.forPass(pass)->getContext());
+            draw(pass, recorder);
+        }
+        pipeline.reset();
+        return recorder.finish();
+    }
+}
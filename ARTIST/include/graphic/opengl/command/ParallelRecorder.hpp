@@ -0,0 +1,201 @@
+/**
+ * @file ParallelRecorder.hpp
+ * @brief Command recording spread over worker threads, merged and submitted by the GL thread.
+ *
+ * Only the GL thread may call OpenGL, but preparing a frame mostly does not: culling, choosing the
+ * pass, computing uniform values and encoding the draws are plain CPU work. Worker threads record
+ * that work into command lists of their own, one per chunk of objects, reading the passes through
+ * PassView snapshots captured on the GL thread beforehand. No list is shared between threads, so
+ * recording takes no lock.
+ *
+ * Each object is recorded as a packet: the pass it is drawn with, its uniforms and its draws,
+ * under a 64-bit sort key, encoded with the draw key layout of the pipeline. Merging gathers the packets of every list, orders them by key, and
+ * drops the program and vertex array binds that repeat the previous packet: objects sharing a
+ * pass, recorded by different threads, end up bound once. The merged list is replayed on the GL
+ * thread as usual.
+ *
+ * @code
+ * const std::vector<PassView> passes = {PassView::capture(*opaque->getContext()), PassView::capture(*transparent->getContext())};
+ * const DrawKeyLayout &layout = pipeline->getContext()->getDrawKeyLayout();
+ * CommandList frame = recordParallel(pool, objects.size(), 1024, [&](ThreadCommandList &list, std::size_t first, std::size_t last)
+ *                                    {
+ *                                        for (std::size_t i = first; i < last; ++i)
+ *                                        {
+ *                                            CommandRecorder &recorder = list.beginDraw(passes[objects[i].pass], layout, {.pass = objects[i].pass, .depth = objects[i].depth});
+ *                                            recorder.uniform("model", objects[i].transform);
+ *                                            recorder.drawIndexed(objects[i].firstIndex, objects[i].indexCount);
+ *                                        }
+ *                                    });
+ * frame.replay();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <common/algorithm/RadixSort.hpp>
+#include <common/thread/ThreadPool.hpp>
+#include <graphic/opengl/command/CommandList.hpp>
+#include <graphic/opengl/command/PassView.hpp>
+#include <graphic/pipeline/DrawKey.hpp>
+
+namespace artist::graphic::opengl::command
+{
+    /**
+     * @struct DrawPacket
+     * @brief Commands of one object, from the bind of its pass to its last draw.
+     */
+    struct DrawPacket
+    {
+        std::uint64_t key = 0;     ///< Order of the packet in the merged list.
+        std::size_t first = 0;     ///< First command of the packet in its list.
+        std::size_t count = 0;     ///< Number of commands of the packet.
+    };
+
+    /**
+     * @class ThreadCommandList
+     * @brief Packets recorded by one thread.
+     */
+    class ThreadCommandList
+    {
+    public:
+        /**
+         * @brief Starts the packet of an object drawn with a pass.
+         * @param key Sort key of the packet: packets are merged by increasing key.
+         * @return The recorder to record the uniforms and draws of the object with.
+         */
+        CommandRecorder &beginDraw(const PassView &pass, std::uint64_t key)
+        {
+            closePacket();
+            m_packets.push_back({key, m_recorder.getList().getCommands().size(), 0});
+            m_recorder.usePass(pass);
+            return m_recorder;
+        }
+
+        /**
+         * @brief Starts the packet of an object, with a sort key encoded by the draw key layout of its pipeline.
+         * @param layout Draw key layout of the pipeline, read on the GL thread beforehand.
+         * @param values Pass, program, render state, material and depth of the object.
+         * @return The recorder to record the uniforms and draws of the object with.
+         */
+        CommandRecorder &beginDraw(const PassView &pass, const graphic::pipeline::DrawKeyLayout &layout, const graphic::pipeline::DrawKeyValues &values)
+        {
+            return beginDraw(pass, layout.encode(values));
+        }
+
+        /**
+         * @brief Packets recorded so far.
+         */
+        [[nodiscard]] std::span<const DrawPacket> getPackets()
+        {
+            closePacket();
+            return m_packets;
+        }
+
+        [[nodiscard]] const CommandList &getList() const
+        {
+            return m_recorder.getList();
+        }
+
+    private:
+        void closePacket()
+        {
+            if (!m_packets.empty())
+            {
+                m_packets.back().count = m_recorder.getList().getCommands().size() - m_packets.back().first;
+            }
+        }
+
+        CommandRecorder m_recorder;        ///< Commands of every packet, back to back.
+        std::vector<DrawPacket> m_packets; ///< Packets, in recording order.
+    };
+
+    /**
+     * @brief Merges the packets of several lists into one list ordered by key.
+     *
+     * Packets are radix sorted, in time linear in their number. Packets with equal keys keep the
+     * order of the lists, then their recording order. Program and vertex array binds identical to
+     * the current ones are dropped.
+     */
+    inline CommandList mergeCommandLists(std::span<ThreadCommandList> lists)
+    {
+        struct Entry
+        {
+            std::uint64_t key;
+            const CommandList *list;
+            std::size_t first;
+            std::size_t count;
+        };
+        std::size_t packetCount = 0;
+        std::size_t commandCount = 0;
+        std::size_t payloadSize = 0;
+        for (ThreadCommandList &list : lists)
+        {
+            packetCount += list.getPackets().size();
+            commandCount += list.getList().getCommands().size();
+            payloadSize += list.getList().getPayloadSize();
+        }
+        std::vector<Entry> entries;
+        entries.reserve(packetCount);
+        for (ThreadCommandList &list : lists)
+        {
+            for (const DrawPacket &packet : list.getPackets())
+            {
+                entries.push_back({packet.key, &list.getList(), packet.first, packet.count});
+            }
+        }
+        common::algorithm::radixSort(entries, [](const Entry &entry)
+                                     { return entry.key; });
+
+        CommandList merged;
+        merged.reserve(commandCount, payloadSize);
+        GLint program = -1;
+        GLint vertexArray = -1;
+        for (const Entry &entry : entries)
+        {
+            for (const Command &command : entry.list->getCommands().subspan(entry.first, entry.count))
+            {
+                if (command.type == CommandType::UseProgram)
+                {
+                    if (command.object == program)
+                    {
+                        continue;
+                    }
+                    program = command.object;
+                }
+                else if (command.type == CommandType::BindVertexArray)
+                {
+                    if (command.object == vertexArray)
+                    {
+                        continue;
+                    }
+                    vertexArray = command.object;
+                }
+                merged.append(command, entry.list->getValue(command));
+            }
+        }
+        return merged;
+    }
+
+    /**
+     * @brief Records count objects on the threads of a pool, then merges their lists.
+     *
+     * record(list, first, last) records the objects [first, last) into list. Each chunk of grain
+     * objects gets a list of its own, so the merged order does not depend on thread scheduling.
+     * The views read by record must be captured before, on the GL thread.
+     */
+    template <typename Record>
+    CommandList recordParallel(common::thread::ThreadPool &pool, std::size_t count, std::size_t grain, Record &&record)
+    {
+        grain = std::max<std::size_t>(grain, 1);
+        std::vector<ThreadCommandList> lists((count + grain - 1) / grain);
+        pool.parallelFor(count, grain, [&lists, &record, grain](std::size_t first, std::size_t last)
+                         { record(lists[first / grain], first, last); });
+        return mergeCommandLists(lists);
+    }
+}
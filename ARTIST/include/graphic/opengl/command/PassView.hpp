@@ -0,0 +1,114 @@
+/**
+ * @file PassView.hpp
+ * @brief Read-only snapshot of a loaded pass, safe to share between recording threads.
+ *
+ * A pass context is only consistent on the GL thread: using a pass rebuilds its vertex array key
+ * and may create vertex array objects, and its uniforms are reached through a map of shared_ptr.
+ * Recording commands needs none of that, only the program, the vertex array object, the index
+ * range and the location of each uniform. The view copies these once, on the GL thread, into
+ * plain values: it is never written afterwards, so any number of threads may read it at once.
+ *
+ * @code
+ * pass->use();
+ * const PassView view = PassView::capture(*pass->getContext());
+ * // on any thread:
+ * const GLint location = view.findUniform("model");
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/context/UniformContext.hpp>
+
+namespace artist::graphic::opengl::command
+{
+    /**
+     * @class PassView
+     * @brief Program, vertex array object, indices and uniform locations of a pass.
+     */
+    class PassView
+    {
+    public:
+        PassView() = default;
+
+        /**
+         * @brief Copies what recording needs from a pass, on the GL thread.
+         *
+         * The pass must have been used since its attributes last changed, so that its vertex array
+         * object exists.
+         */
+        static PassView capture(const context::OpenGLPassContext &pass)
+        {
+            PassView view;
+            view.m_program = pass.getPassID();
+            view.m_vertexArray = pass.getCurrentVertexArray();
+            if (const auto &indexBuffer = pass.getIndexBuffer())
+            {
+                view.m_indexType = indexBuffer->getIndexType();
+                view.m_indexOffset = indexBuffer->getOffset();
+            }
+            view.m_uniforms.reserve(pass.getUniforms().size());
+            for (const auto &[name, uniform] : pass.getUniforms())
+            {
+                view.m_uniforms.emplace_back(name, static_cast<GLint>(uniform->getContext()->getUniformID()));
+            }
+            std::ranges::sort(view.m_uniforms, {}, &std::pair<std::string, GLint>::first);
+            return view;
+        }
+
+        [[nodiscard]] GLuint getProgram() const
+        {
+            return m_program;
+        }
+
+        [[nodiscard]] GLuint getVertexArray() const
+        {
+            return m_vertexArray;
+        }
+
+        /**
+         * @return Whether the pass had an index buffer when captured.
+         */
+        [[nodiscard]] bool hasIndices() const
+        {
+            return m_indexType != 0;
+        }
+
+        [[nodiscard]] GLenum getIndexType() const
+        {
+            return m_indexType;
+        }
+
+        /**
+         * @brief Byte offset of the first index in the element buffer.
+         */
+        [[nodiscard]] GLintptr getIndexOffset() const
+        {
+            return m_indexOffset;
+        }
+
+        /**
+         * @return The location of a uniform, or -1 if the pass has no uniform with this name.
+         */
+        [[nodiscard]] GLint findUniform(std::string_view name) const
+        {
+            const auto it = std::ranges::lower_bound(m_uniforms, name, {}, [](const auto &uniform)
+                                                     { return std::string_view(uniform.first); });
+            return it != m_uniforms.end() && it->first == name ? it->second : -1;
+        }
+
+    private:
+        GLuint m_program = 0;                                ///< Program made current by the pass.
+        GLuint m_vertexArray = 0;                            ///< Vertex array object of the last use.
+        GLenum m_indexType = 0;                              ///< Index type, or 0 without index buffer.
+        GLintptr m_indexOffset = 0;                          ///< Offset of the first index.
+        std::vector<std::pair<std::string, GLint>> m_uniforms; ///< Uniform locations, sorted by name.
+    };
+}
@@ -2,7 +2,16 @@
 
 #pragma once
 #include <GL/glew.h>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
 #include <graphic/Api.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/UploadQueue.hpp>
+#include <graphic/opengl/buffer/UsageTracker.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+#include <graphic/opengl/layout/VertexTranscoding.hpp>
 #include <graphic/context/AttributeContext.hpp>
 
 namespace artist::graphic
@@ -17,6 +26,11 @@ namespace artist::graphic
         class OpenGLUnbinder;
     }
 
+    namespace opengl::buffer
+    {
+        class StreamingBuffer;
+    }
+
     namespace opengl::context
     {
         class OpenGLAttributeContext : public graphic::context::AttributeContext<graphic::api::OpenGL>
@@ -41,7 +55,11 @@ namespace artist::graphic
 
             GLuint getBufferID() const
             {
-                return m_bufferId;
+                if (m_streamingRange)
+                {
+                    return m_streamingRange->bufferId;
+                }
+                return m_allocation ? m_allocation->bufferId : m_bufferId;
             }
 
             void setBufferID(GLuint bufferId)
@@ -83,12 +101,267 @@ namespace artist::graphic
                 return m_usage;
             }
 
+            void setAttributeName(const std::string &name)
+            {
+                m_name = name;
+            }
+
+            const std::string &getAttributeName() const
+            {
+                return m_name;
+            }
+
+            void setNormalized(GLboolean normalized)
+            {
+                m_normalized = normalized;
+            }
+
+            GLboolean isNormalized() const
+            {
+                return m_normalized;
+            }
+
+            void setStride(GLsizei stride)
+            {
+                m_stride = stride;
+            }
+
+            GLsizei getStride() const
+            {
+                return m_stride;
+            }
+
+            void setVertexFetch(layout::VertexFetch fetch)
+            {
+                m_fetch = fetch;
+            }
+
+            layout::VertexFetch getVertexFetch() const
+            {
+                return m_fetch;
+            }
+
+            /**
+             * @brief Records the format of a vertex layout element, in vertices of the given stride.
+             */
+            void setVertexFormat(const layout::VertexElement &element, GLsizei stride)
+            {
+                m_size = static_cast<GLuint>(element.components);
+                m_type = element.glType;
+                m_normalized = element.normalized;
+                m_stride = stride;
+                m_offset = element.offset;
+                m_fetch = element.fetch;
+            }
+
+            /**
+             * @brief Whether a vertex format was recorded, by the setter or by attaching the attribute to a buffer.
+             *
+             * Until then, the size and type of the context are the ones read from the program, e.g.
+             * GL_FLOAT_VEC3, which are no vertex format.
+             */
+            bool hasVertexFormat() const
+            {
+                return m_stride != 0;
+            }
+
+            void setOffset(GLsizei offset)
+            {
+                m_offset = offset;
+            }
+
+            GLsizei getOffset() const
+            {
+                return m_offset;
+            }
+
+            void setBufferOffset(GLintptr offset)
+            {
+                m_bufferOffset = offset;
+            }
+
+            GLintptr getBufferOffset() const
+            {
+                if (m_streamingRange)
+                {
+                    return m_streamingRange->offset;
+                }
+                return m_allocation ? m_allocation->offset : m_bufferOffset;
+            }
+
+            /**
+             * @brief Makes the attribute store its values in a range of a shared buffer.
+             *
+             * While an allocation is set, the buffer ID and offset of the attribute are the ones of the allocation.
+             */
+            void setAllocation(std::shared_ptr<buffer::BufferAllocation> allocation)
+            {
+                m_allocation = std::move(allocation);
+            }
+
+            const std::shared_ptr<buffer::BufferAllocation> &getAllocation() const
+            {
+                return m_allocation;
+            }
+
+            /**
+             * @brief Sets vertices given as one array of floats per component.
+             *
+             * The components are interleaved into vertices of T held by the context, with the SIMD
+             * kernels of layout::interleave, and set as the values to upload. The arrays only need to
+             * outlive this call.
+             *
+             * @tparam T The type of one vertex, made of floats.
+             * @param components One array of count floats per component of T, in layout order.
+             * @param count Number of vertices.
+             */
+            template <typename T>
+            void setComponents(std::span<const float *const> components, std::size_t count)
+            {
+                m_interleavedData.resize(count * layout::VertexLayout<T>::stride);
+                layout::interleaveVertices<T>(components, count, m_interleavedData);
+                setValues<T>(std::span<const T>(reinterpret_cast<const T *>(m_interleavedData.data()), count));
+            }
+
+            /**
+             * @brief Storage of the values once encoded into a compressed type, reused across uploads.
+             */
+            std::vector<std::byte> &getEncodedData()
+            {
+                return m_encodedData;
+            }
+
+            void setEncodedType(GLenum type)
+            {
+                m_encodedType = type;
+            }
+
+            /**
+             * @brief Type of the values held by the encoded copy, GL_NONE until the first encoding.
+             */
+            GLenum getEncodedType() const
+            {
+                return m_encodedType;
+            }
+
+            void setBufferSize(GLsizeiptr size)
+            {
+                m_bufferSize = size;
+            }
+
+            GLsizeiptr getBufferSize() const
+            {
+                return m_bufferSize;
+            }
+
+            /**
+             * @brief Makes the setter upload the values through an upload queue instead of synchronously.
+             */
+            void setUploadQueue(std::shared_ptr<buffer::UploadQueue> uploadQueue)
+            {
+                m_uploadQueue = std::move(uploadQueue);
+            }
+
+            const std::shared_ptr<buffer::UploadQueue> &getUploadQueue() const
+            {
+                return m_uploadQueue;
+            }
+
+            void setUploadCompletion(std::shared_future<void> completion)
+            {
+                m_uploadCompletion = std::move(completion);
+            }
+
+            /**
+             * @brief Completion of the last queued upload. Uploads complete in order, so earlier ones are done too.
+             */
+            const std::shared_future<void> &getUploadCompletion() const
+            {
+                return m_uploadCompletion;
+            }
+
+            /**
+             * @brief Lets the setter migrate the buffer to the update strategy matching the observed uploads.
+             *
+             * Enabled by default. Disabled, the buffer keeps the usage hint set on the context.
+             */
+            void setAdaptiveUsage(bool adaptive)
+            {
+                m_adaptiveUsage = adaptive;
+            }
+
+            bool isAdaptiveUsage() const
+            {
+                return m_adaptiveUsage;
+            }
+
+            buffer::UsageTracker &getUsageTracker()
+            {
+                return m_usageTracker;
+            }
+
+            void setUpdateStrategy(buffer::UpdateStrategy strategy)
+            {
+                m_updateStrategy = strategy;
+            }
+
+            /**
+             * @brief Strategy the buffer has been migrated to.
+             */
+            buffer::UpdateStrategy getUpdateStrategy() const
+            {
+                return m_updateStrategy;
+            }
+
+            void setStreamingBuffer(std::shared_ptr<buffer::StreamingBuffer> streamingBuffer)
+            {
+                m_streamingBuffer = std::move(streamingBuffer);
+            }
+
+            const std::shared_ptr<buffer::StreamingBuffer> &getStreamingBuffer() const
+            {
+                return m_streamingBuffer;
+            }
+
+            /**
+             * @brief Makes the attribute read its values from a region of its streaming buffer.
+             *
+             * While a streaming range is set, the buffer ID and offset of the attribute are the ones of the range.
+             */
+            void setStreamingRange(std::shared_ptr<buffer::BufferAllocation> range)
+            {
+                m_streamingRange = std::move(range);
+            }
+
+            const std::shared_ptr<buffer::BufferAllocation> &getStreamingRange() const
+            {
+                return m_streamingRange;
+            }
+
         private:
-            GLuint m_attributeId; ///< OpenGL attribute ID
-            GLuint m_size;        ///< The size of the attribute variable.
-            GLenum m_type;        ///< The type of the attribute variable.
-            GLuint m_bufferId;    ///< OpenGL VBO buffer ID
-            GLenum m_usage;       ///< The drawing mode of the attribute variable.
+            GLuint m_attributeId = 0;                                                    ///< OpenGL attribute ID
+            GLuint m_size = 0;                                                           ///< The size of the attribute variable.
+            GLenum m_type = GL_FLOAT;                                                    ///< The type of the attribute variable.
+            GLuint m_bufferId = 0;                                                       ///< OpenGL VBO buffer ID
+            GLenum m_usage = GL_STATIC_DRAW;                                             ///< The drawing mode of the attribute variable.
+            std::string m_name;                                                          ///< The name of the attribute in the shader.
+            GLboolean m_normalized = GL_FALSE;                                           ///< Whether integer data is normalized when fetched.
+            GLsizei m_stride = 0;                                                        ///< Byte stride between two consecutive vertices.
+            GLsizei m_offset = 0;                                                        ///< Byte offset of the attribute inside one vertex.
+            layout::VertexFetch m_fetch = layout::VertexFetch::Float;                    ///< How the shader receives the components.
+            GLsizeiptr m_bufferSize = 0;                                                 ///< Size of the data store allocated for the VBO.
+            GLintptr m_bufferOffset = 0;                                                 ///< Byte offset of the first vertex in the VBO.
+            std::shared_ptr<buffer::BufferAllocation> m_allocation;                      ///< Range of a shared VBO holding the values.
+            std::vector<std::byte> m_encodedData;                                        ///< Values encoded into a compressed type.
+            std::vector<std::byte> m_interleavedData;                                    ///< Vertices interleaved from component arrays.
+            GLenum m_encodedType = GL_NONE;                                              ///< Type of the values in m_encodedData.
+            std::shared_ptr<buffer::UploadQueue> m_uploadQueue;                          ///< Queue of asynchronous uploads, if any.
+            std::shared_future<void> m_uploadCompletion;                                 ///< Completion of the last queued upload.
+            bool m_adaptiveUsage = true;                                                 ///< Whether the update strategy follows the observed uploads.
+            buffer::UsageTracker m_usageTracker;                                         ///< Observed uploads of the VBO.
+            buffer::UpdateStrategy m_updateStrategy = buffer::UpdateStrategy::Undecided; ///< Strategy the VBO has been migrated to.
+            std::shared_ptr<buffer::StreamingBuffer> m_streamingBuffer;                  ///< Persistently mapped regions of a streamed attribute.
+            std::shared_ptr<buffer::BufferAllocation> m_streamingRange;                  ///< Region holding the last streamed values.
         };
     }
 }
\ No newline at end of file
@@ -3,8 +3,15 @@
 #pragma once
 
 #include <GL/glew.h>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include <graphic/Api.hpp>
+#include <graphic/geometry/Lod.hpp>
 #include <graphic/context/PassContext.hpp>
+#include <graphic/opengl/layout/VertexArrayKey.hpp>
+#include <graphic/opengl/buffer/IndexBuffer.hpp>
 
 namespace artist::graphic
 {
@@ -22,6 +29,8 @@ namespace artist::graphic
         class OpenGLPassAttributeReader;
         template <auto PROFILE>
         class OpenGLPassUser;
+        template <auto PROFILE>
+        class OpenGLPassVertexArrayBinder;
     }
 
     namespace opengl::context
@@ -49,6 +58,8 @@ namespace artist::graphic
             using AttributeReader = opengl::pipeline::component::pass::OpenGLPassAttributeReader<PROFILE>;
             template <auto PROFILE>
             using User = opengl::pipeline::component::pass::OpenGLPassUser<PROFILE>;
+            template <auto PROFILE>
+            using VertexArrayBinder = opengl::pipeline::component::pass::OpenGLPassVertexArrayBinder<PROFILE>;
 
             void setPassID(GLuint passID)
             {
@@ -60,8 +71,133 @@ namespace artist::graphic
                 return m_passID;
             }
 
+            /**
+             * @brief Get the vertex array object cached for the given attribute bindings.
+             * @param key Attribute bindings of the pass.
+             * @return The vertex array object, or 0 if none has been created yet.
+             */
+            GLuint findVertexArray(const layout::VertexArrayKey &key) const
+            {
+                if (auto it = m_vertexArrays.find(key); it != m_vertexArrays.end())
+                {
+                    return it->second;
+                }
+                return 0;
+            }
+
+            void addVertexArray(const layout::VertexArrayKey &key, GLuint vertexArray)
+            {
+                m_vertexArrays[key] = vertexArray;
+            }
+
+            const std::unordered_map<layout::VertexArrayKey, GLuint, layout::VertexArrayKeyHash> &getVertexArrays() const
+            {
+                return m_vertexArrays;
+            }
+
+            void clearVertexArrays()
+            {
+                m_vertexArrays.clear();
+                m_vertexArrayKey.clear();
+                m_currentVertexArray = 0;
+            }
+
+            /**
+             * @brief Removes the vertex array objects whose key matches a predicate from the cache.
+             * @return The removed vertex array objects, for the caller to delete.
+             */
+            template <typename Predicate>
+            std::vector<GLuint> removeVertexArrays(Predicate predicate)
+            {
+                std::vector<GLuint> removed;
+                for (auto it = m_vertexArrays.begin(); it != m_vertexArrays.end();)
+                {
+                    if (predicate(it->first))
+                    {
+                        removed.push_back(it->second);
+                        if (it->second == m_currentVertexArray)
+                        {
+                            m_currentVertexArray = 0;
+                        }
+                        it = m_vertexArrays.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                return removed;
+            }
+
+            /**
+             * @brief Epoch of buffer::BufferNames the vertex array cache has evicted released buffers up to.
+             */
+            std::uint64_t getBufferEpoch() const
+            {
+                return m_bufferEpoch;
+            }
+
+            void setBufferEpoch(std::uint64_t epoch)
+            {
+                m_bufferEpoch = epoch;
+            }
+
+            /**
+             * @brief Scratch key reused across frames to avoid reallocating it on every use.
+             */
+            layout::VertexArrayKey &getVertexArrayKey()
+            {
+                return m_vertexArrayKey;
+            }
+
+            void setCurrentVertexArray(GLuint vertexArray)
+            {
+                m_currentVertexArray = vertexArray;
+            }
+
+            GLuint getCurrentVertexArray() const
+            {
+                return m_currentVertexArray;
+            }
+
+            /**
+             * @brief Sets the indices used by the indexed draws of the pass.
+             *
+             * The index buffer is captured by the vertex array object bound when the pass is used.
+             */
+            void setIndexBuffer(std::shared_ptr<buffer::IndexBuffer> indexBuffer)
+            {
+                m_indexBuffer = std::move(indexBuffer);
+            }
+
+            const std::shared_ptr<buffer::IndexBuffer> &getIndexBuffer() const
+            {
+                return m_indexBuffer;
+            }
+
+            /**
+             * @brief Sets how the errors of levels of detail drawn through the pass project on screen.
+             *
+             * Update it with the camera field of view and the viewport height of the pass.
+             */
+            void setLodProjection(const geometry::LodProjection &projection)
+            {
+                m_lodProjection = projection;
+            }
+
+            const geometry::LodProjection &getLodProjection() const
+            {
+                return m_lodProjection;
+            }
+
         private:
-            GLuint m_passID; // OpenGL pipeline ID
+            GLuint m_passID = 0; // OpenGL pipeline ID
+            std::unordered_map<layout::VertexArrayKey, GLuint, layout::VertexArrayKeyHash> m_vertexArrays; ///< Vertex array objects by attribute bindings
+            layout::VertexArrayKey m_vertexArrayKey;                                                       ///< Attribute bindings of the last use
+            GLuint m_currentVertexArray = 0;                                                               ///< Vertex array object of the last use
+            std::uint64_t m_bufferEpoch = 0;                                                               ///< Buffer releases already evicted from the cache
+            std::shared_ptr<buffer::IndexBuffer> m_indexBuffer;                                            ///< Indices of the indexed draws
+            geometry::LodProjection m_lodProjection;                                                       ///< Projection of level of detail errors on screen
         };
     }
 }
\ No newline at end of file
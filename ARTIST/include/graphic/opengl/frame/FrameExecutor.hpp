@@ -0,0 +1,221 @@
+/**
+ * @file FrameExecutor.hpp
+ * @brief Runs frames with a bounded number of frames in flight, paced by GPU fences.
+ *
+ * Without pacing, a render loop either calls glFinish and keeps the CPU idle while the GPU renders,
+ * or lets the CPU queue frames until the driver blocks somewhere unpredictable. The executor keeps
+ * a ring of N fences, one per frame in flight: frame i ends with a fence in slot i % N, and frame
+ * i + N waits on that fence before it starts. The CPU thus records frame i + 1 while the GPU renders
+ * frame i, and only blocks when it is N frames ahead. The time spent blocked is reported, to tell
+ * GPU-bound frames from CPU-bound ones.
+ *
+ * Per-frame resources, such as streaming buffers and timer query pools, are tracked by the executor:
+ * their beginFrame is called once the slot is free, and their endFrame before the slot is fenced, so
+ * they rotate in lockstep with the fences.
+ *
+ * @code
+ * FrameExecutor frames(2);
+ * StreamingBuffer particles(64 * 1024, frames.getFramesInFlight());
+ * frames.track(particles);
+ * while (running)
+ * {
+ *     frames.execute(*pipeline, [&](int pass) { drawPass(pass); });
+ *     swapBuffers();
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/pipeline/Pipeline.hpp>
+
+namespace artist::graphic::opengl::frame
+{
+    /**
+     * @brief A resource with one copy per frame in flight, rotated at frame boundaries.
+     */
+    template <typename T>
+    concept FrameResource = requires(T resource) {
+        resource.beginFrame();
+        resource.endFrame();
+    };
+
+    /**
+     * @class FrameExecutor
+     * @brief Ring of fences bounding how far the CPU runs ahead of the GPU.
+     */
+    class FrameExecutor
+    {
+    public:
+        static constexpr GLuint64 WAIT_TIMEOUT = 1'000'000; ///< Nanoseconds waited per glClientWaitSync call.
+
+        /**
+         * @param framesInFlight Number of frames the GPU may have queued while the CPU records the next one.
+         */
+        explicit FrameExecutor(std::size_t framesInFlight = 2) : m_fences(framesInFlight, nullptr)
+        {
+            if (framesInFlight == 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::FRAME_EXECUTOR::NO_FRAME_IN_FLIGHT");
+            }
+        }
+
+        FrameExecutor(const FrameExecutor &) = delete;
+        FrameExecutor &operator=(const FrameExecutor &) = delete;
+
+        ~FrameExecutor()
+        {
+            for (GLsync fence : m_fences)
+            {
+                if (fence)
+                {
+                    glDeleteSync(fence);
+                }
+            }
+        }
+
+        /**
+         * @brief Rotates a per-frame resource with the frames. The resource must outlive the executor.
+         * @throws common::exception::TraceableException If the resource has a number of regions other
+         *         than the number of frames in flight.
+         */
+        template <FrameResource R>
+        void track(R &resource)
+        {
+            if constexpr (requires { resource.getRegionCount(); })
+            {
+                if (resource.getRegionCount() != m_fences.size())
+                {
+                    throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::FRAME_EXECUTOR::RING_MISMATCH: The resource has {} regions for {} frames in flight", resource.getRegionCount(), m_fences.size()));
+                }
+            }
+            m_resources.push_back({[&resource]
+                                   { resource.beginFrame(); },
+                                   [&resource]
+                                   { resource.endFrame(); }});
+        }
+
+        /**
+         * @brief Starts a frame, waiting for the GPU only if every frame slot is still in flight.
+         * @return The slot of the frame, to index per-frame data.
+         * @throws common::exception::TraceableException If waiting on the fence fails.
+         */
+        std::size_t beginFrame()
+        {
+            GLsync &fence = m_fences[m_slot];
+            m_lastWaitTime = std::chrono::nanoseconds::zero();
+            if (fence)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                // Flush only on the first call: later calls would flush nothing new
+                GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+                while (status == GL_TIMEOUT_EXPIRED)
+                {
+                    status = glClientWaitSync(fence, 0, WAIT_TIMEOUT);
+                }
+                m_lastWaitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                m_totalWaitTime += m_lastWaitTime;
+                glDeleteSync(fence);
+                fence = nullptr;
+                if (status == GL_WAIT_FAILED)
+                {
+                    throw common::exception::TraceableException<std::runtime_error>("ERROR::FRAME_EXECUTOR::WAIT_FAILED");
+                }
+            }
+            for (const Resource &resource : m_resources)
+            {
+                resource.begin();
+            }
+            return m_slot;
+        }
+
+        /**
+         * @brief Ends the frame: rotates the resources and fences the commands of the frame.
+         */
+        void endFrame()
+        {
+            for (const Resource &resource : m_resources)
+            {
+                resource.end();
+            }
+            m_fences[m_slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            m_slot = (m_slot + 1) % m_fences.size();
+            ++m_frameCount;
+        }
+
+        /**
+         * @brief Runs one frame: record is called with the slot of the frame, between beginFrame and endFrame.
+         */
+        template <typename Record>
+        void execute(Record &&record)
+        {
+            const std::size_t slot = beginFrame();
+            record(slot);
+            endFrame();
+        }
+
+        /**
+         * @brief Runs one frame of a pipeline: every pass is used in order, then draw is called for it.
+         */
+        template <typename API>
+        void execute(graphic::pipeline::IPipeline<API> &pipeline, const std::function<void(int)> &draw)
+        {
+            execute([&pipeline, &draw](std::size_t)
+                    {
+                        for (int pass = 0; pass < pipeline.getPassesCount(); ++pass)
+                        {
+                            pipeline.use(pass);
+                            draw(pass);
+                        }
+                        pipeline.reset(); });
+        }
+
+        [[nodiscard]] std::size_t getFramesInFlight() const
+        {
+            return m_fences.size();
+        }
+
+        /**
+         * @brief Time the CPU spent waiting for the GPU at the start of the last frame.
+         */
+        [[nodiscard]] std::chrono::nanoseconds getLastWaitTime() const
+        {
+            return m_lastWaitTime;
+        }
+
+        /**
+         * @brief Time the CPU spent waiting for the GPU since the executor was created.
+         */
+        [[nodiscard]] std::chrono::nanoseconds getTotalWaitTime() const
+        {
+            return m_totalWaitTime;
+        }
+
+        [[nodiscard]] std::uint64_t getFrameCount() const
+        {
+            return m_frameCount;
+        }
+
+    private:
+        struct Resource
+        {
+            std::function<void()> begin; ///< Calls beginFrame on the resource.
+            std::function<void()> end;   ///< Calls endFrame on the resource.
+        };
+
+        std::vector<GLsync> m_fences;                     ///< Fence of the last frame of each slot.
+        std::vector<Resource> m_resources;                ///< Per-frame resources rotated with the frames.
+        std::size_t m_slot = 0;                           ///< Slot of the current frame.
+        std::uint64_t m_frameCount = 0;                   ///< Frames ended so far.
+        std::chrono::nanoseconds m_lastWaitTime{0};       ///< Wait at the start of the last frame.
+        std::chrono::nanoseconds m_totalWaitTime{0};      ///< Sum of every wait.
+    };
+}
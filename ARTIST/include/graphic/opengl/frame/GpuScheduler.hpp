@@ -0,0 +1,487 @@
+/**
+ * @file GpuScheduler.hpp
+ * @brief Coroutines suspended on GPU fences, query results and async loads, resumed by the GL thread.
+ *
+ * Reading back a buffer, a query result or the outcome of an async load means waiting for the GPU
+ * or another thread. Waiting right away stalls the frame; polling by hand spreads the dependent
+ * work over callbacks and flags around IPipeline::useNext. Written as a GpuTask coroutine, that
+ * work co_awaits what it needs instead: the coroutine suspends, and the scheduler resumes it from
+ * poll(), called on the GL thread once per frame or whenever convenient, as soon as a zero-timeout
+ * check reports the awaited data ready. Nothing ever blocks.
+ *
+ * GL state is not preserved across a suspension: other tasks and the frame itself run in between,
+ * so a task binds again what it uses after a co_await.
+ *
+ * @code
+ * GpuTask<> buildHistogram(GpuScheduler &scheduler, GLuint timer, std::future<Mesh> loading)
+ * {
+ *     histogramPass->use();
+ *     glDispatchCompute(64, 1, 1);
+ *     co_await scheduler.fence();
+ *     const GLuint64 elapsed = co_await scheduler.query(timer);
+ *     const Mesh mesh = co_await scheduler.ready(std::move(loading));
+ *     readback(histogram, mesh, elapsed);
+ * }
+ *
+ * scheduler.spawn(buildHistogram(scheduler, timer, std::move(loading)));
+ * // each frame, on the GL thread:
+ * scheduler.poll();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/pipeline/Pipeline.hpp>
+
+namespace artist::graphic::opengl::frame
+{
+    namespace detail
+    {
+        /**
+         * @brief Result storage of a task promise, returning a value.
+         */
+        template <typename T>
+        struct GpuTaskResult
+        {
+            std::optional<T> value; ///< Value given to co_return.
+
+            void return_value(T result)
+            {
+                value = std::move(result);
+            }
+
+            T take()
+            {
+                return std::move(*value);
+            }
+        };
+
+        /**
+         * @brief Result storage of a task promise, returning nothing.
+         */
+        template <>
+        struct GpuTaskResult<void>
+        {
+            void return_void() {}
+
+            void take() {}
+        };
+    }
+
+    /**
+     * @class GpuTask
+     * @brief Coroutine run by a GpuScheduler, or awaited by another task.
+     *
+     * A task starts suspended. It runs once spawned on a scheduler, or once co_awaited by a running
+     * task, which then resumes when the task returns. Exceptions propagate to the awaiting task, or
+     * out of GpuScheduler::poll for spawned tasks.
+     */
+    template <typename T = void>
+    class [[nodiscard]] GpuTask
+    {
+    public:
+        struct promise_type : detail::GpuTaskResult<T>
+        {
+            std::coroutine_handle<> continuation; ///< Task awaiting this one, resumed when it returns.
+            std::exception_ptr error;             ///< Exception the task exited with.
+
+            GpuTask get_return_object()
+            {
+                return GpuTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            auto final_suspend() noexcept
+            {
+                struct Continue
+                {
+                    bool await_ready() noexcept
+                    {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                    {
+                        const std::coroutine_handle<> continuation = handle.promise().continuation;
+                        return continuation ? continuation : std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept {}
+                };
+                return Continue{};
+            }
+
+            void unhandled_exception()
+            {
+                error = std::current_exception();
+            }
+        };
+
+        GpuTask(GpuTask &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+        GpuTask &operator=(GpuTask &&other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~GpuTask()
+        {
+            destroy();
+        }
+
+        [[nodiscard]] bool done() const
+        {
+            return !m_handle || m_handle.done();
+        }
+
+        /**
+         * @brief Runs the task until its first suspension, then resumes the awaiting task when it returns.
+         */
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                std::coroutine_handle<promise_type> handle; ///< The awaited task.
+
+                bool await_ready() noexcept
+                {
+                    return handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                T await_resume()
+                {
+                    if (handle.promise().error)
+                    {
+                        std::rethrow_exception(handle.promise().error);
+                    }
+                    return handle.promise().take();
+                }
+            };
+            return Awaiter{m_handle};
+        }
+
+    private:
+        friend class GpuScheduler;
+
+        explicit GpuTask(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+        void destroy()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_handle; ///< The coroutine, owned.
+    };
+
+    /**
+     * @class GpuScheduler
+     * @brief Resumes suspended tasks on the GL thread once what they await is ready.
+     *
+     * Every method must be called on the GL thread. Awaitables returned by fence, wait, query and
+     * ready must be co_awaited by a task of the same scheduler.
+     */
+    class GpuScheduler
+    {
+    public:
+        /**
+         * @brief Awaitable resumed once a zero-timeout check reports it ready.
+         */
+        class Awaitable
+        {
+        public:
+            explicit Awaitable(GpuScheduler &scheduler) : m_scheduler(&scheduler) {}
+
+            Awaitable(const Awaitable &) = delete;
+            Awaitable &operator=(const Awaitable &) = delete;
+
+            bool await_ready()
+            {
+                return isReady();
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                m_scheduler->m_waiters.push_back({this, handle});
+            }
+
+        protected:
+            virtual ~Awaitable() = default;
+
+            /**
+             * @return Whether the awaited data is ready, without waiting.
+             */
+            virtual bool isReady() = 0;
+
+        private:
+            friend class GpuScheduler;
+
+            GpuScheduler *m_scheduler; ///< Scheduler polling the awaitable.
+        };
+
+        /**
+         * @brief Awaits a fence, optionally owned and deleted with the awaitable.
+         */
+        class FenceAwaitable final : public Awaitable
+        {
+        public:
+            FenceAwaitable(GpuScheduler &scheduler, GLsync fence, bool owned) : Awaitable(scheduler), m_fence(fence), m_owned(owned) {}
+
+            ~FenceAwaitable() override
+            {
+                if (m_owned && m_fence)
+                {
+                    glDeleteSync(m_fence);
+                }
+            }
+
+            /**
+             * @throws common::exception::TraceableException If waiting on the fence failed.
+             */
+            void await_resume() const
+            {
+                if (m_status == GL_WAIT_FAILED)
+                {
+                    throw common::exception::TraceableException<std::runtime_error>("ERROR::GPU_SCHEDULER::WAIT_FAILED");
+                }
+            }
+
+        protected:
+            bool isReady() override
+            {
+                // Flush on the first check only, so that the fence reaches the GPU and may signal
+                m_status = glClientWaitSync(m_fence, m_flushed ? 0 : GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+                m_flushed = true;
+                return m_status != GL_TIMEOUT_EXPIRED;
+            }
+
+        private:
+            GLsync m_fence;                       ///< The awaited fence.
+            bool m_owned;                         ///< Whether the fence is deleted with the awaitable.
+            bool m_flushed = false;               ///< Whether the fence was flushed already.
+            GLenum m_status = GL_TIMEOUT_EXPIRED; ///< Result of the last check.
+        };
+
+        /**
+         * @brief Awaits the result of a query, returned by co_await.
+         */
+        class QueryAwaitable final : public Awaitable
+        {
+        public:
+            QueryAwaitable(GpuScheduler &scheduler, GLuint query) : Awaitable(scheduler), m_query(query) {}
+
+            GLuint64 await_resume() const
+            {
+                GLuint64 result = 0;
+                glGetQueryObjectui64v(m_query, GL_QUERY_RESULT, &result);
+                return result;
+            }
+
+        protected:
+            bool isReady() override
+            {
+                GLuint available = GL_FALSE;
+                glGetQueryObjectuiv(m_query, GL_QUERY_RESULT_AVAILABLE, &available);
+                return available != GL_FALSE;
+            }
+
+        private:
+            GLuint m_query; ///< The awaited query.
+        };
+
+        /**
+         * @brief Awaits a future, whose value or exception is returned by co_await.
+         */
+        template <typename T>
+        class FutureAwaitable final : public Awaitable
+        {
+        public:
+            FutureAwaitable(GpuScheduler &scheduler, std::future<T> future) : Awaitable(scheduler), m_future(std::move(future)) {}
+
+            T await_resume()
+            {
+                return m_future.get();
+            }
+
+        protected:
+            bool isReady() override
+            {
+                return m_future.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+            }
+
+        private:
+            std::future<T> m_future; ///< The awaited future.
+        };
+
+        GpuScheduler() = default;
+
+        GpuScheduler(const GpuScheduler &) = delete;
+        GpuScheduler &operator=(const GpuScheduler &) = delete;
+
+        /**
+         * @brief Runs a task until its first suspension, and keeps it until it returns.
+         * @throws Any exception the task exited with, if it returned without suspending.
+         */
+        void spawn(GpuTask<> task)
+        {
+            const auto handle = task.m_handle;
+            m_tasks.push_back(std::move(task));
+            handle.resume();
+            collect();
+        }
+
+        /**
+         * @brief Resumes every task whose awaited data is ready, once.
+         * @return The number of tasks resumed.
+         * @throws Any exception a spawned task exited with. Other tasks are unaffected.
+         */
+        std::size_t poll()
+        {
+            std::vector<Waiter> waiters = std::exchange(m_waiters, {});
+            m_waiters.reserve(waiters.size());
+            std::size_t resumed = 0;
+            for (const Waiter &waiter : waiters)
+            {
+                if (waiter.awaitable->isReady())
+                {
+                    waiter.handle.resume();
+                    ++resumed;
+                }
+                else
+                {
+                    m_waiters.push_back(waiter);
+                }
+            }
+            collect();
+            return resumed;
+        }
+
+        /**
+         * @brief Inserts a fence after the commands issued so far, and returns an awaitable for it.
+         */
+        FenceAwaitable fence()
+        {
+            return {*this, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), true};
+        }
+
+        /**
+         * @brief Awaits a fence owned by the caller, which must not delete it before it is signaled.
+         */
+        FenceAwaitable wait(GLsync fence)
+        {
+            return {*this, fence, false};
+        }
+
+        /**
+         * @brief Awaits the result of an ended query.
+         */
+        QueryAwaitable query(GLuint query)
+        {
+            return {*this, query};
+        }
+
+        /**
+         * @brief Awaits a future, typically completed by a loading or uploading thread.
+         */
+        template <typename T>
+        FutureAwaitable<T> ready(std::future<T> future)
+        {
+            return {*this, std::move(future)};
+        }
+
+        /**
+         * @return The number of spawned tasks that have not returned yet.
+         */
+        [[nodiscard]] std::size_t getTaskCount() const
+        {
+            return m_tasks.size();
+        }
+
+        /**
+         * @return The number of tasks suspended on an awaitable.
+         */
+        [[nodiscard]] std::size_t getWaitingCount() const
+        {
+            return m_waiters.size();
+        }
+
+    private:
+        struct Waiter
+        {
+            Awaitable *awaitable;          ///< Awaitable checked by poll, in the frame of the suspended task.
+            std::coroutine_handle<> handle; ///< Task resumed once the awaitable is ready.
+        };
+
+        /**
+         * @brief Drops returned tasks, then rethrows the first exception one of them exited with.
+         */
+        void collect()
+        {
+            std::exception_ptr error;
+            std::erase_if(m_tasks, [&error](const GpuTask<> &task)
+                          {
+                              if (!task.done())
+                              {
+                                  return false;
+                              }
+                              if (!error)
+                              {
+                                  error = task.m_handle.promise().error;
+                              }
+                              return true; });
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        std::vector<GpuTask<>> m_tasks;  ///< Spawned tasks not returned yet.
+        std::vector<Waiter> m_waiters;   ///< Suspended tasks and what they await.
+    };
+
+    /**
+     * @brief Runs every pass of a pipeline as a task: each pass is used, then step(pass) is awaited.
+     *
+     * A step that suspends delays the next passes, not the frame: they run once it returns. The
+     * pipeline is reset after the last pass. Since other work runs while a step is suspended, a
+     * step uses its pass again after a co_await before drawing with it.
+     */
+    template <typename API, typename Step>
+    GpuTask<> executePipeline(graphic::pipeline::IPipeline<API> &pipeline, Step step)
+    {
+        for (int pass = 0; pass < pipeline.getPassesCount(); ++pass)
+        {
+            pipeline.use(pass);
+            co_await step(pass);
+        }
+        pipeline.reset();
+    }
+}
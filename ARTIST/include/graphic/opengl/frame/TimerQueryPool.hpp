@@ -0,0 +1,97 @@
+/**
+ * @file TimerQueryPool.hpp
+ * @brief Ring of GL_TIME_ELAPSED queries measuring the GPU time of each frame without stalling.
+ *
+ * Reading a query right after its frame waits for the GPU to finish that frame. The pool keeps one
+ * query per frame in flight instead, and reads the result of a query only when its slot comes back,
+ * once the frame executor has waited on the fence of the frame that used it: the result is ready.
+ *
+ * @code
+ * FrameExecutor frames(2);
+ * TimerQueryPool gpuTimer(2);
+ * frames.track(gpuTimer);
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::opengl::frame
+{
+    /**
+     * @class TimerQueryPool
+     * @brief GPU timer queries used round-robin, one per frame in flight.
+     */
+    class TimerQueryPool
+    {
+    public:
+        /**
+         * @param slotCount Number of frames in flight.
+         */
+        explicit TimerQueryPool(std::size_t slotCount = 2) : m_queries(slotCount, 0), m_pending(slotCount, false)
+        {
+            if (slotCount == 0)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::TIMER_QUERY_POOL::EMPTY");
+            }
+            glGenQueries(static_cast<GLsizei>(slotCount), m_queries.data());
+        }
+
+        TimerQueryPool(const TimerQueryPool &) = delete;
+        TimerQueryPool &operator=(const TimerQueryPool &) = delete;
+
+        ~TimerQueryPool()
+        {
+            glDeleteQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data());
+        }
+
+        /**
+         * @brief Collects the time of the last frame that used the slot, then starts timing a new one.
+         */
+        void beginFrame()
+        {
+            if (m_pending[m_slot])
+            {
+                GLuint64 nanoseconds = 0;
+                glGetQueryObjectui64v(m_queries[m_slot], GL_QUERY_RESULT, &nanoseconds);
+                m_lastGpuTime = std::chrono::nanoseconds(nanoseconds);
+                m_pending[m_slot] = false;
+            }
+            glBeginQuery(GL_TIME_ELAPSED, m_queries[m_slot]);
+        }
+
+        /**
+         * @brief Stops timing the frame and moves to the next slot.
+         */
+        void endFrame()
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            m_pending[m_slot] = true;
+            m_slot = (m_slot + 1) % m_queries.size();
+        }
+
+        /**
+         * @brief GPU time of the most recent frame whose result was collected, frames in flight ago.
+         */
+        [[nodiscard]] std::chrono::nanoseconds getLastGpuTime() const
+        {
+            return m_lastGpuTime;
+        }
+
+        [[nodiscard]] std::size_t getRegionCount() const
+        {
+            return m_queries.size();
+        }
+
+    private:
+        std::vector<GLuint> m_queries;                ///< OpenGL query IDs, one per slot.
+        std::vector<bool> m_pending;                  ///< Whether each query holds an uncollected result.
+        std::size_t m_slot = 0;                       ///< Slot of the current frame.
+        std::chrono::nanoseconds m_lastGpuTime{0};    ///< Last collected GPU time.
+    };
+}
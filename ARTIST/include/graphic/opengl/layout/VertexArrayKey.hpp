@@ -0,0 +1,95 @@
+/**
+ * @file VertexArrayKey.hpp
+ * @brief Identifies a vertex array object by the attribute formats and buffers it captures.
+ *
+ * A vertex array object records, for each enabled attribute, the buffer it reads from and the format
+ * given to glVertexAttrib*Pointer, plus the bound index buffer. Two draws with the same key can share
+ * the same vertex array object.
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+
+namespace artist::graphic::opengl::layout
+{
+    /**
+     * @struct VertexBinding
+     * @brief Format and source buffer of one attribute inside a vertex array object.
+     */
+    struct VertexBinding
+    {
+        GLuint attributeId;   ///< Attribute location in the program.
+        GLuint bufferId;      ///< Buffer the attribute reads from.
+        GLint components;     ///< Number of components.
+        GLenum glType;        ///< OpenGL component type.
+        GLboolean normalized; ///< Whether integer data is normalized when fetched.
+        GLsizei stride;       ///< Byte stride between two vertices.
+        GLintptr offset;      ///< Byte offset of the attribute's first value in the buffer.
+        VertexFetch fetch;    ///< How the shader receives the components.
+
+        bool operator==(const VertexBinding &other) const = default;
+    };
+
+    /**
+     * @struct VertexArrayKey
+     * @brief Vertex bindings of a pass, sorted by attribute location, and its index buffer.
+     */
+    struct VertexArrayKey
+    {
+        std::vector<VertexBinding> bindings; ///< Attribute bindings sorted by location.
+        GLuint elementBufferId = 0;          ///< Index buffer captured by the vertex array object, 0 if none.
+
+        bool operator==(const VertexArrayKey &other) const = default;
+
+        void clear()
+        {
+            bindings.clear();
+            elementBufferId = 0;
+        }
+
+        /**
+         * @brief Checks whether the vertex array object reads from one of the given buffers.
+         */
+        [[nodiscard]] bool references(std::span<const GLuint> bufferIds) const
+        {
+            if (std::ranges::find(bufferIds, elementBufferId) != bufferIds.end())
+            {
+                return true;
+            }
+            return std::ranges::any_of(bindings, [bufferIds](const VertexBinding &binding)
+                                       { return std::ranges::find(bufferIds, binding.bufferId) != bufferIds.end(); });
+        }
+    };
+
+    struct VertexArrayKeyHash
+    {
+        std::size_t operator()(const VertexArrayKey &key) const noexcept
+        {
+            std::size_t seed = key.bindings.size();
+            auto combine = [&seed](std::size_t value)
+            {
+                seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+            };
+            combine(std::hash<GLuint>{}(key.elementBufferId));
+            for (const auto &binding : key.bindings)
+            {
+                combine(std::hash<GLuint>{}(binding.attributeId));
+                combine(std::hash<GLuint>{}(binding.bufferId));
+                combine(std::hash<GLint>{}(binding.components));
+                combine(std::hash<GLenum>{}(binding.glType));
+                combine(std::hash<GLboolean>{}(binding.normalized));
+                combine(std::hash<GLsizei>{}(binding.stride));
+                combine(std::hash<GLintptr>{}(binding.offset));
+                combine(std::hash<VertexFetch>{}(binding.fetch));
+            }
+            return seed;
+        }
+    };
+}
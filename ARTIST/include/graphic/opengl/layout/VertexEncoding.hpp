@@ -0,0 +1,344 @@
+/**
+ * @file VertexEncoding.hpp
+ * @brief Compression of float vertex data into smaller OpenGL attribute formats.
+ *
+ * Normals, texture coordinates and colors rarely need 32-bit floats. They can be stored as half
+ * floats, normalized 8/16-bit integers or packed into GL_INT_2_10_10_10_REV, halving or quartering
+ * the vertex memory and the upload bandwidth. The encoders below convert float arrays into those
+ * formats. Each has AVX2/F16C or SSE4.1 kernels, compiled with the target attribute of their
+ * instruction set and picked at runtime from the CPU features, and a scalar fallback; every path
+ * produces the same bits (round to nearest even, NaN clamped to the lower bound for normalized
+ * formats).
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <common/exception/TraceableException.hpp>
+#include <common/simd/CpuFeatures.hpp>
+
+namespace artist::graphic::opengl::layout
+{
+    /**
+     * @brief Checks whether float attribute data can be stored with the given OpenGL type.
+     */
+    constexpr bool isCompressedType(GLenum glType)
+    {
+        switch (glType)
+        {
+        case GL_HALF_FLOAT:
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_INT_2_10_10_10_REV:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief Number of components given to glVertexAttribPointer for float data of the given size.
+     *
+     * Packed formats always hold 4 components, the missing ones are zero.
+     */
+    constexpr GLint encodedComponents(GLenum glType, GLint components)
+    {
+        return glType == GL_INT_2_10_10_10_REV ? 4 : components;
+    }
+
+    /**
+     * @brief Size in bytes of one vertex with the given number of float components once encoded.
+     */
+    constexpr std::size_t encodedStride(GLenum glType, GLint components)
+    {
+        switch (glType)
+        {
+        case GL_HALF_FLOAT:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+            return 2 * static_cast<std::size_t>(components);
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+            return static_cast<std::size_t>(components);
+        case GL_INT_2_10_10_10_REV:
+            return 4;
+        default:
+            return 4 * static_cast<std::size_t>(components);
+        }
+    }
+
+    namespace scalar
+    {
+        /**
+         * @brief Converts a float to an IEEE half float, rounding to nearest even.
+         */
+        inline std::uint16_t toHalf(float value)
+        {
+            constexpr std::uint32_t infinity = 255u << 23;
+            constexpr std::uint32_t halfOverflow = (127u + 16u) << 23;
+            constexpr std::uint32_t denormMagicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+            const std::uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            std::uint32_t half;
+            if (bits >= halfOverflow)
+            {
+                half = bits > infinity ? 0x7e00u | ((bits >> 13) & 0x3ffu) : 0x7c00u;
+            }
+            else if (bits < (113u << 23))
+            {
+                // Subnormal result: let the float adder align and round the mantissa
+                float denormal = std::bit_cast<float>(bits) + std::bit_cast<float>(denormMagicBits);
+                half = std::bit_cast<std::uint32_t>(denormal) - denormMagicBits;
+            }
+            else
+            {
+                const std::uint32_t odd = (bits >> 13) & 1u;
+                bits += ((15u - 127u) << 23) + 0xfffu + odd;
+                half = bits >> 13;
+            }
+            return static_cast<std::uint16_t>(half | (sign >> 16));
+        }
+
+        inline void encodeHalf(std::span<const float> input, std::uint16_t *output)
+        {
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                output[i] = toHalf(input[i]);
+            }
+        }
+
+        /**
+         * @brief Converts floats to normalized integers: [-1, 1] for signed types, [0, 1] for unsigned ones.
+         */
+        template <typename T>
+        void encodeNormalized(std::span<const float> input, T *output)
+        {
+            constexpr float lower = std::is_signed_v<T> ? -1.0f : 0.0f;
+            constexpr auto scale = static_cast<float>(std::numeric_limits<T>::max());
+            for (std::size_t i = 0; i < input.size(); ++i)
+            {
+                float value = input[i] > lower ? input[i] : lower;
+                value = value < 1.0f ? value : 1.0f;
+                output[i] = static_cast<T>(std::nearbyint(value * scale));
+            }
+        }
+
+        inline std::uint32_t pack2101010(float x, float y, float z, float w)
+        {
+            auto snorm = [](float value, float scale, std::uint32_t mask)
+            {
+                value = value > -1.0f ? value : -1.0f;
+                value = value < 1.0f ? value : 1.0f;
+                return static_cast<std::uint32_t>(static_cast<std::int32_t>(std::nearbyint(value * scale))) & mask;
+            };
+            return snorm(x, 511.0f, 0x3ffu) | (snorm(y, 511.0f, 0x3ffu) << 10) | (snorm(z, 511.0f, 0x3ffu) << 20) | (snorm(w, 1.0f, 0x3u) << 30);
+        }
+
+        /**
+         * @brief Packs vectors of 3 or 4 floats into signed normalized GL_INT_2_10_10_10_REV words.
+         */
+        inline void encode2101010(std::span<const float> input, GLint components, std::uint32_t *output)
+        {
+            const auto stride = static_cast<std::size_t>(components);
+            for (std::size_t i = 0, v = 0; i + stride <= input.size(); i += stride, ++v)
+            {
+                output[v] = pack2101010(input[i], input[i + 1], input[i + 2], components == 4 ? input[i + 3] : 0.0f);
+            }
+        }
+    }
+
+#if defined(ARTIST_SIMD_X86)
+    // Each kernel encodes whole blocks of values and returns how many it encoded: the dispatching
+    // functions finish the remaining values with the scalar code.
+    namespace sse
+    {
+        template <typename T>
+        ARTIST_TARGET("sse4.1")
+        std::size_t encodeNormalized(std::span<const float> input, T *output)
+        {
+            constexpr float lower = std::is_signed_v<T> ? -1.0f : 0.0f;
+            constexpr auto scale = static_cast<float>(std::numeric_limits<T>::max());
+            const __m128 lowerVector = _mm_set1_ps(lower);
+            const __m128 upperVector = _mm_set1_ps(1.0f);
+            const __m128 scaleVector = _mm_set1_ps(scale);
+            std::size_t i = 0;
+            for (; i + 8 <= input.size(); i += 8)
+            {
+                // Same clamping order as the scalar path, so NaN maps to the lower bound
+                __m128 low = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input.data() + i), lowerVector), upperVector);
+                __m128 high = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input.data() + i + 4), lowerVector), upperVector);
+                __m128i lowInt = _mm_cvtps_epi32(_mm_mul_ps(low, scaleVector));
+                __m128i highInt = _mm_cvtps_epi32(_mm_mul_ps(high, scaleVector));
+                if constexpr (std::is_same_v<T, std::uint16_t>)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi32(lowInt, highInt));
+                }
+                else if constexpr (std::is_same_v<T, std::int16_t>)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi32(lowInt, highInt));
+                }
+                else
+                {
+                    __m128i packed16 = _mm_packs_epi32(lowInt, highInt);
+                    if constexpr (std::is_signed_v<T>)
+                    {
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi16(packed16, packed16));
+                    }
+                    else
+                    {
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(output + i), _mm_packus_epi16(packed16, packed16));
+                    }
+                }
+            }
+            return i;
+        }
+    }
+
+    namespace avx2
+    {
+        ARTIST_TARGET("avx2,f16c")
+        inline std::size_t encodeHalf(std::span<const float> input, std::uint16_t *output)
+        {
+            std::size_t i = 0;
+            for (; i + 8 <= input.size(); i += 8)
+            {
+                __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(input.data() + i), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), half);
+            }
+            return i;
+        }
+
+        /**
+         * @return The number of vectors packed.
+         */
+        ARTIST_TARGET("avx2")
+        inline std::size_t encode2101010(std::span<const float> input, GLint components, std::uint32_t *output)
+        {
+            const auto stride = static_cast<std::size_t>(components);
+            const __m128 lower = _mm_set1_ps(-1.0f);
+            const __m128 upper = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f);
+            const __m128i mask = _mm_setr_epi32(0x3ff, 0x3ff, 0x3ff, 0x3);
+            const __m128i shift = _mm_setr_epi32(0, 10, 20, 30);
+            std::size_t v = 0;
+            // Loads 4 floats per vertex: for vec3 the last vertex is left to the scalar path
+            for (std::size_t i = 0; i + 4 <= input.size(); i += stride, ++v)
+            {
+                __m128 value = _mm_loadu_ps(input.data() + i);
+                if (components == 3)
+                {
+                    value = _mm_blend_ps(value, _mm_setzero_ps(), 0x8);
+                }
+                value = _mm_min_ps(_mm_max_ps(value, lower), upper);
+                __m128i fields = _mm_sllv_epi32(_mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(value, scale)), mask), shift);
+                fields = _mm_or_si128(fields, _mm_shuffle_epi32(fields, _MM_SHUFFLE(1, 0, 3, 2)));
+                fields = _mm_or_si128(fields, _mm_shuffle_epi32(fields, _MM_SHUFFLE(2, 3, 0, 1)));
+                output[v] = static_cast<std::uint32_t>(_mm_cvtsi128_si32(fields));
+            }
+            return v;
+        }
+    }
+#endif
+
+    /**
+     * @brief Converts floats to half floats.
+     */
+    inline void encodeHalf(std::span<const float> input, std::uint16_t *output)
+    {
+        std::size_t i = 0;
+#if defined(ARTIST_SIMD_X86)
+        if (common::simd::getSimdLevel() >= common::simd::SimdLevel::Avx2)
+        {
+            i = avx2::encodeHalf(input, output);
+        }
+#endif
+        scalar::encodeHalf(input.subspan(i), output + i);
+    }
+
+    /**
+     * @brief Converts floats to normalized 8 or 16-bit integers.
+     */
+    template <typename T>
+    void encodeNormalized(std::span<const float> input, T *output)
+    {
+        static_assert(sizeof(T) <= 2 && std::is_integral_v<T>, "Normalized formats are 8 or 16-bit integers");
+        std::size_t i = 0;
+#if defined(ARTIST_SIMD_X86)
+        if (common::simd::getSimdLevel() >= common::simd::SimdLevel::Sse41)
+        {
+            i = sse::encodeNormalized<T>(input, output);
+        }
+#endif
+        scalar::encodeNormalized<T>(input.subspan(i), output + i);
+    }
+
+    /**
+     * @brief Packs vectors of 3 or 4 floats into GL_INT_2_10_10_10_REV words.
+     */
+    inline void encode2101010(std::span<const float> input, GLint components, std::uint32_t *output)
+    {
+        std::size_t v = 0;
+#if defined(ARTIST_SIMD_X86)
+        if (common::simd::getSimdLevel() >= common::simd::SimdLevel::Avx2)
+        {
+            v = avx2::encode2101010(input, components, output);
+        }
+#endif
+        scalar::encode2101010(input.subspan(v * static_cast<std::size_t>(components)), components, output + v);
+    }
+
+    /**
+     * @brief Encodes float vertex data into the given OpenGL type.
+     * @param input Floats of consecutive vertices, components per vertex.
+     * @param glType Target type, one accepted by isCompressedType().
+     * @param components Number of floats per vertex.
+     * @param output Destination, encodedStride(glType, components) bytes per vertex.
+     */
+    inline void encode(std::span<const float> input, GLenum glType, GLint components, std::span<std::byte> output)
+    {
+        const std::size_t vertices = input.size() / static_cast<std::size_t>(components);
+        if (output.size() < vertices * encodedStride(glType, components))
+        {
+            throw common::exception::TraceableException<std::runtime_error>("ERROR::VERTEX_ENCODING::OUTPUT_TOO_SMALL");
+        }
+        switch (glType)
+        {
+        case GL_HALF_FLOAT:
+            encodeHalf(input, reinterpret_cast<std::uint16_t *>(output.data()));
+            break;
+        case GL_BYTE:
+            encodeNormalized<std::int8_t>(input, reinterpret_cast<std::int8_t *>(output.data()));
+            break;
+        case GL_UNSIGNED_BYTE:
+            encodeNormalized<std::uint8_t>(input, reinterpret_cast<std::uint8_t *>(output.data()));
+            break;
+        case GL_SHORT:
+            encodeNormalized<std::int16_t>(input, reinterpret_cast<std::int16_t *>(output.data()));
+            break;
+        case GL_UNSIGNED_SHORT:
+            encodeNormalized<std::uint16_t>(input, reinterpret_cast<std::uint16_t *>(output.data()));
+            break;
+        case GL_INT_2_10_10_10_REV:
+            if (components != 3 && components != 4)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::VERTEX_ENCODING::PACKED_FORMAT_NEEDS_3_OR_4_COMPONENTS");
+            }
+            encode2101010(input, components, reinterpret_cast<std::uint32_t *>(output.data()));
+            break;
+        default:
+            throw common::exception::TraceableException<std::runtime_error>("ERROR::VERTEX_ENCODING::UNSUPPORTED_TYPE");
+        }
+    }
+}
@@ -0,0 +1,232 @@
+/**
+ * @file VertexLayout.hpp
+ * @brief Typed vertex layout descriptions for OpenGL attributes.
+ *
+ * Describes how a C++ vertex type is laid out in a vertex buffer: the stride of one vertex and,
+ * for each element, its component count, OpenGL type, normalization and byte offset. Scalar and
+ * glm vector types get a single-element layout (separate stream). Interleaved vertex structs get
+ * one element per member through the `ARTIST_VERTEX_LAYOUT` macro:
+ *
+ * @code
+ * struct Vertex
+ * {
+ *     glm::vec3 position;
+ *     glm::vec3 normal;
+ *     glm::vec2 uv;
+ * };
+ * ARTIST_VERTEX_LAYOUT(Vertex, position, normal, uv)
+ * @endcode
+ *
+ * Elements of an interleaved layout are matched to shader attributes by name.
+ *
+ * Each element also tells how the shader receives it: float types, and integer types the shader
+ * reads as floats once normalized, go through glVertexAttribPointer; integer types feeding int and
+ * uint inputs go through glVertexAttribIPointer; double types feeding double inputs through
+ * glVertexAttribLPointer. Integer and double C++ types map to the last two.
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <glm/glm.hpp>
+#include <common/macros.hpp>
+
+namespace artist::graphic::opengl::layout
+{
+    /**
+     * @brief How the vertex shader receives the components of an attribute.
+     */
+    enum class VertexFetch
+    {
+        Float,   ///< Converted to floats, normalized or not: glVertexAttribPointer.
+        Integer, ///< Kept as integers, for int and uint inputs: glVertexAttribIPointer.
+        Double,  ///< Kept as doubles, for double inputs: glVertexAttribLPointer.
+    };
+
+    /**
+     * @brief Fetch of data described by its OpenGL type only, e.g. read from a file.
+     *
+     * Doubles stay doubles, integers not normalized stay integers, everything else becomes floats.
+     */
+    constexpr VertexFetch defaultFetch(GLenum glType, bool normalized)
+    {
+        switch (glType)
+        {
+        case GL_DOUBLE:
+            return VertexFetch::Double;
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+            return normalized ? VertexFetch::Float : VertexFetch::Integer;
+        default:
+            return VertexFetch::Float;
+        }
+    }
+
+    /**
+     * @brief Maps a C++ type to the OpenGL component type, count and fetch of its vertex attribute.
+     *
+     * The primary template marks unsupported types with GL_INVALID_ENUM.
+     */
+    template <typename T>
+    struct OpenGLVertexTraits
+    {
+        static constexpr GLenum glType = GL_INVALID_ENUM;
+        static constexpr GLint components = 0;
+        static constexpr VertexFetch fetch = VertexFetch::Float;
+    };
+
+#define ARTIST_VERTEX_TRAITS(Type, GLType, Components, Fetch)   \
+    template <>                                                 \
+    struct OpenGLVertexTraits<Type>                             \
+    {                                                           \
+        static constexpr GLenum glType = GLType;                \
+        static constexpr GLint components = Components;         \
+        static constexpr VertexFetch fetch = VertexFetch::Fetch; \
+    };
+
+    ARTIST_VERTEX_TRAITS(GLfloat, GL_FLOAT, 1, Float)
+    ARTIST_VERTEX_TRAITS(GLdouble, GL_DOUBLE, 1, Double)
+    ARTIST_VERTEX_TRAITS(GLint, GL_INT, 1, Integer)
+    ARTIST_VERTEX_TRAITS(GLuint, GL_UNSIGNED_INT, 1, Integer)
+    ARTIST_VERTEX_TRAITS(GLshort, GL_SHORT, 1, Integer)
+    ARTIST_VERTEX_TRAITS(GLushort, GL_UNSIGNED_SHORT, 1, Integer)
+    ARTIST_VERTEX_TRAITS(GLbyte, GL_BYTE, 1, Integer)
+    ARTIST_VERTEX_TRAITS(GLubyte, GL_UNSIGNED_BYTE, 1, Integer)
+    ARTIST_VERTEX_TRAITS(glm::vec2, GL_FLOAT, 2, Float)
+    ARTIST_VERTEX_TRAITS(glm::vec3, GL_FLOAT, 3, Float)
+    ARTIST_VERTEX_TRAITS(glm::vec4, GL_FLOAT, 4, Float)
+    ARTIST_VERTEX_TRAITS(glm::dvec2, GL_DOUBLE, 2, Double)
+    ARTIST_VERTEX_TRAITS(glm::dvec3, GL_DOUBLE, 3, Double)
+    ARTIST_VERTEX_TRAITS(glm::dvec4, GL_DOUBLE, 4, Double)
+    ARTIST_VERTEX_TRAITS(glm::ivec2, GL_INT, 2, Integer)
+    ARTIST_VERTEX_TRAITS(glm::ivec3, GL_INT, 3, Integer)
+    ARTIST_VERTEX_TRAITS(glm::ivec4, GL_INT, 4, Integer)
+    ARTIST_VERTEX_TRAITS(glm::uvec2, GL_UNSIGNED_INT, 2, Integer)
+    ARTIST_VERTEX_TRAITS(glm::uvec3, GL_UNSIGNED_INT, 3, Integer)
+    ARTIST_VERTEX_TRAITS(glm::uvec4, GL_UNSIGNED_INT, 4, Integer)
+
+#undef ARTIST_VERTEX_TRAITS
+
+    /**
+     * @struct VertexElement
+     * @brief One attribute stream inside a vertex layout.
+     */
+    struct VertexElement
+    {
+        const char *name;      ///< Member name, nullptr for single-element layouts.
+        GLint components;      ///< Number of components (1 to 4).
+        GLenum glType;         ///< OpenGL component type.
+        GLboolean normalized;  ///< Whether integer data is normalized when fetched.
+        GLsizei offset;        ///< Byte offset of the element inside one vertex.
+        VertexFetch fetch;     ///< How the shader receives the components.
+    };
+
+    /**
+     * @brief Vertex layout of T.
+     *
+     * The primary template describes a separate stream holding tightly packed values of T.
+     * Interleaved structs specialize it through `ARTIST_VERTEX_LAYOUT`.
+     *
+     * @tparam T The vertex type.
+     */
+    template <typename T>
+    struct VertexLayout
+    {
+        static constexpr GLsizei stride = sizeof(T);
+        static constexpr std::array<VertexElement, 1> elements{
+            VertexElement{nullptr, OpenGLVertexTraits<T>::components, OpenGLVertexTraits<T>::glType, GL_FALSE, 0, OpenGLVertexTraits<T>::fetch}};
+    };
+
+    /**
+     * @brief Checks that every element of T's layout maps to a supported OpenGL type.
+     */
+    template <typename T>
+    constexpr bool isSupportedLayout()
+    {
+        for (const auto &element : VertexLayout<T>::elements)
+        {
+            if (element.glType == GL_INVALID_ENUM || element.components == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Concept satisfied by types whose vertex layout only contains supported elements.
+     */
+    template <typename T>
+    concept HasVertexLayout = isSupportedLayout<T>();
+
+    /**
+     * @brief Finds the element of T's layout feeding the attribute with the given name.
+     *
+     * Single-element layouts match any attribute name.
+     *
+     * @param name Name of the shader attribute.
+     * @return The matching element, or nullptr if the layout has no element with that name.
+     */
+    template <typename T>
+        requires HasVertexLayout<T>
+    constexpr const VertexElement *findElement(std::string_view name)
+    {
+        const auto &elements = VertexLayout<T>::elements;
+        if (elements.size() == 1)
+        {
+            return &elements[0];
+        }
+        for (const auto &element : elements)
+        {
+            if (element.name && name == element.name)
+            {
+                return &element;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Total number of components of one vertex of the layout of T, over all its elements.
+     */
+    template <typename T>
+        requires HasVertexLayout<T>
+    constexpr std::size_t countComponents()
+    {
+        std::size_t components = 0;
+        for (const auto &element : VertexLayout<T>::elements)
+        {
+            components += static_cast<std::size_t>(element.components);
+        }
+        return components;
+    }
+}
+
+#define ARTIST_VERTEX_ELEMENT(Type, member)                                                        \
+    artist::graphic::opengl::layout::VertexElement{                                                \
+        #member,                                                                                   \
+        artist::graphic::opengl::layout::OpenGLVertexTraits<decltype(Type::member)>::components,   \
+        artist::graphic::opengl::layout::OpenGLVertexTraits<decltype(Type::member)>::glType,       \
+        GL_FALSE,                                                                                  \
+        static_cast<GLsizei>(offsetof(Type, member)),                                              \
+        artist::graphic::opengl::layout::OpenGLVertexTraits<decltype(Type::member)>::fetch},
+
+/**
+ * @brief Declares the interleaved vertex layout of a struct from the list of its members.
+ *
+ * Must be used at global namespace scope.
+ */
+#define ARTIST_VERTEX_LAYOUT(Type, ...)                                                              \
+    template <>                                                                                      \
+    struct artist::graphic::opengl::layout::VertexLayout<Type>                                       \
+    {                                                                                                \
+        static constexpr GLsizei stride = sizeof(Type);                                              \
+        static constexpr std::array elements{FOR_EACH_1_FIX_ARG(ARTIST_VERTEX_ELEMENT, Type, __VA_ARGS__)}; \
+    };
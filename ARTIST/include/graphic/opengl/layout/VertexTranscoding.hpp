@@ -0,0 +1,500 @@
+/**
+ * @file VertexTranscoding.hpp
+ * @brief Conversion between separate component arrays (SoA) and interleaved vertices (AoS).
+ *
+ * Simulations usually keep one array per component (all x, then all y, ...) while vertex buffers
+ * interleave the components of each vertex. The kernels below transpose between the two: 2, 3 and
+ * 4 components with SSE4.1, tightly packed 2 and any 4 components with AVX2, anything else in scalar
+ * code. Vertices wider than the transposed components, as in interleaved layouts, are written
+ * without touching the other elements. The kernel is picked at runtime from the CPU features. Values are only moved, never
+ * converted, so every kernel is bit-exact with the scalar reference, NaN payloads included.
+ *
+ * @code
+ * std::array<const float *, 5> streams{px.data(), py.data(), pz.data(), u.data(), v.data()};
+ * auto vertices = stream.allocate<Vertex>(count);
+ * interleaveVertices<Vertex>(streams, count, std::as_writable_bytes(vertices.data));
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <format>
+#include <span>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <common/simd/CpuFeatures.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+
+namespace artist::graphic::opengl::layout
+{
+    namespace scalar
+    {
+        /**
+         * @brief Writes output[v * stride + c] = components[c][v] for the vertices [first, count).
+         */
+        inline void interleave(std::span<const float *const> components, std::size_t first, std::size_t count, float *output, std::size_t stride)
+        {
+            for (std::size_t v = first; v < count; ++v)
+            {
+                for (std::size_t c = 0; c < components.size(); ++c)
+                {
+                    output[v * stride + c] = components[c][v];
+                }
+            }
+        }
+
+        /**
+         * @brief Writes components[c][v] = input[v * stride + c] for the vertices [first, count).
+         */
+        inline void deinterleave(const float *input, std::size_t stride, std::size_t first, std::size_t count, std::span<float *const> components)
+        {
+            for (std::size_t v = first; v < count; ++v)
+            {
+                for (std::size_t c = 0; c < components.size(); ++c)
+                {
+                    components[c][v] = input[v * stride + c];
+                }
+            }
+        }
+    }
+
+#if defined(ARTIST_SIMD_X86)
+    // Each kernel processes whole blocks of vertices and returns how many it processed: the
+    // dispatching functions finish the remaining vertices with the scalar code.
+    namespace sse
+    {
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t interleave2(const float *x, const float *y, std::size_t count, float *output)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                const __m128 xs = _mm_loadu_ps(x + v);
+                const __m128 ys = _mm_loadu_ps(y + v);
+                _mm_storeu_ps(output + 2 * v, _mm_unpacklo_ps(xs, ys));
+                _mm_storeu_ps(output + 2 * v + 4, _mm_unpackhi_ps(xs, ys));
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t deinterleave2(const float *input, std::size_t count, float *x, float *y)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                const __m128 low = _mm_loadu_ps(input + 2 * v);
+                const __m128 high = _mm_loadu_ps(input + 2 * v + 4);
+                _mm_storeu_ps(x + v, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(y + v, _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t interleave3(const float *x, const float *y, const float *z, std::size_t count, float *output)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                const __m128 xs = _mm_loadu_ps(x + v);
+                const __m128 ys = _mm_loadu_ps(y + v);
+                const __m128 zs = _mm_loadu_ps(z + v);
+                // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+                const __m128 first = _mm_shuffle_ps(_mm_unpacklo_ps(xs, ys), _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+                const __m128 second = _mm_shuffle_ps(_mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(xs, ys), _MM_SHUFFLE(1, 0, 2, 0));
+                const __m128 third = _mm_shuffle_ps(_mm_shuffle_ps(zs, xs, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+                _mm_storeu_ps(output + 3 * v, first);
+                _mm_storeu_ps(output + 3 * v + 4, second);
+                _mm_storeu_ps(output + 3 * v + 8, third);
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t deinterleave3(const float *input, std::size_t count, float *x, float *y, float *z)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                const __m128 first = _mm_loadu_ps(input + 3 * v);
+                const __m128 second = _mm_loadu_ps(input + 3 * v + 4);
+                const __m128 third = _mm_loadu_ps(input + 3 * v + 8);
+                const __m128 xs = _mm_shuffle_ps(first, _mm_shuffle_ps(second, third, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+                const __m128 ys = _mm_shuffle_ps(_mm_shuffle_ps(first, second, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(second, third, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+                const __m128 zs = _mm_shuffle_ps(_mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 1, 2, 2)), third, _MM_SHUFFLE(3, 0, 2, 0));
+                _mm_storeu_ps(x + v, xs);
+                _mm_storeu_ps(y + v, ys);
+                _mm_storeu_ps(z + v, zs);
+            }
+            return v;
+        }
+
+        // Strided kernels: the vertices hold other elements after this one, which must be left
+        // untouched, so each vertex is written with a 64-bit store plus a 32-bit one for z.
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t interleave2Strided(const float *x, const float *y, std::size_t count, float *output, std::size_t stride)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                const __m128 xs = _mm_loadu_ps(x + v);
+                const __m128 ys = _mm_loadu_ps(y + v);
+                const __m128 low = _mm_unpacklo_ps(xs, ys);  // x0 y0 x1 y1
+                const __m128 high = _mm_unpackhi_ps(xs, ys); // x2 y2 x3 y3
+                _mm_storel_pi(reinterpret_cast<__m64 *>(output + v * stride), low);
+                _mm_storeh_pi(reinterpret_cast<__m64 *>(output + (v + 1) * stride), low);
+                _mm_storel_pi(reinterpret_cast<__m64 *>(output + (v + 2) * stride), high);
+                _mm_storeh_pi(reinterpret_cast<__m64 *>(output + (v + 3) * stride), high);
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t deinterleave2Strided(const float *input, std::size_t stride, std::size_t count, float *x, float *y)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                __m128 low = _mm_setzero_ps();
+                __m128 high = _mm_setzero_ps();
+                low = _mm_loadl_pi(low, reinterpret_cast<const __m64 *>(input + v * stride));
+                low = _mm_loadh_pi(low, reinterpret_cast<const __m64 *>(input + (v + 1) * stride));
+                high = _mm_loadl_pi(high, reinterpret_cast<const __m64 *>(input + (v + 2) * stride));
+                high = _mm_loadh_pi(high, reinterpret_cast<const __m64 *>(input + (v + 3) * stride));
+                _mm_storeu_ps(x + v, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(y + v, _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t interleave3Strided(const float *x, const float *y, const float *z, std::size_t count, float *output, std::size_t stride)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                __m128 r0 = _mm_loadu_ps(x + v);
+                __m128 r1 = _mm_loadu_ps(y + v);
+                __m128 r2 = _mm_loadu_ps(z + v);
+                __m128 r3 = _mm_setzero_ps();
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                const __m128 vertices[4] = {r0, r1, r2, r3};
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    float *vertex = output + (v + i) * stride;
+                    _mm_storel_pi(reinterpret_cast<__m64 *>(vertex), vertices[i]);
+                    _mm_store_ss(vertex + 2, _mm_movehl_ps(vertices[i], vertices[i]));
+                }
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t deinterleave3Strided(const float *input, std::size_t stride, std::size_t count, float *x, float *y, float *z)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                __m128 vertices[4];
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    const float *vertex = input + (v + i) * stride;
+                    vertices[i] = _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vertex)), _mm_load_ss(vertex + 2));
+                }
+                _MM_TRANSPOSE4_PS(vertices[0], vertices[1], vertices[2], vertices[3]);
+                _mm_storeu_ps(x + v, vertices[0]);
+                _mm_storeu_ps(y + v, vertices[1]);
+                _mm_storeu_ps(z + v, vertices[2]);
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t interleave4(const float *x, const float *y, const float *z, const float *w, std::size_t count, float *output, std::size_t stride)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                __m128 r0 = _mm_loadu_ps(x + v);
+                __m128 r1 = _mm_loadu_ps(y + v);
+                __m128 r2 = _mm_loadu_ps(z + v);
+                __m128 r3 = _mm_loadu_ps(w + v);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _mm_storeu_ps(output + v * stride, r0);
+                _mm_storeu_ps(output + (v + 1) * stride, r1);
+                _mm_storeu_ps(output + (v + 2) * stride, r2);
+                _mm_storeu_ps(output + (v + 3) * stride, r3);
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("sse4.1")
+        inline std::size_t deinterleave4(const float *input, std::size_t stride, std::size_t count, float *x, float *y, float *z, float *w)
+        {
+            std::size_t v = 0;
+            for (; v + 4 <= count; v += 4)
+            {
+                __m128 r0 = _mm_loadu_ps(input + v * stride);
+                __m128 r1 = _mm_loadu_ps(input + (v + 1) * stride);
+                __m128 r2 = _mm_loadu_ps(input + (v + 2) * stride);
+                __m128 r3 = _mm_loadu_ps(input + (v + 3) * stride);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                _mm_storeu_ps(x + v, r0);
+                _mm_storeu_ps(y + v, r1);
+                _mm_storeu_ps(z + v, r2);
+                _mm_storeu_ps(w + v, r3);
+            }
+            return v;
+        }
+    }
+
+    namespace avx2
+    {
+        ARTIST_TARGET("avx2")
+        inline std::size_t interleave2(const float *x, const float *y, std::size_t count, float *output)
+        {
+            std::size_t v = 0;
+            for (; v + 8 <= count; v += 8)
+            {
+                const __m256 xs = _mm256_loadu_ps(x + v);
+                const __m256 ys = _mm256_loadu_ps(y + v);
+                const __m256 low = _mm256_unpacklo_ps(xs, ys);  // x0 y0 x1 y1 | x4 y4 x5 y5
+                const __m256 high = _mm256_unpackhi_ps(xs, ys); // x2 y2 x3 y3 | x6 y6 x7 y7
+                _mm256_storeu_ps(output + 2 * v, _mm256_permute2f128_ps(low, high, 0x20));
+                _mm256_storeu_ps(output + 2 * v + 8, _mm256_permute2f128_ps(low, high, 0x31));
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("avx2")
+        inline std::size_t deinterleave2(const float *input, std::size_t count, float *x, float *y)
+        {
+            std::size_t v = 0;
+            for (; v + 8 <= count; v += 8)
+            {
+                const __m256 first = _mm256_loadu_ps(input + 2 * v);
+                const __m256 second = _mm256_loadu_ps(input + 2 * v + 8);
+                const __m256 low = _mm256_permute2f128_ps(first, second, 0x20);  // x0 y0 x1 y1 | x4 y4 x5 y5
+                const __m256 high = _mm256_permute2f128_ps(first, second, 0x31); // x2 y2 x3 y3 | x6 y6 x7 y7
+                _mm256_storeu_ps(x + v, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm256_storeu_ps(y + v, _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("avx2")
+        inline std::size_t interleave4(const float *x, const float *y, const float *z, const float *w, std::size_t count, float *output, std::size_t stride)
+        {
+            std::size_t v = 0;
+            for (; v + 8 <= count; v += 8)
+            {
+                const __m256 xs = _mm256_loadu_ps(x + v);
+                const __m256 ys = _mm256_loadu_ps(y + v);
+                const __m256 zs = _mm256_loadu_ps(z + v);
+                const __m256 ws = _mm256_loadu_ps(w + v);
+                const __m256 xyLow = _mm256_unpacklo_ps(xs, ys);
+                const __m256 zwLow = _mm256_unpacklo_ps(zs, ws);
+                const __m256 xyHigh = _mm256_unpackhi_ps(xs, ys);
+                const __m256 zwHigh = _mm256_unpackhi_ps(zs, ws);
+                // Vertex i in the low lane, vertex i + 4 in the high lane
+                const __m256 vertices[4] = {_mm256_shuffle_ps(xyLow, zwLow, _MM_SHUFFLE(1, 0, 1, 0)),
+                                            _mm256_shuffle_ps(xyLow, zwLow, _MM_SHUFFLE(3, 2, 3, 2)),
+                                            _mm256_shuffle_ps(xyHigh, zwHigh, _MM_SHUFFLE(1, 0, 1, 0)),
+                                            _mm256_shuffle_ps(xyHigh, zwHigh, _MM_SHUFFLE(3, 2, 3, 2))};
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    _mm_storeu_ps(output + (v + i) * stride, _mm256_castps256_ps128(vertices[i]));
+                    _mm_storeu_ps(output + (v + i + 4) * stride, _mm256_extractf128_ps(vertices[i], 1));
+                }
+            }
+            return v;
+        }
+
+        ARTIST_TARGET("avx2")
+        inline std::size_t deinterleave4(const float *input, std::size_t stride, std::size_t count, float *x, float *y, float *z, float *w)
+        {
+            std::size_t v = 0;
+            for (; v + 8 <= count; v += 8)
+            {
+                __m256 vertices[4];
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    vertices[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(input + (v + i) * stride)), _mm_loadu_ps(input + (v + i + 4) * stride), 1);
+                }
+                const __m256 xyLow = _mm256_unpacklo_ps(vertices[0], vertices[1]);  // x0 x1 y0 y1
+                const __m256 xyHigh = _mm256_unpacklo_ps(vertices[2], vertices[3]); // x2 x3 y2 y3
+                const __m256 zwLow = _mm256_unpackhi_ps(vertices[0], vertices[1]);  // z0 z1 w0 w1
+                const __m256 zwHigh = _mm256_unpackhi_ps(vertices[2], vertices[3]); // z2 z3 w2 w3
+                _mm256_storeu_ps(x + v, _mm256_shuffle_ps(xyLow, xyHigh, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm256_storeu_ps(y + v, _mm256_shuffle_ps(xyLow, xyHigh, _MM_SHUFFLE(3, 2, 3, 2)));
+                _mm256_storeu_ps(z + v, _mm256_shuffle_ps(zwLow, zwHigh, _MM_SHUFFLE(1, 0, 1, 0)));
+                _mm256_storeu_ps(w + v, _mm256_shuffle_ps(zwLow, zwHigh, _MM_SHUFFLE(3, 2, 3, 2)));
+            }
+            return v;
+        }
+    }
+#endif
+
+    /**
+     * @brief Interleaves component arrays: output[v * stride + c] = components[c][v].
+     * @param components One array of count values per component.
+     * @param count Number of vertices.
+     * @param output First component of the first vertex. Components after the last one are left untouched.
+     * @param stride Distance between two vertices, in floats.
+     */
+    inline void interleave(std::span<const float *const> components, std::size_t count, float *output, std::size_t stride)
+    {
+        if (components.empty() || stride < components.size())
+        {
+            throw common::exception::TraceableException<std::invalid_argument>(std::format("ERROR::VERTEX_TRANSCODING::INVALID_STRIDE: {} components in a stride of {}", components.size(), stride));
+        }
+        std::size_t done = 0;
+#if defined(ARTIST_SIMD_X86)
+        const common::simd::SimdLevel level = common::simd::getSimdLevel();
+        if (components.size() == 2 && stride == 2)
+        {
+            if (level >= common::simd::SimdLevel::Avx2)
+            {
+                done = avx2::interleave2(components[0], components[1], count, output);
+            }
+            else if (level >= common::simd::SimdLevel::Sse41)
+            {
+                done = sse::interleave2(components[0], components[1], count, output);
+            }
+        }
+        else if (components.size() == 2 && level >= common::simd::SimdLevel::Sse41)
+        {
+            done = sse::interleave2Strided(components[0], components[1], count, output, stride);
+        }
+        else if (components.size() == 3 && level >= common::simd::SimdLevel::Sse41)
+        {
+            done = stride == 3 ? sse::interleave3(components[0], components[1], components[2], count, output)
+                               : sse::interleave3Strided(components[0], components[1], components[2], count, output, stride);
+        }
+        else if (components.size() == 4)
+        {
+            if (level >= common::simd::SimdLevel::Avx2)
+            {
+                done = avx2::interleave4(components[0], components[1], components[2], components[3], count, output, stride);
+            }
+            else if (level >= common::simd::SimdLevel::Sse41)
+            {
+                done = sse::interleave4(components[0], components[1], components[2], components[3], count, output, stride);
+            }
+        }
+#endif
+        scalar::interleave(components, done, count, output, stride);
+    }
+
+    /**
+     * @brief Splits interleaved vertices into component arrays: components[c][v] = input[v * stride + c].
+     */
+    inline void deinterleave(const float *input, std::size_t stride, std::size_t count, std::span<float *const> components)
+    {
+        if (components.empty() || stride < components.size())
+        {
+            throw common::exception::TraceableException<std::invalid_argument>(std::format("ERROR::VERTEX_TRANSCODING::INVALID_STRIDE: {} components in a stride of {}", components.size(), stride));
+        }
+        std::size_t done = 0;
+#if defined(ARTIST_SIMD_X86)
+        const common::simd::SimdLevel level = common::simd::getSimdLevel();
+        if (components.size() == 2 && stride == 2)
+        {
+            if (level >= common::simd::SimdLevel::Avx2)
+            {
+                done = avx2::deinterleave2(input, count, components[0], components[1]);
+            }
+            else if (level >= common::simd::SimdLevel::Sse41)
+            {
+                done = sse::deinterleave2(input, count, components[0], components[1]);
+            }
+        }
+        else if (components.size() == 2 && level >= common::simd::SimdLevel::Sse41)
+        {
+            done = sse::deinterleave2Strided(input, stride, count, components[0], components[1]);
+        }
+        else if (components.size() == 3 && level >= common::simd::SimdLevel::Sse41)
+        {
+            done = stride == 3 ? sse::deinterleave3(input, count, components[0], components[1], components[2])
+                               : sse::deinterleave3Strided(input, stride, count, components[0], components[1], components[2]);
+        }
+        else if (components.size() == 4)
+        {
+            if (level >= common::simd::SimdLevel::Avx2)
+            {
+                done = avx2::deinterleave4(input, stride, count, components[0], components[1], components[2], components[3]);
+            }
+            else if (level >= common::simd::SimdLevel::Sse41)
+            {
+                done = sse::deinterleave4(input, stride, count, components[0], components[1], components[2], components[3]);
+            }
+        }
+#endif
+        scalar::deinterleave(input, stride, done, count, components);
+    }
+
+    /**
+     * @throws common::exception::TraceableException If the layout of A is not made of floats, or the
+     *         number of streams or the size of the vertex memory does not match it.
+     */
+    template <typename A>
+    void checkTranscodedLayout(std::size_t streams, std::size_t count, std::size_t bytes)
+    {
+        std::size_t components = 0;
+        for (const VertexElement &element : VertexLayout<A>::elements)
+        {
+            if (element.glType != GL_FLOAT || element.offset % sizeof(float) != 0 || VertexLayout<A>::stride % sizeof(float) != 0)
+            {
+                throw common::exception::TraceableException<std::invalid_argument>("ERROR::VERTEX_TRANSCODING::NOT_A_FLOAT_LAYOUT");
+            }
+            components += static_cast<std::size_t>(element.components);
+        }
+        if (streams != components || bytes < count * VertexLayout<A>::stride)
+        {
+            throw common::exception::TraceableException<std::invalid_argument>(std::format("ERROR::VERTEX_TRANSCODING::SIZE_MISMATCH: {} streams for {} components, {} bytes for {} vertices", streams, components, bytes, count));
+        }
+    }
+
+    /**
+     * @brief Writes vertices of the layout of A from component arrays.
+     *
+     * The arrays are given in layout order: the components of the first element, then of the second one, ...
+     * Every element of A must be made of floats.
+     *
+     * @param streams One array of count floats per component of the layout.
+     * @param count Number of vertices.
+     * @param output Memory of count vertices of A, e.g. mapped buffer memory.
+     */
+    template <typename A>
+    void interleaveVertices(std::span<const float *const> streams, std::size_t count, std::span<std::byte> output)
+    {
+        checkTranscodedLayout<A>(streams.size(), count, output.size());
+        std::size_t stream = 0;
+        for (const VertexElement &element : VertexLayout<A>::elements)
+        {
+            const auto components = static_cast<std::size_t>(element.components);
+            interleave(streams.subspan(stream, components), count, reinterpret_cast<float *>(output.data() + element.offset), VertexLayout<A>::stride / sizeof(float));
+            stream += components;
+        }
+    }
+
+    /**
+     * @brief Splits vertices of the layout of A into component arrays, in layout order.
+     */
+    template <typename A>
+    void deinterleaveVertices(std::span<const std::byte> input, std::size_t count, std::span<float *const> streams)
+    {
+        checkTranscodedLayout<A>(streams.size(), count, input.size());
+        std::size_t stream = 0;
+        for (const VertexElement &element : VertexLayout<A>::elements)
+        {
+            const auto components = static_cast<std::size_t>(element.components);
+            deinterleave(reinterpret_cast<const float *>(input.data() + element.offset), VertexLayout<A>::stride / sizeof(float), count, streams.subspan(stream, components));
+            stream += components;
+        }
+    }
+}
@@ -0,0 +1,613 @@
+/**
+ * @file GltfImporter.hpp
+ * @brief glTF 2.0 import into typed vertex layouts.
+ *
+ * Reads .gltf files (JSON, with external or base64 embedded buffers) and .glb files (binary
+ * container). External buffers and the binary chunk are memory-mapped, and network URIs are
+ * rejected. Each mesh primitive becomes an array of vertices of a layout A and 32-bit indices,
+ * ready for IAttribute::set and IndexBuffer::set.
+ *
+ * The elements of A are matched to the glTF attributes of the same name in upper case, e.g.
+ * `position` to POSITION and `texcoord_0` to TEXCOORD_0; single-element layouts read POSITION.
+ * Accessors are decoded on a thread pool, chunk by chunk: each chunk is de-interleaved from its
+ * buffer view into one array per component, de-quantized to floats, then interleaved into the
+ * vertices with the SIMD transcoding kernels.
+ *
+ * @code
+ * struct Vertex
+ * {
+ *     glm::vec3 position;
+ *     glm::vec3 normal;
+ *     glm::vec2 texcoord_0;
+ * };
+ * ARTIST_VERTEX_LAYOUT(Vertex, position, normal, texcoord_0)
+ *
+ * ThreadPool pool;
+ * GltfImporter importer("scene.glb");
+ * for (auto &primitive : importer.importPrimitives<Vertex>(pool))
+ * {
+ *     attribute->set<Vertex>(primitive.vertices);
+ *     indexBuffer->set(primitive.indices, primitive.vertices.size());
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <common/io/MappedFile.hpp>
+#include <common/json/Json.hpp>
+#include <common/thread/ThreadPool.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+#include <graphic/opengl/layout/VertexTranscoding.hpp>
+
+namespace artist::graphic::opengl::mesh
+{
+    /**
+     * @struct ImportedPrimitive
+     * @brief One glTF mesh primitive, decoded into vertices of A.
+     */
+    template <typename A>
+    struct ImportedPrimitive
+    {
+        std::size_t mesh = 0;               ///< Index of the glTF mesh holding the primitive.
+        std::string name;                   ///< Name of that mesh, possibly empty.
+        GLenum mode = GL_TRIANGLES;         ///< Primitive topology. glTF modes are the OpenGL values.
+        std::vector<A> vertices;            ///< Decoded vertices.
+        std::vector<std::uint32_t> indices; ///< Indices into the vertices, empty for non-indexed primitives.
+    };
+
+    namespace detail
+    {
+        constexpr std::uint32_t GLB_MAGIC = 0x46546c67;      ///< "glTF"
+        constexpr std::uint32_t GLB_JSON_CHUNK = 0x4e4f534a; ///< "JSON"
+        constexpr std::uint32_t GLB_BIN_CHUNK = 0x004e4942;  ///< "BIN\0"
+
+        /**
+         * @struct GltfAccessor
+         * @brief Resolved location and format of a glTF accessor.
+         */
+        struct GltfAccessor
+        {
+            const std::byte *data = nullptr; ///< First element, nullptr for accessors without buffer view (all zeros).
+            std::size_t count = 0;           ///< Number of elements.
+            std::size_t stride = 0;          ///< Bytes between two elements.
+            std::size_t components = 0;      ///< Components per element.
+            std::uint32_t componentType = 0; ///< glTF component type, the OpenGL type value.
+            bool normalized = false;         ///< Whether integers map to [0, 1] or [-1, 1].
+        };
+
+        [[noreturn]] inline void gltfError(std::string_view message)
+        {
+            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::GLTF::{}", message));
+        }
+
+        constexpr std::size_t MAX_COUNT = static_cast<std::size_t>(std::numeric_limits<GLsizei>::max()); ///< Most elements a draw call can address.
+        constexpr std::size_t MAX_INTEGER = std::size_t{1} << 53;                                      ///< Largest integer stored exactly by a JSON number.
+
+        /**
+         * @brief Reads a JSON number that must be an integer in [0, max], e.g. an index or a byte length.
+         *
+         * Casting other doubles to an integer type is undefined behaviour, so they are rejected.
+         */
+        inline std::size_t toInteger(const common::json::Value &value, std::string_view name, std::size_t max = MAX_INTEGER)
+        {
+            const double number = value.getNumber();
+            if (!(number >= 0.0 && number <= static_cast<double>(max)) || std::floor(number) != number)
+            {
+                gltfError(std::format("INVALID_INTEGER: {} must be an integer in [0, {}]", name, max));
+            }
+            return static_cast<std::size_t>(number);
+        }
+
+        /**
+         * @brief Reads an optional member of an object with toInteger, fallback if it is missing.
+         */
+        inline std::size_t toInteger(const common::json::Value &object, std::string_view key, std::size_t fallback, std::size_t max)
+        {
+            const common::json::Value *value = object.find(key);
+            return value ? toInteger(*value, key, max) : fallback;
+        }
+
+        constexpr std::size_t componentSize(std::uint32_t componentType)
+        {
+            switch (componentType)
+            {
+            case GL_BYTE:
+            case GL_UNSIGNED_BYTE:
+                return 1;
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT:
+                return 2;
+            case GL_UNSIGNED_INT:
+            case GL_FLOAT:
+                return 4;
+            default:
+                return 0;
+            }
+        }
+
+        inline std::size_t typeComponents(std::string_view type)
+        {
+            static constexpr std::array<std::string_view, 4> TYPES{"SCALAR", "VEC2", "VEC3", "VEC4"};
+            auto it = std::ranges::find(TYPES, type);
+            if (it == TYPES.end())
+            {
+                gltfError(std::format("UNSUPPORTED_ACCESSOR_TYPE: {}", type));
+            }
+            return static_cast<std::size_t>(it - TYPES.begin()) + 1;
+        }
+
+        /**
+         * @brief Reads one component as a float, de-quantizing normalized integers as the glTF specification does.
+         */
+        inline float readComponent(const std::byte *source, std::uint32_t componentType, bool normalized)
+        {
+            switch (componentType)
+            {
+            case GL_FLOAT:
+            {
+                float value;
+                std::memcpy(&value, source, sizeof(value));
+                return value;
+            }
+            case GL_BYTE:
+            {
+                const auto value = static_cast<std::int8_t>(*source);
+                return normalized ? std::max(value / 127.0f, -1.0f) : value;
+            }
+            case GL_UNSIGNED_BYTE:
+            {
+                const auto value = static_cast<std::uint8_t>(*source);
+                return normalized ? value / 255.0f : value;
+            }
+            case GL_SHORT:
+            {
+                std::int16_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return normalized ? std::max(value / 32767.0f, -1.0f) : value;
+            }
+            case GL_UNSIGNED_SHORT:
+            {
+                std::uint16_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return normalized ? value / 65535.0f : value;
+            }
+            default:
+            {
+                std::uint32_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return static_cast<float>(value);
+            }
+            }
+        }
+
+        /**
+         * @brief De-interleaves and de-quantizes elements [first, last) of an accessor into component arrays.
+         *
+         * Components missing from the accessor are written as zeros.
+         */
+        inline void decodeAccessor(const GltfAccessor &accessor, std::size_t first, std::size_t last, std::span<float *const> streams)
+        {
+            const std::size_t components = std::min(accessor.components, streams.size());
+            const std::size_t size = componentSize(accessor.componentType);
+            for (std::size_t component = 0; component < streams.size(); ++component)
+            {
+                float *stream = streams[component];
+                if (!accessor.data || component >= components)
+                {
+                    std::fill(stream, stream + (last - first), 0.0f);
+                    continue;
+                }
+                const std::byte *source = accessor.data + first * accessor.stride + component * size;
+                if (accessor.componentType == GL_FLOAT)
+                {
+                    for (std::size_t i = 0; i < last - first; ++i, source += accessor.stride)
+                    {
+                        std::memcpy(stream + i, source, sizeof(float));
+                    }
+                    continue;
+                }
+                for (std::size_t i = 0; i < last - first; ++i, source += accessor.stride)
+                {
+                    stream[i] = readComponent(source, accessor.componentType, accessor.normalized);
+                }
+            }
+        }
+
+        inline std::vector<std::byte> decodeBase64(std::string_view text)
+        {
+            auto value = [](char c) -> int
+            {
+                if (c >= 'A' && c <= 'Z')
+                    return c - 'A';
+                if (c >= 'a' && c <= 'z')
+                    return c - 'a' + 26;
+                if (c >= '0' && c <= '9')
+                    return c - '0' + 52;
+                if (c == '+' || c == '-')
+                    return 62;
+                if (c == '/' || c == '_')
+                    return 63;
+                return -1;
+            };
+            std::vector<std::byte> bytes;
+            bytes.reserve(text.size() / 4 * 3);
+            std::uint32_t bits = 0;
+            int bitCount = 0;
+            for (char c : text)
+            {
+                if (c == '=')
+                {
+                    break;
+                }
+                const int sextet = value(c);
+                if (sextet < 0)
+                {
+                    gltfError("INVALID_DATA_URI");
+                }
+                bits = (bits << 6) | static_cast<std::uint32_t>(sextet);
+                bitCount += 6;
+                if (bitCount >= 8)
+                {
+                    bitCount -= 8;
+                    bytes.push_back(static_cast<std::byte>((bits >> bitCount) & 0xff));
+                }
+            }
+            return bytes;
+        }
+    }
+
+    /**
+     * @class GltfImporter
+     * @brief A loaded glTF asset, decoded into vertex layouts on demand.
+     */
+    class GltfImporter
+    {
+    public:
+        static constexpr std::size_t CHUNK_SIZE = 16 * 1024; ///< Elements decoded by one task.
+
+        /**
+         * @brief Reads the document and maps or decodes its buffers.
+         * @throws common::exception::TraceableException If the file is not a valid glTF 2.0 asset,
+         *         or a buffer cannot be read.
+         */
+        explicit GltfImporter(const std::filesystem::path &path) : m_file(std::make_unique<common::io::MappedFile>(path))
+        {
+            std::span<const std::byte> file = m_file->getData();
+            std::span<const std::byte> binary;
+            std::string_view text(reinterpret_cast<const char *>(file.data()), file.size());
+            if (file.size() >= 12 && readWord(file, 0) == detail::GLB_MAGIC)
+            {
+                std::tie(text, binary) = readGlb(file);
+            }
+            m_document = common::json::parse(text);
+            if (m_document.at("asset").getString("version", "") != "2.0")
+            {
+                detail::gltfError("UNSUPPORTED_VERSION");
+            }
+            if (const common::json::Value *buffers = m_document.find("buffers"))
+            {
+                for (const common::json::Value &buffer : buffers->getArray())
+                {
+                    m_buffers.push_back(loadBuffer(buffer, path.parent_path(), binary));
+                }
+            }
+        }
+
+        /**
+         * @brief Decodes every primitive of every mesh into vertices of A.
+         *
+         * Every element of A must be made of floats.
+         *
+         * @throws common::exception::TraceableException If an accessor is invalid or out of its buffer,
+         *         or an index does not address a vertex of its primitive.
+         */
+        template <typename A>
+        std::vector<ImportedPrimitive<A>> importPrimitives(common::thread::ThreadPool &pool) const
+        {
+            constexpr std::size_t streamCount = layout::countComponents<A>();
+
+            struct Job
+            {
+                std::size_t primitive;                                      ///< Primitive written by the job.
+                std::array<detail::GltfAccessor, layout::VertexLayout<A>::elements.size()> elements; ///< Accessor of each layout element.
+                const detail::GltfAccessor *indices = nullptr;              ///< Accessor of the indices, if any.
+            };
+            std::vector<ImportedPrimitive<A>> primitives;
+            std::vector<Job> jobs;
+            std::vector<std::unique_ptr<detail::GltfAccessor>> indexAccessors;
+
+            const common::json::Value *meshes = m_document.find("meshes");
+            for (std::size_t mesh = 0; meshes && mesh < meshes->getArray().size(); ++mesh)
+            {
+                const common::json::Value &meshValue = meshes->at(mesh);
+                for (const common::json::Value &primitive : meshValue.at("primitives").getArray())
+                {
+                    Job job{primitives.size(), {}, nullptr};
+                    const common::json::Value &attributes = primitive.at("attributes");
+                    // Every attribute of a primitive has the same count, POSITION is mandatory
+                    const detail::GltfAccessor position = resolveAccessor(detail::toInteger(attributes.at("POSITION"), "POSITION"));
+                    if (!position.data)
+                    {
+                        // The count of an accessor without buffer view is not bounded by any data
+                        detail::gltfError("POSITION_WITHOUT_BUFFER_VIEW");
+                    }
+                    const std::size_t vertexCount = position.count;
+                    for (std::size_t e = 0; e < job.elements.size(); ++e)
+                    {
+                        const common::json::Value *accessor = attributes.find(semanticOf(layout::VertexLayout<A>::elements[e]));
+                        if (!accessor)
+                        {
+                            continue; // Left at zero
+                        }
+                        job.elements[e] = resolveAccessor(detail::toInteger(*accessor, "attribute"));
+                        if (job.elements[e].count != vertexCount)
+                        {
+                            detail::gltfError(std::format("ATTRIBUTE_COUNT_MISMATCH: {} has {} elements for {} vertices", semanticOf(layout::VertexLayout<A>::elements[e]), job.elements[e].count, vertexCount));
+                        }
+                    }
+
+                    ImportedPrimitive<A> &imported = primitives.emplace_back();
+                    imported.mesh = mesh;
+                    imported.name = meshValue.getString("name", "");
+                    imported.mode = static_cast<GLenum>(detail::toInteger(primitive, "mode", GL_TRIANGLES, GL_TRIANGLE_FAN));
+                    imported.vertices.resize(vertexCount);
+                    if (const common::json::Value *indices = primitive.find("indices"))
+                    {
+                        auto accessor = std::make_unique<detail::GltfAccessor>(resolveAccessor(detail::toInteger(*indices, "indices")));
+                        if (!accessor->data || accessor->components != 1 || (accessor->componentType != GL_UNSIGNED_BYTE && accessor->componentType != GL_UNSIGNED_SHORT && accessor->componentType != GL_UNSIGNED_INT))
+                        {
+                            detail::gltfError("INVALID_INDEX_ACCESSOR");
+                        }
+                        imported.indices.resize(accessor->count);
+                        job.indices = indexAccessors.emplace_back(std::move(accessor)).get();
+                    }
+                    jobs.push_back(job);
+                }
+            }
+
+            // One task per chunk of vertices or indices, across all primitives
+            struct Task
+            {
+                const Job *job;     ///< Primitive to decode.
+                bool indices;       ///< Whether the chunk is made of indices rather than vertices.
+                std::size_t first;  ///< First element of the chunk.
+                std::size_t last;   ///< Past-the-end element of the chunk.
+            };
+            std::vector<Task> tasks;
+            for (const Job &job : jobs)
+            {
+                const std::size_t vertexCount = primitives[job.primitive].vertices.size();
+                for (std::size_t first = 0; first < vertexCount; first += CHUNK_SIZE)
+                {
+                    tasks.push_back({&job, false, first, std::min(vertexCount, first + CHUNK_SIZE)});
+                }
+                const std::size_t indexCount = primitives[job.primitive].indices.size();
+                for (std::size_t first = 0; first < indexCount; first += CHUNK_SIZE)
+                {
+                    tasks.push_back({&job, true, first, std::min(indexCount, first + CHUNK_SIZE)});
+                }
+            }
+
+            pool.parallelFor(tasks.size(), 1, [&tasks, &primitives](std::size_t first, std::size_t last)
+                             {
+                                 std::vector<float> scratch(streamCount * CHUNK_SIZE);
+                                 for (std::size_t t = first; t < last; ++t)
+                                 {
+                                     const Task &task = tasks[t];
+                                     ImportedPrimitive<A> &primitive = primitives[task.job->primitive];
+                                     if (task.indices)
+                                     {
+                                         decodeIndices(*task.job->indices, task.first, task.last, primitive.indices, primitive.vertices.size());
+                                     }
+                                     else
+                                     {
+                                         decodeVertices<A>(task.job->elements, task.first, task.last, scratch, std::as_writable_bytes(std::span<A>(primitive.vertices)));
+                                     }
+                                 } });
+            return primitives;
+        }
+
+        [[nodiscard]] const common::json::Value &getDocument() const
+        {
+            return m_document;
+        }
+
+    private:
+        static std::uint32_t readWord(std::span<const std::byte> bytes, std::size_t offset)
+        {
+            std::uint32_t word;
+            std::memcpy(&word, bytes.data() + offset, sizeof(word));
+            return word;
+        }
+
+        /**
+         * @brief Splits a GLB container into its JSON and binary chunks.
+         */
+        static std::pair<std::string_view, std::span<const std::byte>> readGlb(std::span<const std::byte> file)
+        {
+            if (readWord(file, 4) != 2)
+            {
+                detail::gltfError("UNSUPPORTED_VERSION");
+            }
+            std::string_view text;
+            std::span<const std::byte> binary;
+            for (std::size_t offset = 12; offset + 8 <= file.size();)
+            {
+                const std::size_t length = readWord(file, offset);
+                const std::uint32_t type = readWord(file, offset + 4);
+                if (length > file.size() - offset - 8)
+                {
+                    detail::gltfError("TRUNCATED_CHUNK");
+                }
+                std::span<const std::byte> chunk = file.subspan(offset + 8, length);
+                if (type == detail::GLB_JSON_CHUNK && text.empty())
+                {
+                    text = std::string_view(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+                }
+                else if (type == detail::GLB_BIN_CHUNK && binary.empty())
+                {
+                    binary = chunk;
+                }
+                offset += 8 + length;
+            }
+            if (text.empty())
+            {
+                detail::gltfError("MISSING_JSON_CHUNK");
+            }
+            return {text, binary};
+        }
+
+        /**
+         * @brief Bytes of a buffer: the GLB binary chunk, a base64 data URI or a mapped file.
+         */
+        std::span<const std::byte> loadBuffer(const common::json::Value &buffer, const std::filesystem::path &directory, std::span<const std::byte> binary)
+        {
+            const std::size_t length = detail::toInteger(buffer.at("byteLength"), "byteLength");
+            std::span<const std::byte> data;
+            const common::json::Value *uri = buffer.find("uri");
+            if (!uri)
+            {
+                data = binary;
+            }
+            else if (std::string_view text = uri->getString(); text.starts_with("data:"))
+            {
+                const std::size_t comma = text.find(',');
+                if (comma == std::string_view::npos || text.substr(0, comma).find(";base64") == std::string_view::npos)
+                {
+                    detail::gltfError("INVALID_DATA_URI");
+                }
+                data = m_decoded.emplace_back(detail::decodeBase64(text.substr(comma + 1)));
+            }
+            else if (text.find("://") != std::string_view::npos)
+            {
+                detail::gltfError(std::format("REMOTE_URI_NOT_SUPPORTED: {}", text));
+            }
+            else
+            {
+                data = m_mapped.emplace_back(std::make_unique<common::io::MappedFile>(directory / std::filesystem::u8path(text)))->getData();
+            }
+            if (data.size() < length)
+            {
+                detail::gltfError(std::format("TRUNCATED_BUFFER: {} bytes expected, {} available", length, data.size()));
+            }
+            return data.first(length);
+        }
+
+        /**
+         * @brief Locates an accessor in its buffer, checking that all of its elements are inside the buffer view.
+         */
+        detail::GltfAccessor resolveAccessor(std::size_t index) const
+        {
+            const common::json::Value &accessor = m_document.at("accessors").at(index);
+            if (accessor.find("sparse"))
+            {
+                detail::gltfError("SPARSE_ACCESSOR_NOT_SUPPORTED");
+            }
+            detail::GltfAccessor resolved;
+            resolved.count = detail::toInteger(accessor.at("count"), "count", detail::MAX_COUNT);
+            resolved.components = detail::typeComponents(accessor.at("type").getString());
+            resolved.componentType = static_cast<std::uint32_t>(detail::toInteger(accessor.at("componentType"), "componentType", std::numeric_limits<std::uint32_t>::max()));
+            resolved.normalized = accessor.getBool("normalized", false);
+            const std::size_t elementSize = detail::componentSize(resolved.componentType) * resolved.components;
+            if (elementSize == 0)
+            {
+                detail::gltfError(std::format("UNSUPPORTED_COMPONENT_TYPE: {}", resolved.componentType));
+            }
+            const common::json::Value *viewIndex = accessor.find("bufferView");
+            if (!viewIndex)
+            {
+                return resolved;
+            }
+            const common::json::Value &view = m_document.at("bufferViews").at(detail::toInteger(*viewIndex, "bufferView"));
+            const std::size_t bufferIndex = detail::toInteger(view.at("buffer"), "buffer");
+            if (bufferIndex >= m_buffers.size())
+            {
+                detail::gltfError("INVALID_BUFFER");
+            }
+            std::span<const std::byte> buffer = m_buffers[bufferIndex];
+            const std::size_t viewOffset = detail::toInteger(view, "byteOffset", 0, detail::MAX_INTEGER);
+            const std::size_t viewLength = detail::toInteger(view.at("byteLength"), "byteLength");
+            const std::size_t offset = detail::toInteger(accessor, "byteOffset", 0, detail::MAX_INTEGER);
+            resolved.stride = detail::toInteger(view, "byteStride", elementSize, detail::MAX_INTEGER);
+            // offset + (count - 1) * stride + elementSize <= viewLength, without overflowing
+            const bool elementsInView = resolved.stride >= elementSize &&
+                                        (resolved.count == 0 || (offset <= viewLength && elementSize <= viewLength - offset &&
+                                                                 resolved.count - 1 <= (viewLength - offset - elementSize) / resolved.stride));
+            if (viewOffset > buffer.size() || viewLength > buffer.size() - viewOffset || !elementsInView)
+            {
+                detail::gltfError(std::format("ACCESSOR_OUT_OF_RANGE: accessor {}", index));
+            }
+            resolved.data = buffer.data() + viewOffset + offset;
+            return resolved;
+        }
+
+        /**
+         * @brief glTF attribute read by a layout element: its name in upper case, POSITION for unnamed elements.
+         */
+        static std::string semanticOf(const layout::VertexElement &element)
+        {
+            std::string semantic = element.name ? element.name : "POSITION";
+            std::ranges::transform(semantic, semantic.begin(), [](unsigned char c)
+                                   { return static_cast<char>(std::toupper(c)); });
+            return semantic;
+        }
+
+        template <typename A, std::size_t N>
+        static void decodeVertices(const std::array<detail::GltfAccessor, N> &elements, std::size_t first, std::size_t last, std::vector<float> &scratch, std::span<std::byte> vertices)
+        {
+            const std::size_t count = last - first;
+            std::array<float *, layout::countComponents<A>()> streams;
+            std::size_t stream = 0;
+            for (std::size_t e = 0; e < N; ++e)
+            {
+                const auto components = static_cast<std::size_t>(layout::VertexLayout<A>::elements[e].components);
+                for (std::size_t c = 0; c < components; ++c, ++stream)
+                {
+                    streams[stream] = scratch.data() + stream * CHUNK_SIZE;
+                }
+                detail::decodeAccessor(elements[e], first, last, std::span<float *const>(streams).subspan(stream - components, components));
+            }
+            layout::interleaveVertices<A>(streams, count, vertices.subspan(first * sizeof(A), count * sizeof(A)));
+        }
+
+        static void decodeIndices(const detail::GltfAccessor &accessor, std::size_t first, std::size_t last, std::vector<std::uint32_t> &indices, std::size_t vertexCount)
+        {
+            const std::size_t size = detail::componentSize(accessor.componentType);
+            const std::byte *source = accessor.data + first * accessor.stride;
+            for (std::size_t i = first; i < last; ++i, source += accessor.stride)
+            {
+                std::uint32_t index = 0;
+                std::memcpy(&index, source, size); // Little-endian: the low bytes come first
+                if (index >= vertexCount)
+                {
+                    detail::gltfError(std::format("INDEX_OUT_OF_RANGE: Index {} addresses one of {} vertices", index, vertexCount));
+                }
+                indices[i] = index;
+            }
+        }
+
+        std::unique_ptr<common::io::MappedFile> m_file;                   ///< Mapping of the .gltf or .glb file.
+        common::json::Value m_document;                                   ///< Parsed JSON document.
+        std::vector<std::unique_ptr<common::io::MappedFile>> m_mapped;    ///< Mappings of the external buffers.
+        std::vector<std::vector<std::byte>> m_decoded;                    ///< Buffers decoded from data URIs.
+        std::vector<std::span<const std::byte>> m_buffers;                ///< Bytes of each buffer.
+    };
+}
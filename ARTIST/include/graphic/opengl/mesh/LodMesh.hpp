@@ -0,0 +1,142 @@
+/**
+ * @file LodMesh.hpp
+ * @brief Levels of detail of a mesh, stored back to back in one arena range and selected per draw.
+ *
+ * Every level indexes the same vertices, so a LOD chain only adds indices: all levels are uploaded
+ * into a single range of the arena, behind one index buffer. The vertex array object the pass
+ * captures is therefore the same for every level, and switching level only changes the range
+ * given to glDrawElements.
+ *
+ * At draw time, the level is the coarsest whose error, projected on screen with the LOD projection
+ * of the pass, stays under its pixel threshold: distant objects are drawn with fewer triangles.
+ *
+ * @code
+ * mesh::LodMesh lods = mesh::uploadLodChain(geometry::buildLodChain(indices, positions), vertexCount, arena);
+ * lods.attach(*pass->getContext());
+ * pass->getContext()->setLodProjection(geometry::LodProjection::perspective(fov, viewportHeight));
+ * // each frame:
+ * pass->use();
+ * lods.draw(*pass->getContext(), distanceToCamera);
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <span>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/geometry/Lod.hpp>
+#include <graphic/opengl/buffer/BufferArena.hpp>
+#include <graphic/opengl/buffer/IndexBuffer.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+
+namespace artist::graphic::opengl::mesh
+{
+    /**
+     * @struct LodMeshLevel
+     * @brief Range of one level of detail in the index buffer of its LodMesh.
+     */
+    struct LodMeshLevel
+    {
+        GLsizei firstIndex = 0; ///< First index of the level.
+        GLsizei count = 0;      ///< Number of indices of the level.
+        float error = 0.0f;     ///< Distance to the source surface, in mesh units.
+    };
+
+    /**
+     * @struct LodMesh
+     * @brief Indices of every level of detail of a mesh, from the finest to the coarsest.
+     */
+    struct LodMesh
+    {
+        std::shared_ptr<buffer::IndexBuffer> indices; ///< All the levels, back to back in one arena range.
+        std::vector<LodMeshLevel> levels;             ///< Levels, source first.
+
+        /**
+         * @brief Makes the pass capture the indices of the levels in its vertex array object.
+         */
+        void attach(context::OpenGLPassContext &pass) const
+        {
+            pass.setIndexBuffer(indices);
+        }
+
+        /**
+         * @brief Selects the coarsest level whose error is below the threshold on screen.
+         * @param distance Distance from the camera to the mesh, in mesh units.
+         */
+        [[nodiscard]] std::size_t selectLevel(float distance, const geometry::LodProjection &projection) const
+        {
+            std::size_t selected = 0;
+            for (std::size_t level = 1; level < levels.size(); ++level)
+            {
+                if (projection.project(levels[level].error, distance) > projection.threshold)
+                {
+                    break; // Errors grow along the chain
+                }
+                selected = level;
+            }
+            return selected;
+        }
+
+        /**
+         * @brief Draws the level selected for the LOD projection of a pass, with the pass in use.
+         * @param distance Distance from the camera to the mesh, in mesh units.
+         * @return The level drawn.
+         * @throws common::exception::TraceableException If the mesh is not attached to the pass.
+         */
+        std::size_t draw(const context::OpenGLPassContext &pass, float distance, GLenum mode = GL_TRIANGLES) const
+        {
+            if (pass.getIndexBuffer() != indices)
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::LOD_MESH::NOT_ATTACHED: The pass does not use the indices of the mesh");
+            }
+            // Without a projection, pixelScale is 0 and every error projects to 0: use the source
+            const std::size_t level = pass.getLodProjection().pixelScale > 0.0f ? selectLevel(distance, pass.getLodProjection()) : 0;
+            indices->draw(levels[level].firstIndex, levels[level].count, mode);
+            return level;
+        }
+    };
+
+    /**
+     * @brief Uploads a LOD chain into a single range of an arena.
+     * @param chain Levels of detail, source first, e.g. from geometry::buildLodChain.
+     * @param vertexCount Number of vertices the levels index.
+     * @throws common::exception::TraceableException If the chain is empty or an index is not below vertexCount.
+     */
+    inline LodMesh uploadLodChain(std::span<const geometry::LodLevel> chain, std::size_t vertexCount, buffer::BufferArena &arena)
+    {
+        if (chain.empty())
+        {
+            throw common::exception::TraceableException<std::runtime_error>("ERROR::LOD_MESH::EMPTY");
+        }
+        LodMesh mesh;
+        std::vector<std::uint32_t> indices;
+        for (const geometry::LodLevel &level : chain)
+        {
+            mesh.levels.push_back({static_cast<GLsizei>(indices.size()), static_cast<GLsizei>(level.indices.size()), level.error});
+            indices.insert(indices.end(), level.indices.begin(), level.indices.end());
+        }
+        const GLsizeiptr indexSize = buffer::IndexBuffer::selectIndexType(vertexCount) == GL_UNSIGNED_SHORT ? 2 : 4;
+        mesh.indices = std::make_shared<buffer::IndexBuffer>();
+        mesh.indices->setAllocation(arena.allocate(static_cast<GLsizeiptr>(indices.size()) * indexSize));
+        mesh.indices->set(indices, vertexCount);
+        return mesh;
+    }
+
+    /**
+     * @brief Releases the arena range of a LOD mesh.
+     */
+    inline void freeLodMesh(LodMesh &mesh, buffer::BufferArena &arena)
+    {
+        if (mesh.indices)
+        {
+            arena.free(mesh.indices->getAllocation());
+        }
+        mesh = LodMesh{};
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ * @file Mesh.hpp
+ * @brief Upload of mesh files into shared buffers.
+ *
+ * The vertex and index blobs of a mapped mesh file are uploaded as they are, straight from the
+ * mapping: either synchronously with glBufferSubData, or through an upload queue whose worker copies
+ * them into its persistently mapped staging buffer. Nothing is parsed or converted on the way, so
+ * loading is bounded by the time the operating system takes to page the file in.
+ *
+ * @code
+ * auto file = std::make_shared<MeshFile>("bunny.amsh");
+ * Mesh mesh = loadMesh(file, arena, uploads);
+ * mesh.attach(*positionAttribute->getContext());
+ * mesh.attach(*normalAttribute->getContext());
+ * // once mesh.ready is ready:
+ * pass->use();
+ * mesh.draw();
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <format>
+#include <future>
+#include <memory>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/opengl/buffer/BufferAllocation.hpp>
+#include <graphic/opengl/buffer/BufferArena.hpp>
+#include <graphic/opengl/buffer/IndexBuffer.hpp>
+#include <graphic/opengl/buffer/UploadQueue.hpp>
+#include <graphic/opengl/context/AttributeContext.hpp>
+#include <graphic/opengl/mesh/MeshFile.hpp>
+
+namespace artist::graphic::opengl::mesh
+{
+    /**
+     * @struct Mesh
+     * @brief The buffers of a loaded mesh file.
+     */
+    struct Mesh
+    {
+        std::shared_ptr<MeshFile> file;                     ///< Source file, kept mapped until the uploads complete.
+        std::shared_ptr<buffer::BufferAllocation> vertices; ///< Range holding the vertex blob.
+        std::shared_ptr<buffer::IndexBuffer> indices;       ///< Indices, null for non-indexed meshes.
+        std::shared_future<void> ready;                     ///< Ready once the GPU holds the blobs.
+
+        /**
+         * @brief Makes an attribute read its values from the mesh vertices.
+         *
+         * The element is looked up by attribute name, and single-element meshes match any name.
+         *
+         * @throws common::exception::TraceableException If the mesh has no element for the attribute.
+         */
+        void attach(context::OpenGLAttributeContext &attribute) const
+        {
+            const MeshView &view = file->getView();
+            const MeshFileElement *element = view.findElement(attribute.getAttributeName());
+            if (!element)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH::ELEMENT_NOT_FOUND: No element named {} in the mesh", attribute.getAttributeName()));
+            }
+            attribute.setGLSize(element->components);
+            attribute.setGLType(element->glType);
+            attribute.setNormalized(element->normalized ? GL_TRUE : GL_FALSE);
+            attribute.setStride(static_cast<GLsizei>(view.header.vertexStride));
+            attribute.setOffset(static_cast<GLsizei>(element->offset));
+            attribute.setVertexFetch(layout::defaultFetch(element->glType, element->normalized));
+            attribute.setAllocation(vertices);
+        }
+
+        /**
+         * @brief Issues a draw of the whole mesh, with the vertex array object of the pass bound.
+         */
+        void draw(GLenum mode = GL_TRIANGLES) const
+        {
+            if (indices)
+            {
+                indices->draw(mode);
+            }
+            else
+            {
+                // parseMesh rejects vertex counts above the GLsizei maximum
+                glDrawArrays(mode, 0, static_cast<GLsizei>(file->getView().header.vertexCount));
+            }
+        }
+    };
+
+    namespace detail
+    {
+        inline Mesh allocateMesh(std::shared_ptr<MeshFile> file, buffer::BufferArena &arena)
+        {
+            const MeshView &view = file->getView();
+            if (view.vertices.empty())
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::MESH::EMPTY");
+            }
+            Mesh mesh;
+            mesh.vertices = arena.allocate(static_cast<GLsizeiptr>(view.vertices.size()));
+            if (!view.indices.empty())
+            {
+                mesh.indices = std::make_shared<buffer::IndexBuffer>();
+                mesh.indices->setAllocation(arena.allocate(static_cast<GLsizeiptr>(view.indices.size())));
+            }
+            mesh.file = std::move(file);
+            return mesh;
+        }
+    }
+
+    /**
+     * @brief Uploads a mesh file into ranges of an arena, on the calling GL thread.
+     *
+     * The driver reads the blobs straight from the file mapping.
+     *
+     * @throws common::exception::TraceableException If the mesh has no vertices.
+     */
+    inline Mesh loadMesh(std::shared_ptr<MeshFile> file, buffer::BufferArena &arena)
+    {
+        Mesh mesh = detail::allocateMesh(std::move(file), arena);
+        const MeshView &view = mesh.file->getView();
+        glBindBuffer(GL_COPY_WRITE_BUFFER, mesh.vertices->bufferId);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, mesh.vertices->offset, static_cast<GLsizeiptr>(view.vertices.size()), view.vertices.data());
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        if (mesh.indices)
+        {
+            mesh.indices->setEncoded(view.indices, view.header.indexType);
+        }
+        std::promise<void> uploaded;
+        uploaded.set_value();
+        mesh.ready = uploaded.get_future().share();
+        return mesh;
+    }
+
+    /**
+     * @brief Queues the upload of a mesh file into ranges of an arena.
+     *
+     * The queue stages the blobs from the file mapping into its persistently mapped staging buffer.
+     * The mesh keeps the file mapped, so it must outlive mesh.ready.
+     *
+     * @throws common::exception::TraceableException If the mesh has no vertices.
+     */
+    inline Mesh loadMesh(std::shared_ptr<MeshFile> file, buffer::BufferArena &arena, buffer::UploadQueue &uploads)
+    {
+        Mesh mesh = detail::allocateMesh(std::move(file), arena);
+        const MeshView &view = mesh.file->getView();
+        mesh.ready = uploads.submit(view.vertices, mesh.vertices);
+        if (mesh.indices)
+        {
+            const std::uint64_t indexSize = detail::indexSize(view.header.indexType);
+            mesh.indices->describe(view.header.indexType, static_cast<GLsizei>(view.indices.size() / indexSize));
+            // Uploads complete in order: the index upload is the last one to wait for
+            mesh.ready = uploads.submit(view.indices, mesh.indices->getAllocation());
+        }
+        return mesh;
+    }
+
+    /**
+     * @brief Releases the buffer ranges of a mesh loaded from the arena.
+     */
+    inline void freeMesh(Mesh &mesh, buffer::BufferArena &arena)
+    {
+        if (mesh.vertices)
+        {
+            arena.free(mesh.vertices);
+        }
+        if (mesh.indices)
+        {
+            arena.free(mesh.indices->getAllocation());
+        }
+        mesh = Mesh{};
+    }
+}
@@ -0,0 +1,346 @@
+/**
+ * @file MeshFile.hpp
+ * @brief Binary mesh container loaded without parsing.
+ *
+ * A mesh file is laid out exactly as the buffers it fills, so loading it is a memory mapping and
+ * one upload per blob:
+ *
+ * | Part        | Contents                                                          |
+ * |-------------|-------------------------------------------------------------------|
+ * | Header      | MeshFileHeader: magic, version, counts, offsets and sizes of blobs |
+ * | Elements    | One MeshFileElement per vertex layout element                      |
+ * | Vertex blob | Interleaved vertices, BLOB_ALIGNMENT aligned                       |
+ * | Index blob  | 16 or 32-bit indices, BLOB_ALIGNMENT aligned                       |
+ *
+ * Elements use the OpenGL types and offsets of the vertex layouts, so they map one to one to
+ * attribute formats. All values are little-endian.
+ *
+ * @code
+ * std::ofstream out("bunny.amsh", std::ios::binary);
+ * writeMesh<Vertex>(out, vertices, indices); // offline
+ *
+ * auto file = std::make_shared<MeshFile>("bunny.amsh"); // at load time, see Mesh.hpp
+ * Mesh mesh = loadMesh(file, arena);
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <common/io/MappedFile.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+
+namespace artist::graphic::opengl::mesh
+{
+    static_assert(std::endian::native == std::endian::little, "Mesh files are stored little-endian");
+
+    constexpr std::uint32_t MESH_FILE_MAGIC = 0x48534d41; ///< "AMSH"
+    constexpr std::uint32_t MESH_FILE_VERSION = 1;
+    constexpr std::size_t BLOB_ALIGNMENT = 64; ///< Alignment of the blobs in the file.
+    constexpr std::size_t ELEMENT_NAME_SIZE = 32;
+
+    /**
+     * @struct MeshFileHeader
+     * @brief First bytes of a mesh file.
+     */
+    struct MeshFileHeader
+    {
+        std::uint32_t magic = MESH_FILE_MAGIC;     ///< Identifies mesh files.
+        std::uint32_t version = MESH_FILE_VERSION; ///< Format version.
+        std::uint32_t elementCount = 0;            ///< Number of MeshFileElement following the header.
+        std::uint32_t vertexStride = 0;            ///< Byte size of one vertex.
+        std::uint64_t vertexCount = 0;             ///< Number of vertices.
+        std::uint64_t indexCount = 0;              ///< Number of indices, 0 for non-indexed meshes.
+        std::uint32_t indexType = 0;               ///< GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, 0 without indices.
+        std::uint32_t reserved = 0;                ///< Padding, must be 0.
+        std::uint64_t vertexOffset = 0;            ///< Byte offset of the vertex blob.
+        std::uint64_t indexOffset = 0;             ///< Byte offset of the index blob.
+    };
+
+    /**
+     * @struct MeshFileElement
+     * @brief One vertex layout element, as stored in a mesh file.
+     */
+    struct MeshFileElement
+    {
+        char name[ELEMENT_NAME_SIZE] = {}; ///< Attribute name, zero padded. Empty for single-element layouts.
+        std::uint32_t components = 0;      ///< Number of components (1 to 4).
+        std::uint32_t glType = 0;          ///< OpenGL component type.
+        std::uint32_t normalized = 0;      ///< Whether integer data is normalized when fetched.
+        std::uint32_t offset = 0;          ///< Byte offset of the element inside one vertex.
+
+        [[nodiscard]] std::string_view getName() const
+        {
+            return {name, std::find(name, name + ELEMENT_NAME_SIZE, '\0')};
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<MeshFileHeader> && sizeof(MeshFileHeader) == 56);
+    static_assert(std::is_trivially_copyable_v<MeshFileElement> && sizeof(MeshFileElement) == 48);
+
+    /**
+     * @struct MeshView
+     * @brief A validated mesh file. The blobs point into the file memory.
+     */
+    struct MeshView
+    {
+        MeshFileHeader header;                 ///< Copy of the header.
+        std::vector<MeshFileElement> elements; ///< Copy of the layout elements.
+        std::span<const std::byte> vertices;   ///< Vertex blob.
+        std::span<const std::byte> indices;    ///< Index blob, empty without indices.
+
+        /**
+         * @brief Finds the element feeding a shader attribute, as layout::findElement does.
+         * @return The matching element, or nullptr if the mesh has no element with that name.
+         */
+        [[nodiscard]] const MeshFileElement *findElement(std::string_view name) const
+        {
+            if (elements.size() == 1)
+            {
+                return &elements[0];
+            }
+            auto it = std::ranges::find(elements, name, &MeshFileElement::getName);
+            return it == elements.end() ? nullptr : &*it;
+        }
+    };
+
+    namespace detail
+    {
+        constexpr std::uint64_t alignUp(std::uint64_t value)
+        {
+            return (value + BLOB_ALIGNMENT - 1) / BLOB_ALIGNMENT * BLOB_ALIGNMENT;
+        }
+
+        constexpr std::uint64_t indexSize(std::uint32_t indexType)
+        {
+            return indexType == GL_UNSIGNED_SHORT ? 2 : indexType == GL_UNSIGNED_INT ? 4 : 0;
+        }
+
+        /**
+         * @brief Byte size of an element of a supported component type, 0 for any other type.
+         */
+        constexpr std::uint64_t elementSize(std::uint32_t glType, std::uint32_t components)
+        {
+            switch (glType)
+            {
+            case GL_BYTE:
+            case GL_UNSIGNED_BYTE:
+                return components;
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT:
+            case GL_HALF_FLOAT:
+                return 2 * std::uint64_t{components};
+            case GL_INT:
+            case GL_UNSIGNED_INT:
+            case GL_FLOAT:
+                return 4 * std::uint64_t{components};
+            case GL_DOUBLE:
+                return 8 * std::uint64_t{components};
+            case GL_INT_2_10_10_10_REV:
+            case GL_UNSIGNED_INT_2_10_10_10_REV:
+                return components == 4 ? 4 : 0;
+            default:
+                return 0;
+            }
+        }
+
+        /**
+         * @brief Largest value of an index blob, read in a single pass.
+         */
+        template <typename Index>
+        std::uint32_t maxIndex(std::span<const std::byte> indices)
+        {
+            std::uint32_t max = 0;
+            for (std::size_t offset = 0; offset < indices.size(); offset += sizeof(Index))
+            {
+                Index index;
+                std::memcpy(&index, indices.data() + offset, sizeof(Index));
+                max = std::max<std::uint32_t>(max, index);
+            }
+            return max;
+        }
+
+        inline void checkRange(std::span<const std::byte> file, std::uint64_t offset, std::uint64_t size, std::string_view part)
+        {
+            if (offset > file.size() || size > file.size() - offset)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::TRUNCATED: The {} ({} bytes at offset {}) exceeds a file of {} bytes", part, size, offset, file.size()));
+            }
+        }
+
+        /**
+         * @brief Checks that count entries of entrySize bytes at offset fit in the file, without computing their
+         *        size first, and that a draw call can address them.
+         * @return The byte size of the entries.
+         */
+        inline std::uint64_t checkArray(std::span<const std::byte> file, std::uint64_t offset, std::uint64_t count, std::uint64_t entrySize, std::string_view part)
+        {
+            if (count > static_cast<std::uint64_t>(std::numeric_limits<GLsizei>::max()))
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::TOO_LARGE: The {} has {} entries, more than a draw call can address", part, count));
+            }
+            if (offset > file.size() || (count != 0 && count > (file.size() - offset) / entrySize))
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::TRUNCATED: The {} ({} entries of {} bytes at offset {}) exceeds a file of {} bytes", part, count, entrySize, offset, file.size()));
+            }
+            return count * entrySize;
+        }
+    }
+
+    /**
+     * @brief Validates the contents of a mesh file, without copying the blobs.
+     * @throws common::exception::TraceableException If the data is not a valid mesh file.
+     */
+    inline MeshView parseMesh(std::span<const std::byte> file)
+    {
+        MeshView view;
+        detail::checkRange(file, 0, sizeof(MeshFileHeader), "header");
+        std::memcpy(&view.header, file.data(), sizeof(MeshFileHeader));
+        const MeshFileHeader &header = view.header;
+        if (header.magic != MESH_FILE_MAGIC)
+        {
+            throw common::exception::TraceableException<std::runtime_error>("ERROR::MESH_FILE::BAD_MAGIC");
+        }
+        if (header.version != MESH_FILE_VERSION)
+        {
+            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::UNSUPPORTED_VERSION: {}", header.version));
+        }
+        if (header.vertexStride == 0 || (header.indexCount != 0) != (detail::indexSize(header.indexType) != 0) || header.vertexOffset % BLOB_ALIGNMENT != 0 || header.indexOffset % BLOB_ALIGNMENT != 0)
+        {
+            throw common::exception::TraceableException<std::runtime_error>("ERROR::MESH_FILE::INVALID_HEADER");
+        }
+
+        const std::uint64_t elementsSize = std::uint64_t{header.elementCount} * sizeof(MeshFileElement);
+        detail::checkRange(file, sizeof(MeshFileHeader), elementsSize, "element table");
+        view.elements.resize(header.elementCount);
+        std::memcpy(view.elements.data(), file.data() + sizeof(MeshFileHeader), elementsSize);
+        for (const MeshFileElement &element : view.elements)
+        {
+            const std::uint64_t size = element.components < 1 || element.components > 4 ? 0 : detail::elementSize(element.glType, element.components);
+            if (size == 0 || std::uint64_t{element.offset} + size > header.vertexStride)
+            {
+                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::INVALID_ELEMENT: {}", element.getName()));
+            }
+        }
+
+        const std::uint64_t verticesSize = detail::checkArray(file, header.vertexOffset, header.vertexCount, header.vertexStride, "vertex blob");
+        const std::uint64_t indicesSize = detail::checkArray(file, header.indexOffset, header.indexCount, detail::indexSize(header.indexType), "index blob");
+        view.vertices = file.subspan(header.vertexOffset, verticesSize);
+        view.indices = file.subspan(header.indexOffset, indicesSize);
+
+        // Out of range indices would make draws read the vertices of other meshes sharing the buffer
+        const std::uint32_t maxIndex = header.indexType == GL_UNSIGNED_SHORT ? detail::maxIndex<std::uint16_t>(view.indices) : detail::maxIndex<std::uint32_t>(view.indices);
+        if (!view.indices.empty() && maxIndex >= header.vertexCount)
+        {
+            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::MESH_FILE::INDEX_OUT_OF_RANGE: Index {} addresses one of {} vertices", maxIndex, header.vertexCount));
+        }
+        return view;
+    }
+
+    /**
+     * @brief Writes a mesh file of vertices of A.
+     *
+     * Indices are stored 16-bit wide when the vertex count allows it.
+     *
+     * @throws common::exception::TraceableException If an index is not below the vertex count.
+     */
+    template <typename A>
+    void writeMesh(std::ostream &out, std::span<const A> vertices, std::span<const std::uint32_t> indices)
+    {
+        static_assert(std::is_trivially_copyable_v<A>, "Vertices are written as raw bytes");
+        if (auto it = std::ranges::find_if(indices, [&vertices](std::uint32_t index)
+                                           { return index >= vertices.size(); });
+            it != indices.end())
+        {
+            throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::MESH_FILE::INDEX_OUT_OF_RANGE: Index {} addresses one of {} vertices", *it, vertices.size()));
+        }
+
+        MeshFileHeader header;
+        header.elementCount = static_cast<std::uint32_t>(layout::VertexLayout<A>::elements.size());
+        header.vertexStride = static_cast<std::uint32_t>(layout::VertexLayout<A>::stride);
+        header.vertexCount = vertices.size();
+        header.indexCount = indices.size();
+        header.indexType = indices.empty() ? 0 : vertices.size() <= 0x10000 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        header.vertexOffset = detail::alignUp(sizeof(MeshFileHeader) + header.elementCount * sizeof(MeshFileElement));
+        header.indexOffset = detail::alignUp(header.vertexOffset + vertices.size_bytes());
+
+        std::vector<MeshFileElement> elements;
+        for (const layout::VertexElement &element : layout::VertexLayout<A>::elements)
+        {
+            MeshFileElement stored;
+            if (element.name)
+            {
+                std::strncpy(stored.name, element.name, ELEMENT_NAME_SIZE - 1);
+            }
+            stored.components = static_cast<std::uint32_t>(element.components);
+            stored.glType = element.glType;
+            stored.normalized = element.normalized;
+            stored.offset = static_cast<std::uint32_t>(element.offset);
+            elements.push_back(stored);
+        }
+
+        std::uint64_t written = 0;
+        auto write = [&out, &written](const void *data, std::uint64_t size)
+        {
+            out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+            written += size;
+        };
+        auto pad = [&write, &written](std::uint64_t offset)
+        {
+            static constexpr char zeros[BLOB_ALIGNMENT] = {};
+            write(zeros, offset - written);
+        };
+        write(&header, sizeof(header));
+        write(elements.data(), elements.size() * sizeof(MeshFileElement));
+        pad(header.vertexOffset);
+        write(vertices.data(), vertices.size_bytes());
+        pad(header.indexOffset);
+        if (header.indexType == GL_UNSIGNED_SHORT)
+        {
+            std::vector<std::uint16_t> narrowed(indices.begin(), indices.end());
+            write(narrowed.data(), narrowed.size() * sizeof(std::uint16_t));
+        }
+        else
+        {
+            write(indices.data(), indices.size_bytes());
+        }
+    }
+
+    /**
+     * @class MeshFile
+     * @brief A memory-mapped, validated mesh file.
+     */
+    class MeshFile
+    {
+    public:
+        /**
+         * @throws common::exception::TraceableException If the file cannot be mapped or is not a valid mesh file.
+         */
+        explicit MeshFile(const std::filesystem::path &path) : m_file(path), m_view(parseMesh(m_file.getData()))
+        {
+        }
+
+        [[nodiscard]] const MeshView &getView() const
+        {
+            return m_view;
+        }
+
+    private:
+        common::io::MappedFile m_file; ///< Mapping of the file.
+        MeshView m_view;               ///< Validated contents, pointing into the mapping.
+    };
+}
@@ -21,19 +21,15 @@ namespace artist::graphic::opengl::pipeline::component::attribute
     class OpenGLBinder<graphic::opengl::profile::Attribute::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::AttributeContext> attribute)
+        static void on(typename graphic::api::OpenGL::AttributeContext &attribute)
         {
-            if (!attribute)
-            {
-                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::NON_OPENGL_CONTEXT"));
-            }
-            if (attribute->getBufferID() == 0)
+            if (attribute.getBufferID() == 0)
             {
                 unsigned int VBO;
                 glGenBuffers(1, &VBO);
-                attribute->setBufferID(VBO);
+                attribute.setBufferID(VBO);
             }
-            glBindBuffer(GL_ARRAY_BUFFER, attribute->getBufferID());
+            glBindBuffer(GL_ARRAY_BUFFER, attribute.getBufferID());
         }
     };
 }
@@ -5,30 +5,348 @@
 #include <GL/glew.h>
 #include <string>
 #include <memory>
-#include <any>
 #include <graphic/opengl/context/AttributeContext.hpp>
 #include <graphic/Api.hpp>
 #include <graphic/opengl/profile/Attribute.hpp>
+#include <vector>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+#include <graphic/opengl/layout/VertexEncoding.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+#include <graphic/opengl/buffer/StreamingBuffer.hpp>
+#include <graphic/opengl/buffer/UsageTracker.hpp>
 
 namespace artist::graphic::opengl::pipeline::component::attribute
 {
+    /**
+     * @class OpenGLSetter
+     * @brief Uploads the values of an attribute to its bound buffer.
+     *
+     * Only the dirty ranges of the data set on the context are uploaded, one glBufferSubData per
+     * merged range. A buffer whose size changes is reallocated; a full rewrite of a buffer of the
+     * same size orphans its data store first, so the driver does not stall on draws still reading
+     * the previous contents. Attributes stored in a range of a shared buffer are written in place.
+     *
+     * The vertex format comes from the vertex layout of A: for interleaved layouts, the element
+     * named after the attribute is used. The format is only recorded on the context, the pass
+     * specifies it once in its vertex array object. Setting interleaved vertices on each attribute
+     * stores the whole array once per attribute: buffer::InterleavedBuffer holds it once for all of them.
+     *
+     * Float streams can be compressed by setting GL_HALF_FLOAT, GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT,
+     * GL_UNSIGNED_SHORT or GL_INT_2_10_10_10_REV as the type of the context before uploading: the
+     * dirty vertices are then encoded into that type (normalized for integer types) and only the
+     * encoded bytes are sent.
+     *
+     * When the context has an upload queue, the dirty ranges are copied and queued instead, and
+     * reach the buffer over the next frames; only a size change reallocates the buffer here.
+     *
+     * Unless adaptive usage is disabled on the context, the uploads into the attribute's own buffer
+     * are tracked, and after a warm-up the buffer migrates to the strategy they call for: immutable
+     * storage, GL_DYNAMIC_DRAW sub-data updates, or a persistently mapped streaming buffer.
+     *
+     * Attributes attached to a buffer::StreamingBuffer read the vertices written there: values cannot
+     * be set on them until their streaming range is cleared.
+     *
+     * @tparam A The type of one vertex.
+     */
     template <typename A>
     class OpenGLSetter
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::AttributeContext> attribute)
+        static void on(typename graphic::api::OpenGL::AttributeContext &attribute)
         {
-            if (!attribute)
+            if (attribute.getBufferID() == 0)
             {
-                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::NON_OPENGL_CONTEXT"));
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::BUFFER_ID_NOT_SET"));
             }
-            if (attribute->getBufferID() == 0)
+            if (attribute.getStreamingRange() && !attribute.getStreamingBuffer())
             {
-                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::BUFFER_ID_NOT_SET"));
+                // Attached to a streaming buffer by its owner, whose immutable storage cannot be respecified
+                throw artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::ATTACHED_TO_STREAMING_BUFFER: Clear the streaming range before setting values");
+            }
+            setFormat(attribute);
+
+            if (isEncoded(attribute))
+            {
+                encodeAndUpload(attribute);
+            }
+            else
+            {
+                upload(attribute, attribute.getData(), attribute.getDirtyRanges());
+            }
+            attribute.clearDirtyRanges();
+        }
+
+        /**
+         * @brief Records on the context the format of the vertex layout element feeding the attribute.
+         * @throws common::exception::TraceableException If the layout of A has no element for the attribute.
+         */
+        static void setFormat(graphic::api::OpenGL::AttributeContext &attribute)
+        {
+            const layout::VertexElement *element = layout::findElement<A>(attribute.getAttributeName());
+            if (!element)
+            {
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::LAYOUT_ELEMENT_NOT_FOUND: No element named {} in the vertex layout", attribute.getAttributeName()));
+            }
+            if (isEncoded(attribute))
+            {
+                // Keep the compressed type requested on the context, the values are encoded on upload
+                attribute.setGLSize(layout::encodedComponents(attribute.getGLType(), element->components));
+                attribute.setNormalized(attribute.getGLType() != GL_HALF_FLOAT);
+                attribute.setStride(static_cast<GLsizei>(layout::encodedStride(attribute.getGLType(), element->components)));
+                attribute.setOffset(0);
+                attribute.setVertexFetch(layout::VertexFetch::Float);
+                return;
+            }
+            attribute.setVertexFormat(*element, layout::VertexLayout<A>::stride);
+        }
+
+    private:
+        /**
+         * @brief Checks whether the float values of A are stored in a compressed type requested on the context.
+         *
+         * Compression applies to separate streams only: interleaved layouts keep their own types.
+         */
+        static bool isEncoded(const graphic::api::OpenGL::AttributeContext &attribute)
+        {
+            const auto &elements = layout::VertexLayout<A>::elements;
+            return elements.size() == 1 && elements[0].glType == GL_FLOAT && layout::isCompressedType(attribute.getGLType());
+        }
+
+        /**
+         * @brief Encodes the dirty vertices into the context's encoded copy, then uploads the encoded ranges.
+         */
+        static void encodeAndUpload(graphic::api::OpenGL::AttributeContext &attribute)
+        {
+            const GLint components = layout::VertexLayout<A>::elements[0].components;
+            const std::size_t sourceStride = layout::VertexLayout<A>::stride;
+            const std::size_t targetStride = layout::encodedStride(attribute.getGLType(), components);
+            std::span<const std::byte> data = attribute.getData();
+            const auto *values = reinterpret_cast<const float *>(data.data());
+
+            std::vector<std::byte> &encoded = attribute.getEncodedData();
+            const std::size_t encodedSize = data.size() / sourceStride * targetStride;
+            graphic::context::DirtyRanges dirty = attribute.getDirtyRanges();
+            if (encoded.size() != encodedSize || attribute.getEncodedType() != attribute.getGLType())
+            {
+                // New size or new type, even one of the same stride: none of the previous encoded values can be kept
+                encoded.resize(encodedSize);
+                attribute.setEncodedType(attribute.getGLType());
+                dirty.mark(0, data.size());
+            }
+
+            graphic::context::DirtyRanges encodedDirty;
+            for (const auto &range : dirty.getRanges())
+            {
+                const std::size_t first = range.offset / sourceStride;
+                const std::size_t count = (range.end() + sourceStride - 1) / sourceStride - first;
+                layout::encode(std::span<const float>(values + first * components, count * components),
+                               attribute.getGLType(),
+                               components,
+                               std::span<std::byte>(encoded).subspan(first * targetStride, count * targetStride));
+                encodedDirty.mark(first * targetStride, count * targetStride);
+            }
+            upload(attribute, encoded, encodedDirty);
+        }
+
+        static void upload(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            const auto size = static_cast<GLsizeiptr>(data.size());
+            if (const auto &allocation = attribute.getAllocation(); allocation && size > allocation->size)
+            {
+                throw artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::ALLOCATION_TOO_SMALL: {} bytes do not fit in an allocation of {} bytes", size, allocation->size));
+            }
+            if (attribute.getUploadQueue())
+            {
+                enqueue(attribute, data, dirty);
+            }
+            else if (const auto &allocation = attribute.getAllocation())
+            {
+                // The range is owned by an arena, it can only be rewritten in place
+                for (const auto &range : dirty.getRanges())
+                {
+                    glBufferSubData(GL_ARRAY_BUFFER, allocation->offset + static_cast<GLintptr>(range.offset), static_cast<GLsizeiptr>(range.size), data.data() + range.offset);
+                }
+            }
+            else
+            {
+                uploadOwnBuffer(attribute, data, dirty);
+            }
+        }
+
+        /**
+         * @brief Uploads into the attribute's own buffer, with the update strategy matching its observed uploads.
+         */
+        static void uploadOwnBuffer(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            buffer::UpdateStrategy strategy = attribute.getUpdateStrategy();
+            if (attribute.isAdaptiveUsage())
+            {
+                strategy = attribute.getUsageTracker().record(buffer::UsageTracker::Clock::now(), dirty.getByteCount(), data.size());
+            }
+            if (strategy != attribute.getUpdateStrategy())
+            {
+                migrate(attribute, strategy);
+            }
+
+            switch (strategy)
+            {
+            case buffer::UpdateStrategy::Streaming:
+                stream(attribute, data);
+                break;
+            case buffer::UpdateStrategy::Immutable:
+                uploadImmutable(attribute, data, dirty);
+                break;
+            default:
+                uploadMutable(attribute, data, dirty);
+                break;
+            }
+        }
+
+        /**
+         * @brief Leaves the current strategy of the attribute's buffer for another one.
+         *
+         * The data store is respecified on the next upload. An immutable store cannot be, so the buffer
+         * is replaced by a new one. A buffer migrating to streaming is no longer read: its store is
+         * freed, and reallocated only if the attribute migrates back.
+         */
+        static void migrate(graphic::api::OpenGL::AttributeContext &attribute, buffer::UpdateStrategy strategy)
+        {
+            if (attribute.getUpdateStrategy() == buffer::UpdateStrategy::Streaming)
+            {
+                attribute.setStreamingRange(nullptr);
+                attribute.setStreamingBuffer(nullptr);
+                glBindBuffer(GL_ARRAY_BUFFER, attribute.getBufferID());
+            }
+            else if (attribute.getUpdateStrategy() == buffer::UpdateStrategy::Immutable)
+            {
+                replaceBuffer(attribute);
+            }
+            else if (strategy == buffer::UpdateStrategy::Streaming && attribute.getBufferSize() != 0)
+            {
+                glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
+            }
+
+            switch (strategy)
+            {
+            case buffer::UpdateStrategy::Immutable:
+                attribute.setGLUsage(GL_STATIC_DRAW);
+                break;
+            case buffer::UpdateStrategy::SubData:
+                attribute.setGLUsage(GL_DYNAMIC_DRAW);
+                break;
+            case buffer::UpdateStrategy::Streaming:
+                attribute.setGLUsage(GL_STREAM_DRAW);
+                break;
+            default:
+                break;
+            }
+            attribute.setBufferSize(0);
+            attribute.setUpdateStrategy(strategy);
+        }
+
+        /**
+         * @brief Moves the attribute to a new buffer without data store.
+         *
+         * The new buffer is generated before the old one is released, so it cannot get the old name
+         * back, and the release evicts the vertex array objects that captured the old buffer.
+         */
+        static void replaceBuffer(graphic::api::OpenGL::AttributeContext &attribute)
+        {
+            const GLuint previousId = attribute.getBufferID();
+            GLuint bufferId = 0;
+            glGenBuffers(1, &bufferId);
+            glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+            buffer::BufferNames::release(previousId);
+            attribute.setBufferID(bufferId);
+            attribute.setBufferSize(0);
+        }
+
+        static void uploadMutable(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            const auto size = static_cast<GLsizeiptr>(data.size());
+            if (size != attribute.getBufferSize())
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, data.data(), attribute.getGLUsage());
+                attribute.setBufferSize(size);
+            }
+            else if (dirty.covers(data.size()))
+            {
+                // Orphan the data store, the previous one is released once the GPU is done with it
+                glBufferData(GL_ARRAY_BUFFER, size, nullptr, attribute.getGLUsage());
+                glBufferSubData(GL_ARRAY_BUFFER, 0, size, data.data());
+            }
+            else
+            {
+                uploadRanges(data, dirty);
+            }
+        }
+
+        static void uploadImmutable(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            const auto size = static_cast<GLsizeiptr>(data.size());
+            if (size != attribute.getBufferSize())
+            {
+                if (attribute.getBufferSize() != 0)
+                {
+                    replaceBuffer(attribute); // The size of an immutable store is fixed
+                }
+                glBufferStorage(GL_ARRAY_BUFFER, size, data.data(), GL_DYNAMIC_STORAGE_BIT);
+                attribute.setBufferSize(size);
+            }
+            else
+            {
+                uploadRanges(data, dirty);
+            }
+        }
+
+        static void uploadRanges(std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            for (const auto &range : dirty.getRanges())
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(range.offset), static_cast<GLsizeiptr>(range.size), data.data() + range.offset);
+            }
+        }
+
+        /**
+         * @brief Writes the whole data into the next region of the attribute's streaming buffer.
+         *
+         * The region of the previous upload is fenced first, once the draws reading it have been issued.
+         */
+        static void stream(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data)
+        {
+            std::shared_ptr<buffer::StreamingBuffer> streamingBuffer = attribute.getStreamingBuffer();
+            if (!streamingBuffer || streamingBuffer->getRegionSize() < data.size())
+            {
+                attribute.setStreamingRange(nullptr);
+                streamingBuffer = std::make_shared<buffer::StreamingBuffer>(data.size());
+                attribute.setStreamingBuffer(streamingBuffer);
+            }
+            else
+            {
+                streamingBuffer->endFrame();
+            }
+            streamingBuffer->beginFrame();
+            const GLintptr offset = streamingBuffer->write<std::byte>(data);
+            attribute.setStreamingRange(std::make_shared<buffer::BufferAllocation>(buffer::BufferAllocation{streamingBuffer->getBufferID(), offset, static_cast<GLsizeiptr>(data.size())}));
+        }
+
+        static void enqueue(graphic::api::OpenGL::AttributeContext &attribute, std::span<const std::byte> data, const graphic::context::DirtyRanges &dirty)
+        {
+            const auto &queue = attribute.getUploadQueue();
+            const auto &allocation = attribute.getAllocation();
+            const auto size = static_cast<GLsizeiptr>(data.size());
+            if (!allocation && size != attribute.getBufferSize())
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, nullptr, attribute.getGLUsage());
+                attribute.setBufferSize(size);
+            }
+            // The ranges are copied: the values and the encoded scratch may change before they are staged
+            for (const auto &range : dirty.getRanges())
+            {
+                std::vector<std::byte> bytes(data.begin() + static_cast<std::ptrdiff_t>(range.offset), data.begin() + static_cast<std::ptrdiff_t>(range.end()));
+                attribute.setUploadCompletion(allocation ? queue->submit(std::move(bytes), allocation, static_cast<GLintptr>(range.offset))
+                                                         : queue->submit(std::move(bytes), attribute.getBufferID(), static_cast<GLintptr>(range.offset)));
             }
-            std::shared_ptr<A> attrValue = attribute->getValue<A>();
-            glBufferData(GL_ARRAY_BUFFER, sizeof(attrValue.get()), attrValue.get(), attribute->getGLUsage());
-            glVertexAttribPointer(attribute->getAttributeID(), attribute->getGLSize(), attribute->getGLType(), GL_FALSE, sizeof(attrValue.get()), (void *)nullptr);
         }
     };
 }
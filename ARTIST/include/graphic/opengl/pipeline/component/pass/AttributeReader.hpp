@@ -27,14 +27,9 @@ namespace artist::graphic::opengl::pipeline::component::pass
     class OpenGLPassAttributeReader<graphic::opengl::profile::Pass::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::PassContext> openglContext)
+        static void on(typename graphic::api::OpenGL::PassContext &openglContext)
         {
-            if (!openglContext)
-            {
-                throw common::exception::TraceableException<std::runtime_error>("ERROR::PASS::NON_OPENGL_CONTEXT");
-            }
-
-            GLuint passID = openglContext->getPassID();
+            GLuint passID = openglContext.getPassID();
             if (passID == 0)
             {
                 throw common::exception::TraceableException<std::runtime_error>("ERROR::PASS::INVALID_PROGRAM_ID");
@@ -56,12 +51,13 @@ namespace artist::graphic::opengl::pipeline::component::pass
                 // Create an Attribute object and store it in the context
                 auto attributeContext = std::make_shared<graphic::api::OpenGL::AttributeContext>();
                 attributeContext->setAttributeID(location);
+                attributeContext->setAttributeName(attributeName);
                 attributeContext->setGLSize(size);
                 attributeContext->setGLType(type);
 
                 // Known limitation of OpenGL: Attributes profile are driven by Pass profile
                 auto attribute = std::make_shared<graphic::pipeline::Attribute<graphic::api::OpenGL, graphic::opengl::profile::Attribute::Classic>>(attributeContext);
-                openglContext->addAttribute(std::string(attributeName), attribute);
+                openglContext.addAttribute(std::string(attributeName), attribute);
             }
         }
     };
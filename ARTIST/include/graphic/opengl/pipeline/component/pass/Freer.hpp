@@ -27,19 +27,13 @@ namespace artist::graphic::opengl::pipeline::component::pass
     class OpenGLPassFreer<graphic::opengl::profile::Pass::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::PassContext> openglContext)
+        static void on(typename graphic::api::OpenGL::PassContext &openglContext)
         {
-
-            if (!openglContext)
-            {
-                throw common::exception::TraceableException<std::runtime_error>("ERROR::SHADER::NON_OPENGL_CONTEXT");
-            }
-
-            GLuint passID = openglContext->getPassID();
+            GLuint passID = openglContext.getPassID();
             if (passID != 0)
             {
                 // Optionally detach shaders before deleting the pipeline
-                for (const auto &shader : openglContext->getShaders())
+                for (const auto &shader : openglContext.getShaders())
                 {
                     if (auto oglShaderContext = shader->getContext())
                     {
@@ -47,9 +41,16 @@ namespace artist::graphic::opengl::pipeline::component::pass
                     }
                 }
 
+                // Delete the vertex array objects cached for this pass
+                for (const auto &[key, vertexArray] : openglContext.getVertexArrays())
+                {
+                    glDeleteVertexArrays(1, &vertexArray);
+                }
+                openglContext.clearVertexArrays();
+
                 // Delete the OpenGL pipeline
                 glDeleteProgram(passID);
-                openglContext->setPassID(0); // Reset the pipeline ID in the context
+                openglContext.setPassID(0); // Reset the pipeline ID in the context
             }
         }
     };
@@ -18,13 +18,8 @@ namespace artist::graphic::opengl::pipeline::component::pass
     class OpenGLLoader<graphic::opengl::profile::Pass::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::PassContext> openglContext)
+        static void on(typename graphic::api::OpenGL::PassContext &openglContext)
         {
-            if (!openglContext)
-            {
-                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::PROGRAM::NON_OPENGL_CONTEXT"));
-            }
-
             GLuint passID = glCreateProgram();
             if (passID == 0)
             {
@@ -32,7 +27,7 @@ namespace artist::graphic::opengl::pipeline::component::pass
             }
 
             // Save the created pipeline ID in the context
-            openglContext->setPassID(passID);
+            openglContext.setPassID(passID);
             artist::graphic::api::OpenGL::PassContext::ShaderAttacher<graphic::opengl::profile::Pass::Classic>::on(openglContext);
 
             // Link the pipeline
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <graphic/Api.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/context/AttributeContext.hpp>
+#include <common/exception/TraceableException.hpp>
+#include <graphic/opengl/layout/VertexArrayKey.hpp>
+#include <graphic/opengl/profile/Pass.hpp>
+
+namespace artist::graphic::opengl::pipeline::component::pass
+{
+    /**
+     * @class OpenGLPassVertexArrayBinder
+     * @brief Binds the vertex array object matching the current attributes of a pass.
+     *
+     * Vertex array objects are created once per combination of attribute formats, buffers, offsets and
+     * index buffer, then cached in the pass context. Using a pass whose attributes did not change
+     * costs a single glBindVertexArray instead of re-specifying every attribute pointer.
+     *
+     * The cache knows buffers by name, and OpenGL hands the name of a deleted buffer out again. So
+     * that a new buffer never hits a vertex array object of a deleted one, the vertex array objects
+     * reading a buffer released through buffer::BufferNames are deleted on the next use of the pass.
+     * The cache also holds MAX_VERTEX_ARRAYS entries at most: filling it empties it, which bounds the
+     * entries left behind by attributes moving across buffers or offsets.
+     *
+     * Each attribute pointer is specified by the function matching how the shader fetches it:
+     * glVertexAttribIPointer for integer inputs, glVertexAttribLPointer for double inputs and
+     * glVertexAttribPointer otherwise. Only the latter converts the components to floats.
+     *
+     * Attributes without a vertex format, read from the program but never set nor attached to a
+     * buffer, are left disabled. A pass without any attribute to bind still gets a vertex array object
+     * of its own, capturing its index buffer, rather than drawing with the one of the previous pass.
+     */
+    template <auto PROFILE>
+    class OpenGLPassVertexArrayBinder
+    {
+    };
+
+    template <>
+    class OpenGLPassVertexArrayBinder<graphic::opengl::profile::Pass::Classic>
+    {
+    public:
+        static constexpr std::size_t MAX_VERTEX_ARRAYS = 64;
+
+        static void on(typename graphic::api::OpenGL::PassContext &openglContext)
+        {
+            evictReleasedBuffers(openglContext);
+
+            layout::VertexArrayKey &key = openglContext.getVertexArrayKey();
+            key.clear();
+            for (const auto &[name, attribute] : openglContext.getAttributes())
+            {
+                const auto &attributeContext = attribute->getContext();
+                if (attributeContext->getBufferID() == 0 || !attributeContext->hasVertexFormat())
+                {
+                    continue; // Nothing uploaded for this attribute yet
+                }
+                key.bindings.push_back({attributeContext->getAttributeID(),
+                               attributeContext->getBufferID(),
+                               static_cast<GLint>(attributeContext->getGLSize()),
+                               attributeContext->getGLType(),
+                               attributeContext->isNormalized(),
+                               attributeContext->getStride(),
+                               attributeContext->getBufferOffset() + attributeContext->getOffset(),
+                               attributeContext->getVertexFetch()});
+            }
+            std::ranges::sort(key.bindings, {}, &layout::VertexBinding::attributeId);
+            if (const auto &indexBuffer = openglContext.getIndexBuffer())
+            {
+                key.elementBufferId = indexBuffer->getBufferID();
+            }
+
+            GLuint vertexArray = openglContext.findVertexArray(key);
+            if (vertexArray == 0)
+            {
+                if (openglContext.getVertexArrays().size() >= MAX_VERTEX_ARRAYS)
+                {
+                    deleteVertexArrays(openglContext.removeVertexArrays([](const layout::VertexArrayKey &)
+                                                                        { return true; }));
+                }
+                vertexArray = createVertexArray(key);
+                openglContext.addVertexArray(key, vertexArray);
+            }
+            glBindVertexArray(vertexArray);
+            openglContext.setCurrentVertexArray(vertexArray);
+        }
+
+    private:
+        /**
+         * @brief Deletes the cached vertex array objects reading a buffer released since the last use.
+         *
+         * A pass that missed more releases than the log keeps deletes all of them.
+         */
+        static void evictReleasedBuffers(graphic::api::OpenGL::PassContext &openglContext)
+        {
+            const std::uint64_t epoch = buffer::BufferNames::getEpoch();
+            if (openglContext.getBufferEpoch() == epoch)
+            {
+                return;
+            }
+            const auto released = buffer::BufferNames::getReleasedSince(openglContext.getBufferEpoch());
+            deleteVertexArrays(openglContext.removeVertexArrays([&released](const layout::VertexArrayKey &key)
+                                                                { return !released || key.references(*released); }));
+            openglContext.setBufferEpoch(epoch);
+        }
+
+        static void deleteVertexArrays(const std::vector<GLuint> &vertexArrays)
+        {
+            if (!vertexArrays.empty())
+            {
+                glDeleteVertexArrays(static_cast<GLsizei>(vertexArrays.size()), vertexArrays.data());
+            }
+        }
+
+        /**
+         * @brief Creates a vertex array object capturing the given attribute bindings and index buffer.
+         * @param key Attribute bindings sorted by location, and index buffer.
+         * @return The created vertex array object, left bound.
+         */
+        static GLuint createVertexArray(const layout::VertexArrayKey &key)
+        {
+            GLuint vertexArray = 0;
+            glGenVertexArrays(1, &vertexArray);
+            glBindVertexArray(vertexArray);
+            for (const auto &binding : key.bindings)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, binding.bufferId);
+                glEnableVertexAttribArray(binding.attributeId);
+                const void *pointer = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(binding.offset));
+                switch (binding.fetch)
+                {
+                case layout::VertexFetch::Integer:
+                    glVertexAttribIPointer(binding.attributeId, binding.components, binding.glType, binding.stride, pointer);
+                    break;
+                case layout::VertexFetch::Double:
+                    glVertexAttribLPointer(binding.attributeId, binding.components, binding.glType, binding.stride, pointer);
+                    break;
+                default:
+                    glVertexAttribPointer(binding.attributeId, binding.components, binding.glType, binding.normalized, binding.stride, pointer);
+                    break;
+                }
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            if (key.elementBufferId != 0)
+            {
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, key.elementBufferId);
+            }
+            return vertexArray;
+        }
+    };
+}
@@ -17,13 +17,9 @@ namespace artist::graphic::opengl::pipeline::component::pipeline
     class OpenGLPipelineResetter<graphic::opengl::profile::Pipeline::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::PipelineContext> context)
+        static void on(typename graphic::api::OpenGL::PipelineContext &context)
         {
-            if (!context)
-            {
-                throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::NON_VALID_CONTEXT"));
-            }
-            context->setCurrentPass(-1);
+            context.setCurrentPass(-1);
         }
     };
 }
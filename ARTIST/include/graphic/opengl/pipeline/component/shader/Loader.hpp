@@ -28,11 +28,11 @@ namespace artist::graphic::opengl::pipeline::component::shader
     class OpenGLShaderLoader<graphic::opengl::profile::Shader::Classic>
     {
     public:
-        static void on(std::shared_ptr<typename graphic::api::OpenGL::ShaderContext> openglContext)
+        static void on(typename graphic::api::OpenGL::ShaderContext &openglContext)
         {
             // Create a shader object
-            GLuint shaderID = glCreateShader(openglContext->getGLShaderType());
-            const char *shaderCodeCStr = openglContext->getShaderCode().c_str();
+            GLuint shaderID = glCreateShader(openglContext.getGLShaderType());
+            const char *shaderCodeCStr = openglContext.getShaderCode().c_str();
             glShaderSource(shaderID, 1, &shaderCodeCStr, nullptr);
             glCompileShader(shaderID);
 
@@ -44,7 +44,7 @@ namespace artist::graphic::opengl::pipeline::component::shader
             }
 
             // Store the shader ID in the OpenGL context
-            openglContext->setShaderID(shaderID);
+            openglContext.setShaderID(shaderID);
         }
 
     private:
@@ -0,0 +1,242 @@
+/**
+ * @file ResourceRegistry.hpp
+ * @brief GL objects of passes and pipelines in handle pools, walked as contiguous arrays.
+ *
+ * A pipeline reaches its passes, and a pass its shaders, uniforms and attributes, through
+ * shared_ptr and hash maps: drawing a frame chases a pointer per object, each into a different
+ * heap block. The registry keeps the GL names those walks end up reading in HandlePool columns
+ * instead, one pool per kind of object: using a pipeline reads two indices, and looping over every
+ * uniform of every pass reads arrays front to back. Objects refer to each other by handles, so a
+ * handle to a destroyed object is caught by a generation check rather than followed.
+ *
+ * The registry is filled from loaded passes, which keep owning the GL objects: it mirrors them,
+ * it does not create nor delete them. Import a pass again after reloading it. The vertex array
+ * object and the attribute buffers of a pass change after it is loaded, so they are not mirrored:
+ * the registry keeps a weak reference to the pass context and reads them from it when used.
+ *
+ * @code
+ * ResourceRegistry registry;
+ * const PassHandle opaque = registry.importPass(opaquePass->getContext());
+ * const PassHandle transparent = registry.importPass(transparentPass->getContext());
+ * const PassHandle passes[] = {opaque, transparent};
+ * const PipelineHandle pipeline = registry.createPipeline(passes);
+ * registry.use(pipeline, 0);
+ * glUniformMatrix4fv(registry.findUniform(opaque, "model"), 1, GL_FALSE, model);
+ * @endcode
+ */
+
+#pragma once
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+#include <common/memory/HandlePool.hpp>
+#include <graphic/opengl/context/AttributeContext.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/context/ShaderContext.hpp>
+#include <graphic/opengl/context/UniformContext.hpp>
+
+namespace artist::graphic::opengl::registry
+{
+    struct ShaderTag;
+    struct PassTag;
+    struct UniformTag;
+    struct AttributeTag;
+    struct PipelineTag;
+
+    using ShaderHandle = common::memory::Handle<ShaderTag>;
+    using PassHandle = common::memory::Handle<PassTag>;
+    using UniformHandle = common::memory::Handle<UniformTag>;
+    using AttributeHandle = common::memory::Handle<AttributeTag>;
+    using PipelineHandle = common::memory::Handle<PipelineTag>;
+
+    /**
+     * @class ResourceRegistry
+     * @brief Shaders, passes, uniforms, attributes and pipelines, one handle pool each.
+     */
+    class ResourceRegistry
+    {
+    public:
+        using ShaderPool = common::memory::HandlePool<ShaderTag, GLuint, GLenum, PassHandle>;                  ///< Shader name, type, pass.
+        using PassPool = common::memory::HandlePool<PassTag, GLuint, std::weak_ptr<const context::OpenGLPassContext>, std::vector<UniformHandle>>; ///< Program, pass context, uniforms by name.
+        using UniformPool = common::memory::HandlePool<UniformTag, GLint, GLenum, PassHandle, std::string>;    ///< Location, type, pass, name.
+        using AttributePool = common::memory::HandlePool<AttributeTag, GLuint, std::string, PassHandle>;       ///< Location, name, pass.
+        using PipelinePool = common::memory::HandlePool<PipelineTag, std::vector<PassHandle>, int>;            ///< Passes, current pass.
+
+        /**
+         * @brief Mirrors a loaded pass, with its shaders, uniforms and attributes.
+         *
+         * The pass context is referenced weakly, to bind its current vertex array object when used:
+         * using the pass once the context is released throws instead of reading freed memory.
+         */
+        PassHandle importPass(const std::shared_ptr<const context::OpenGLPassContext> &context)
+        {
+            const context::OpenGLPassContext &pass = *context;
+            const PassHandle handle = m_passes.create(pass.getPassID(), context, std::vector<UniformHandle>{});
+            for (const auto &shader : pass.getShaders())
+            {
+                m_shaders.create(shader->getContext()->getShaderID(), shader->getContext()->getGLShaderType(), handle);
+            }
+            std::vector<UniformHandle> &uniforms = m_passes.get<2>(handle);
+            for (const auto &[name, uniform] : pass.getUniforms())
+            {
+                uniforms.push_back(m_uniforms.create(static_cast<GLint>(uniform->getContext()->getUniformID()), uniform->getContext()->getGLType(), handle, name));
+            }
+            std::ranges::sort(uniforms, {}, [this](UniformHandle uniform)
+                              { return std::string_view(m_uniforms.get<3>(uniform)); });
+            for (const auto &[name, attribute] : pass.getAttributes())
+            {
+                m_attributes.create(attribute->getContext()->getAttributeID(), name, handle);
+            }
+            return handle;
+        }
+
+        /**
+         * @brief Groups passes into a pipeline, with no current pass.
+         * @throws common::exception::TraceableException If one of the passes is not valid.
+         */
+        PipelineHandle createPipeline(std::span<const PassHandle> passes)
+        {
+            for (const PassHandle pass : passes)
+            {
+                checkPass(pass);
+            }
+            return m_pipelines.create(std::vector<PassHandle>(passes.begin(), passes.end()), -1);
+        }
+
+        /**
+         * @brief Forgets a pass with its shaders, uniforms and attributes.
+         *
+         * Pipelines keep the handle of the pass, which is then caught as stale when they use it.
+         * @return False if the handle was not valid.
+         */
+        bool destroyPass(PassHandle pass)
+        {
+            if (!m_passes.destroy(pass))
+            {
+                return false;
+            }
+            destroyOwnedBy(m_shaders, pass);
+            destroyOwnedBy(m_uniforms, pass);
+            destroyOwnedBy(m_attributes, pass);
+            return true;
+        }
+
+        bool destroyPipeline(PipelineHandle pipeline)
+        {
+            return m_pipelines.destroy(pipeline);
+        }
+
+        [[nodiscard]] bool isValid(PassHandle pass) const
+        {
+            return m_passes.isValid(pass);
+        }
+
+        [[nodiscard]] bool isValid(PipelineHandle pipeline) const
+        {
+            return m_pipelines.isValid(pipeline);
+        }
+
+        /**
+         * @brief Makes a pass of a pipeline current: its program and the vertex array object it currently uses.
+         * @throws common::exception::TraceableException If a handle is stale, the pass context was released
+         *         or the pass is not one of the pipeline.
+         */
+        void use(PipelineHandle pipeline, int pass)
+        {
+            const std::vector<PassHandle> &passes = m_pipelines.get<0>(pipeline);
+            if (pass < 0 || static_cast<std::size_t>(pass) >= passes.size())
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::RESOURCE_REGISTRY::INVALID_PASS: Pass {} is not one of the {} passes of the pipeline", pass, passes.size()));
+            }
+            const PassHandle handle = checkPass(passes[pass]);
+            const std::shared_ptr<const context::OpenGLPassContext> context = m_passes.get<1>(handle).lock();
+            if (!context)
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::RESOURCE_REGISTRY::STALE_PASS: The context of pass slot {} generation {} was released", handle.index, handle.generation));
+            }
+            glUseProgram(m_passes.get<0>(handle));
+            glBindVertexArray(context->getCurrentVertexArray());
+            m_pipelines.get<1>(pipeline) = pass;
+        }
+
+        /**
+         * @brief Binary search among the uniforms of the pass only, which are sorted by name.
+         * @return The location of a uniform of a pass, or -1 if the pass has no uniform with this name.
+         * @throws common::exception::TraceableException If the pass handle is stale.
+         */
+        [[nodiscard]] GLint findUniform(PassHandle pass, std::string_view name) const
+        {
+            const std::vector<UniformHandle> &uniforms = m_passes.get<2>(checkPass(pass));
+            auto nameOf = [this](UniformHandle uniform)
+            {
+                return std::string_view(m_uniforms.get<3>(uniform));
+            };
+            auto it = std::ranges::lower_bound(uniforms, name, {}, nameOf);
+            return it != uniforms.end() && nameOf(*it) == name ? m_uniforms.get<0>(*it) : -1;
+        }
+
+        [[nodiscard]] const ShaderPool &getShaders() const
+        {
+            return m_shaders;
+        }
+
+        [[nodiscard]] const PassPool &getPasses() const
+        {
+            return m_passes;
+        }
+
+        [[nodiscard]] const UniformPool &getUniforms() const
+        {
+            return m_uniforms;
+        }
+
+        [[nodiscard]] const AttributePool &getAttributes() const
+        {
+            return m_attributes;
+        }
+
+        [[nodiscard]] const PipelinePool &getPipelines() const
+        {
+            return m_pipelines;
+        }
+
+    private:
+        PassHandle checkPass(PassHandle pass) const
+        {
+            if (!m_passes.isValid(pass))
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::RESOURCE_REGISTRY::STALE_PASS: Pass slot {} generation {} was destroyed", pass.index, pass.generation));
+            }
+            return pass;
+        }
+
+        template <typename Pool>
+        static void destroyOwnedBy(Pool &pool, PassHandle pass)
+        {
+            // Backwards, as destroying moves the last object into the freed position
+            const auto owners = pool.template column<2>();
+            for (std::size_t i = owners.size(); i-- > 0;)
+            {
+                if (owners[i] == pass)
+                {
+                    pool.destroy(pool.getHandle(i));
+                }
+            }
+        }
+
+        ShaderPool m_shaders;       ///< Shaders of the imported passes.
+        PassPool m_passes;          ///< Imported passes.
+        UniformPool m_uniforms;     ///< Uniforms of the imported passes.
+        AttributePool m_attributes; ///< Attributes of the imported passes.
+        PipelinePool m_pipelines;   ///< Pipelines of imported passes.
+    };
+}
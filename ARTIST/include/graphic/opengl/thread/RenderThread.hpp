@@ -0,0 +1,237 @@
+/**
+ * @file RenderThread.hpp
+ * @brief Dedicated thread owning the GL context, fed with commands by any other thread.
+ *
+ * An OpenGL context is current on one thread at a time, so every call to IPass::withUniform,
+ * IAttribute::set or IPipeline::use must happen there. In render-thread mode, the context lives
+ * on a thread of its own, and other threads enqueue these calls as commands instead of making
+ * them: the commands go through a lock-free MpscQueue and run on the render thread in the order
+ * each thread enqueued them. Enqueuing never takes a lock nor waits for the GL context; a
+ * producer only waits when the queue is full, until the render thread frees a slot.
+ *
+ * Commands that produce a result, or whose completion matters, are enqueued with call, which
+ * returns a std::future. Exceptions thrown by fire-and-forget commands are kept and rethrown by
+ * rethrowError, since no caller is waiting on them.
+ *
+ * @code
+ * RenderThread renderThread([window] { glfwMakeContextCurrent(window); });
+ * renderThread.call([pipeline] { pipeline->forPass(0)->load(); }).get();
+ * // from any thread:
+ * renderThread.withUniform(pass, "time", elapsed);
+ * renderThread.use(pipeline, 0);
+ * renderThread.submit([] { glDrawArrays(GL_TRIANGLES, 0, 3); });
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <common/thread/MpscQueue.hpp>
+#include <graphic/pipeline/Attribute.hpp>
+#include <graphic/pipeline/Pass.hpp>
+#include <graphic/pipeline/Pipeline.hpp>
+
+namespace artist::graphic::opengl::thread
+{
+    /**
+     * @class RenderThread
+     * @brief Runs enqueued commands on the thread that owns the GL context.
+     */
+    class RenderThread
+    {
+    public:
+        using Command = std::move_only_function<void()>;
+
+        /**
+         * @param makeCurrent Called first on the render thread, to make the GL context current there.
+         * @param capacity Number of commands the queue holds, a power of two.
+         */
+        explicit RenderThread(std::function<void()> makeCurrent = {}, std::size_t capacity = 4096)
+            : m_queue(capacity),
+              m_thread([this, makeCurrent = std::move(makeCurrent)]()
+                       {
+                           if (makeCurrent)
+                           {
+                               run(makeCurrent);
+                           }
+                           loop(); })
+        {
+        }
+
+        RenderThread(const RenderThread &) = delete;
+        RenderThread &operator=(const RenderThread &) = delete;
+
+        /**
+         * @brief Runs the commands already enqueued, then stops the thread.
+         */
+        ~RenderThread()
+        {
+            submit([this]()
+                   { m_running = false; });
+            m_thread.join();
+        }
+
+        /**
+         * @brief Enqueues a command, run on the render thread after those enqueued before by this thread.
+         */
+        template <typename F>
+        void submit(F &&command)
+        {
+            push(Command(std::forward<F>(command)));
+        }
+
+        /**
+         * @brief Enqueues a command whose result, or exception, is delivered through a future.
+         */
+        template <typename F>
+        std::future<std::invoke_result_t<F>> call(F &&command)
+        {
+            std::packaged_task<std::invoke_result_t<F>()> task(std::forward<F>(command));
+            std::future<std::invoke_result_t<F>> future = task.get_future();
+            push(Command(std::move(task)));
+            return future;
+        }
+
+        /**
+         * @brief Enqueues IPass::withUniform. The name and value are copied.
+         */
+        template <typename API, typename T>
+        void withUniform(std::shared_ptr<graphic::pipeline::IPass<API>> pass, std::string name, const T &value)
+        {
+            submit([pass = std::move(pass), name = std::move(name), value]()
+                   { pass->withUniform(name, value); });
+        }
+
+        /**
+         * @brief Enqueues IAttribute::set with a value shared with the caller.
+         */
+        template <typename API, typename T>
+        void set(std::shared_ptr<graphic::pipeline::IAttribute<API>> attribute, std::shared_ptr<T> value)
+        {
+            submit([attribute = std::move(attribute), value = std::move(value)]()
+                   { attribute->template set<T>(value); });
+        }
+
+        /**
+         * @brief Enqueues IAttribute::set with an array of values, moved into the command.
+         */
+        template <typename API, typename T>
+        void set(std::shared_ptr<graphic::pipeline::IAttribute<API>> attribute, std::vector<T> values)
+        {
+            submit([attribute = std::move(attribute), values = std::move(values)]()
+                   { attribute->template set<T>(std::span<const T>(values)); });
+        }
+
+        /**
+         * @brief Enqueues IPipeline::use.
+         */
+        template <typename API>
+        void use(std::shared_ptr<graphic::pipeline::IPipeline<API>> pipeline, int pass)
+        {
+            submit([pipeline = std::move(pipeline), pass]()
+                   { pipeline->use(pass); });
+        }
+
+        /**
+         * @brief Returns a future ready once every command enqueued before by this thread has run.
+         */
+        std::future<void> flush()
+        {
+            return call([]() {});
+        }
+
+        /**
+         * @brief Rethrows the first exception thrown by a command enqueued with submit, if any, and forgets it.
+         */
+        void rethrowError()
+        {
+            std::exception_ptr error;
+            {
+                std::lock_guard lock(m_errorMutex);
+                error = std::exchange(m_error, nullptr);
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        [[nodiscard]] bool isRenderThread() const
+        {
+            return std::this_thread::get_id() == m_thread.get_id();
+        }
+
+        [[nodiscard]] std::thread::id getId() const
+        {
+            return m_thread.get_id();
+        }
+
+    private:
+        void push(Command command)
+        {
+            // Backpressure only: wait for the render thread to run commands while the ring is full
+            for (std::uint64_t executed = m_executed.load(std::memory_order_acquire); !m_queue.tryPush(std::move(command)); executed = m_executed.load(std::memory_order_acquire))
+            {
+                m_executed.wait(executed, std::memory_order_acquire);
+            }
+            m_pushed.fetch_add(1, std::memory_order_release);
+            m_pushed.notify_one();
+        }
+
+        void loop()
+        {
+            Command command;
+            std::uint64_t executed = 0;
+            while (m_running)
+            {
+                if (!m_queue.tryPop(command))
+                {
+                    m_pushed.wait(executed, std::memory_order_acquire);
+                    continue;
+                }
+                run(command);
+                command = nullptr;
+                m_executed.store(++executed, std::memory_order_release);
+                m_executed.notify_all();
+            }
+        }
+
+        template <typename F>
+        void run(F &command)
+        {
+            try
+            {
+                command();
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_errorMutex);
+                if (!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+        }
+
+        common::thread::MpscQueue<Command> m_queue; ///< Commands waiting for the render thread.
+        std::atomic<std::uint64_t> m_pushed = 0;    ///< Commands enqueued so far.
+        std::atomic<std::uint64_t> m_executed = 0;  ///< Commands run so far.
+        bool m_running = true;                      ///< Cleared by the last command, on the render thread.
+        std::mutex m_errorMutex;                    ///< Guards m_error, only taken when a command throws.
+        std::exception_ptr m_error;                 ///< First exception of a command enqueued with submit.
+        std::thread m_thread;                       ///< The render thread, started last.
+    };
+}
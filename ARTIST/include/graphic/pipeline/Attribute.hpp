@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <graphic/Api.hpp>
 #include <graphic/context/AttributeContext.hpp>
 #include <graphic/validator/ComponentConcept.hpp>
@@ -54,7 +56,7 @@ namespace artist::graphic::pipeline
          */
         void bind()
         {
-            bind(m_context);
+            bind(*m_context);
         }
 
         /**
@@ -84,15 +86,83 @@ namespace artist::graphic::pipeline
         void set(std::shared_ptr<T> value)
         {
             m_context->template setValue<T>(value);
+            upload<T>();
+        }
 
-            if constexpr (graphic::validator::HasComponent<typename API::AttributeContext::Setter<std::shared_ptr<int>>>)
-            {
-                API::AttributeContext::template Setter<std::shared_ptr<int>>::on(m_context);
-            }
-            else
-            {
-                throw common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::UNSUPPORTED_TYPE");
-            }
+        /**
+         * @brief Sets an array of values for the attribute.
+         *
+         * Uploads the whole array in a single call, with the stride and offset described by the vertex
+         * layout of T. For interleaved vertex structs, the element matching the attribute name is used.
+         * The values are not copied, they only need to outlive this call.
+         *
+         * @tparam T The type of one vertex.
+         * @param values The vertices to upload.
+         *
+         * @throws common::exception::TraceableException If the attribute type T is unsupported by the API.
+         *
+         * Usage Example:
+         * @code
+         * std::vector<glm::vec3> positions = loadPositions();
+         * attribute->set<glm::vec3>(positions);
+         * @endcode
+         */
+        template <typename T>
+        void set(std::span<const T> values)
+        {
+            m_context->template setValues<T>(values);
+            upload<T>();
+        }
+
+        /**
+         * @brief Sets the values from one array per component instead of an array of vertices.
+         *
+         * Sources that keep each component in its own array, e.g. simulations, are interleaved into
+         * vertices of T by the context, then uploaded as by set(values).
+         *
+         * @tparam T The type of one vertex, made of floats.
+         * @param components One array of count floats per component of T, in layout order.
+         * @param count Number of vertices.
+         *
+         * @throws common::exception::TraceableException If T is not made of floats or the number of arrays does not match it.
+         *
+         * Usage Example:
+         * @code
+         * std::array<const float *, 3> components{xs.data(), ys.data(), zs.data()};
+         * attribute->set<glm::vec3>(components, xs.size());
+         * @endcode
+         */
+        template <typename T>
+        void set(std::span<const float *const> components, std::size_t count)
+        {
+            m_context->template setComponents<T>(components, count);
+            upload<T>();
+        }
+
+        /**
+         * @brief Re-uploads a modified part of an array of values.
+         *
+         * Only the bytes of the modified vertices are sent to the API: updating 1% of a large mesh
+         * costs about 1% of the full upload. If the array size changed, the whole array is uploaded.
+         *
+         * @tparam T The type of one vertex.
+         * @param values The whole vertex array, including the modified vertices.
+         * @param first Index of the first modified vertex.
+         * @param count Number of modified vertices.
+         *
+         * @throws common::exception::TraceableException If the range is outside of the array or T is unsupported.
+         *
+         * Usage Example:
+         * @code
+         * positions[10] = glm::vec3(0.0f);
+         * attribute->update<glm::vec3>(positions, 10, 1);
+         * @endcode
+         */
+        template <typename T>
+        void update(std::span<const T> values, std::size_t first, std::size_t count)
+        {
+            m_context->template updateValues<T>(values, first, count);
+            upload<T>();
         }
 
         /**
@@ -104,7 +174,7 @@ namespace artist::graphic::pipeline
          */
         void unbind()
         {
-            unbind(m_context);
+            unbind(*m_context);
         }
 
         /**
@@ -118,10 +188,23 @@ namespace artist::graphic::pipeline
         }
 
     protected:
-        virtual void unbind(std::shared_ptr<typename API::AttributeContext> context) = 0;
-        virtual void bind(std::shared_ptr<typename API::AttributeContext> context) = 0;
+        virtual void unbind(typename API::AttributeContext &context) = 0;
+        virtual void bind(typename API::AttributeContext &context) = 0;
 
     private:
+        template <typename T>
+        void upload()
+        {
+            if constexpr (graphic::validator::HasComponent<typename API::AttributeContext::template Setter<T>>)
+            {
+                API::AttributeContext::template Setter<T>::on(*m_context);
+            }
+            else
+            {
+                throw common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::UNSUPPORTED_TYPE");
+            }
+        }
+
         std::shared_ptr<typename API::AttributeContext> m_context;
     };
 
@@ -147,7 +230,7 @@ namespace artist::graphic::pipeline
         using IAttribute<API>::set;
 
     protected:
-        void bind(std::shared_ptr<typename API::AttributeContext> context) override
+        void bind(typename API::AttributeContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::AttributeContext::Binder<PROFILE>>)
             {
@@ -155,7 +238,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void unbind(std::shared_ptr<typename API::AttributeContext> context) override
+        void unbind(typename API::AttributeContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::AttributeContext::Unbinder<PROFILE>>)
             {
@@ -0,0 +1,169 @@
+/**
+ * @file DrawKey.hpp
+ * @brief 64-bit draw keys packing the state a draw needs, so that sorting them groups state changes.
+ *
+ * Submitting draws in application order switches program, render state and material whenever
+ * two consecutive draws differ. Encoding these in a key, most expensive switch in the highest
+ * bits, and sorting the draws by key puts draws sharing a program next to each other, then those
+ * sharing a render state within them, and so on: each switch happens once per group instead of
+ * once per draw. Depth in the low bits orders the draws of a group front to back, so that early
+ * depth testing rejects hidden fragments.
+ *
+ * Which fields a key holds, in which order and with how many bits, depends on the pipeline:
+ * transparent passes must be drawn back to front before anything else, for instance. The layout
+ * is therefore a value set on the pipeline context, with opaque and transparent presets.
+ *
+ * @code
+ * const DrawKeyLayout &layout = pipeline->getContext()->getDrawKeyLayout();
+ * const std::uint64_t key = layout.encode({.pass = 0, .program = programIndex, .material = materialIndex, .depth = viewDepth / farPlane});
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <initializer_list>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::pipeline
+{
+    /**
+     * @brief Field of a draw key.
+     */
+    enum class DrawKeyField : std::uint8_t
+    {
+        Pass,         ///< Index of the pass, or layer, of the draw.
+        Program,      ///< Index of the program of the draw.
+        RenderState,  ///< Index of the blend, depth and stencil state of the draw.
+        Material,     ///< Index of the textures and buffers of the draw.
+        Depth,        ///< View depth, closest first.
+        ReverseDepth, ///< View depth, farthest first.
+    };
+
+    /**
+     * @struct DrawKeyFieldWidth
+     * @brief Number of bits a layout gives to a field.
+     */
+    struct DrawKeyFieldWidth
+    {
+        DrawKeyField field; ///< The field.
+        unsigned bits;      ///< Bits of the field, at least 1.
+    };
+
+    /**
+     * @struct DrawKeyValues
+     * @brief Values encoded into a draw key. Fields missing from the layout are ignored.
+     */
+    struct DrawKeyValues
+    {
+        std::uint32_t pass = 0;        ///< Index of the pass.
+        std::uint32_t program = 0;     ///< Index of the program.
+        std::uint32_t renderState = 0; ///< Index of the render state.
+        std::uint32_t material = 0;    ///< Index of the material.
+        float depth = 0.0f;            ///< View depth normalized to [0, 1], clamped.
+    };
+
+    /**
+     * @class DrawKeyLayout
+     * @brief Order and width of the fields of a draw key.
+     *
+     * Integer values wider than their field keep their low bits only.
+     */
+    class DrawKeyLayout
+    {
+    public:
+        static constexpr std::size_t FIELDS_COUNT = 6;
+
+        /**
+         * @brief Fields from the most significant to the least significant.
+         * @throws common::exception::TraceableException If a field is repeated, has no bit, or
+         *         the fields need more than 64 bits.
+         */
+        DrawKeyLayout(std::initializer_list<DrawKeyFieldWidth> fields)
+        {
+            unsigned shift = 64;
+            for (const DrawKeyFieldWidth &field : fields)
+            {
+                const auto index = static_cast<std::size_t>(field.field);
+                if (field.bits == 0 || field.bits > shift || m_widths[index] != 0)
+                {
+                    throw common::exception::TraceableException<std::invalid_argument>(std::format("ERROR::DRAW_KEY::INVALID_LAYOUT: Field {} with {} bits does not fit the {} bits left", index, field.bits, shift));
+                }
+                shift -= field.bits;
+                m_widths[index] = field.bits;
+                m_shifts[index] = shift;
+            }
+        }
+
+        /**
+         * @brief Pass, program, render state, material, then depth front to back.
+         */
+        static DrawKeyLayout opaque()
+        {
+            return {{DrawKeyField::Pass, 4}, {DrawKeyField::Program, 10}, {DrawKeyField::RenderState, 8}, {DrawKeyField::Material, 18}, {DrawKeyField::Depth, 24}};
+        }
+
+        /**
+         * @brief Pass, depth back to front, then program, render state and material.
+         */
+        static DrawKeyLayout transparent()
+        {
+            return {{DrawKeyField::Pass, 4}, {DrawKeyField::ReverseDepth, 24}, {DrawKeyField::Program, 10}, {DrawKeyField::RenderState, 8}, {DrawKeyField::Material, 18}};
+        }
+
+        [[nodiscard]] std::uint64_t encode(const DrawKeyValues &values) const
+        {
+            const std::uint32_t depth = quantize(values.depth, m_widths[static_cast<std::size_t>(DrawKeyField::Depth)]);
+            const std::uint32_t reverseDepth = ~quantize(values.depth, m_widths[static_cast<std::size_t>(DrawKeyField::ReverseDepth)]);
+            return place(DrawKeyField::Pass, values.pass) |
+                   place(DrawKeyField::Program, values.program) |
+                   place(DrawKeyField::RenderState, values.renderState) |
+                   place(DrawKeyField::Material, values.material) |
+                   place(DrawKeyField::Depth, depth) |
+                   place(DrawKeyField::ReverseDepth, reverseDepth);
+        }
+
+        /**
+         * @brief Reads a field back from a key. Depths are returned quantized, as stored.
+         */
+        [[nodiscard]] std::uint32_t decode(std::uint64_t key, DrawKeyField field) const
+        {
+            const auto index = static_cast<std::size_t>(field);
+            return m_widths[index] == 0 ? 0 : static_cast<std::uint32_t>((key >> m_shifts[index]) & mask(m_widths[index]));
+        }
+
+        /**
+         * @return The bits given to a field, 0 if the layout does not hold it.
+         */
+        [[nodiscard]] unsigned getBits(DrawKeyField field) const
+        {
+            return m_widths[static_cast<std::size_t>(field)];
+        }
+
+    private:
+        static constexpr std::uint64_t mask(unsigned bits)
+        {
+            return bits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+        }
+
+        static std::uint32_t quantize(float depth, unsigned bits)
+        {
+            const unsigned clampedBits = std::min(bits, 32u);
+            const double scale = static_cast<double>(mask(clampedBits));
+            return static_cast<std::uint32_t>(static_cast<double>(std::clamp(depth, 0.0f, 1.0f)) * scale);
+        }
+
+        [[nodiscard]] std::uint64_t place(DrawKeyField field, std::uint32_t value) const
+        {
+            const auto index = static_cast<std::size_t>(field);
+            return m_widths[index] == 0 ? 0 : (value & mask(m_widths[index])) << m_shifts[index];
+        }
+
+        std::array<unsigned, FIELDS_COUNT> m_widths{}; ///< Bits of each field, 0 when absent.
+        std::array<unsigned, FIELDS_COUNT> m_shifts{}; ///< Position of the lowest bit of each field.
+    };
+}
@@ -79,19 +79,20 @@ namespace artist::graphic::pipeline
             {
                 shader->load();
             }
-            load(m_context);
-            readUniforms(m_context);
-            readAttributes(m_context);
+            load(*m_context);
+            readUniforms(*m_context);
+            readAttributes(*m_context);
         }
 
         virtual void use()
         {
-            use(m_context);
+            use(*m_context);
+            bindVertexArray(*m_context);
         }
 
         virtual void free()
         {
-            free(m_context);
+            free(*m_context);
         }
 
         /**
@@ -154,11 +155,12 @@ namespace artist::graphic::pipeline
         }
 
     protected:
-        virtual void load(std::shared_ptr<typename API::PassContext> context) = 0;
-        virtual void readUniforms(std::shared_ptr<typename API::PassContext> context) = 0;
-        virtual void readAttributes(std::shared_ptr<typename API::PassContext> context) = 0;
-        virtual void free(std::shared_ptr<typename API::PassContext> context) = 0;
-        virtual void use(std::shared_ptr<typename API::PassContext> context) = 0;
+        virtual void load(typename API::PassContext &context) = 0;
+        virtual void readUniforms(typename API::PassContext &context) = 0;
+        virtual void readAttributes(typename API::PassContext &context) = 0;
+        virtual void free(typename API::PassContext &context) = 0;
+        virtual void use(typename API::PassContext &context) = 0;
+        virtual void bindVertexArray(typename API::PassContext &context) = 0;
         virtual std::shared_ptr<IPass<API>> shared() const = 0;
 
     private:
@@ -198,7 +200,7 @@ namespace artist::graphic::pipeline
         }
 
     protected:
-        void load(std::shared_ptr<typename API::PassContext> context) override
+        void load(typename API::PassContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PassContext::Loader<PROFILE>>)
             {
@@ -206,7 +208,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void readUniforms(std::shared_ptr<typename API::PassContext> context) override
+        void readUniforms(typename API::PassContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PassContext::UniformReader<PROFILE>>)
             {
@@ -214,7 +216,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void readAttributes(std::shared_ptr<typename API::PassContext> context) override
+        void readAttributes(typename API::PassContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PassContext::AttributeReader<PROFILE>>)
             {
@@ -222,7 +224,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void free(std::shared_ptr<typename API::PassContext> context) override
+        void free(typename API::PassContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PassContext::Freer<PROFILE>>)
             {
@@ -230,7 +232,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void use(std::shared_ptr<typename API::PassContext> context) override
+        void use(typename API::PassContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PassContext::User<PROFILE>>)
             {
@@ -238,6 +240,14 @@ namespace artist::graphic::pipeline
             }
         }
 
+        void bindVertexArray(typename API::PassContext &context) override
+        {
+            if constexpr (graphic::validator::HasComponent<typename API::PassContext::VertexArrayBinder<PROFILE>>)
+            {
+                API::PassContext::template VertexArrayBinder<PROFILE>::on(context);
+            }
+        }
+
         std::shared_ptr<IPass<API>> shared() const override
         {
             return std::make_shared<Pass<API, PROFILE>>(*this);
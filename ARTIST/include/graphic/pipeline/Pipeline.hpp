@@ -104,7 +104,7 @@ namespace artist::graphic::pipeline
         virtual void use(const int &pass)
         {
             m_context->setCurrentPass(pass);
-            use(m_context);
+            use(*m_context);
         }
 
         /**
@@ -113,7 +113,7 @@ namespace artist::graphic::pipeline
          */
         virtual void reset()
         {
-            reset(m_context);
+            reset(*m_context);
         }
 
         /**
@@ -125,8 +125,8 @@ namespace artist::graphic::pipeline
         }
 
     protected:
-        virtual void use(std::shared_ptr<typename API::PipelineContext> context) = 0;
-        virtual void reset(std::shared_ptr<typename API::PipelineContext> context) = 0;
+        virtual void use(typename API::PipelineContext &context) = 0;
+        virtual void reset(typename API::PipelineContext &context) = 0;
 
     private:
         std::shared_ptr<typename API::PipelineContext> m_context;
@@ -158,9 +158,9 @@ namespace artist::graphic::pipeline
          * and invokes its 'on' method if available. This allows for profile-specific behavior
          * to be executed, adapting the pipeline to various rendering requirements.
          *
-         * @param context The shared pointer to the current API's PipelineContext.
+         * @param context The PipelineContext of the current API, owned by the pipeline.
          */
-        void use(std::shared_ptr<typename API::PipelineContext> context) override
+        void use(typename API::PipelineContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PipelineContext::User<PROFILE>>)
             {
@@ -174,9 +174,9 @@ namespace artist::graphic::pipeline
          * and invokes its 'on' method to reset any state or configuration back to its default.
          * This is crucial for ensuring that the pipeline can be correctly reinitialized or reused.
          *
-         * @param context The shared pointer to the current API's PipelineContext.
+         * @param context The PipelineContext of the current API, owned by the pipeline.
          */
-        void reset(std::shared_ptr<typename API::PipelineContext> context) override
+        void reset(typename API::PipelineContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::PipelineContext::Resetter<PROFILE>>)
             {
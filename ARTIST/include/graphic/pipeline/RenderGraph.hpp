@@ -0,0 +1,431 @@
+/**
+ * @file RenderGraph.hpp
+ * @brief Frame described as passes reading and writing resources, compiled once into a schedule.
+ *
+ * IPipeline walks its passes in a fixed list, and the caller has to order them and keep their
+ * inputs alive by hand. The render graph instead lets each pass declare, in a setup callback, the
+ * resources it reads and writes. Compiling the graph then:
+ *  - links each read to the last pass writing the resource before the reader, passes running in
+ *    declaration order,
+ *  - culls the passes whose outputs are never consumed by a pass that is kept: a pass is kept when
+ *    it writes an imported resource (e.g. the default framebuffer) or declares a side effect,
+ *  - computes the barriers needed between a write and the reads that follow it,
+ *  - computes the lifetime of each transient resource, from its first to its last use.
+ *
+ * The compiled schedule is reused frame after frame. Setups run again only when the graph is
+ * invalidated, so an optional effect is switched off by not reading its output: its passes are
+ * culled at the next compile and cost nothing per frame.
+ *
+ * @code
+ * RenderGraph graph;
+ * auto backbuffer = graph.importResource("backbuffer");
+ * auto scene = graph.createResource("scene");
+ * auto bloom = graph.createResource("bloom");
+ * graph.addPass("geometry", [&](RenderGraphBuilder &builder) { builder.write(scene); }, [&] { geometryPass->use(); drawScene(); });
+ * graph.addPass("bloom", [&](RenderGraphBuilder &builder) { builder.read(scene); builder.write(bloom); }, [&] { ... });
+ * graph.addPass("composite", [&](RenderGraphBuilder &builder)
+ *               {
+ *                   builder.read(scene);
+ *                   if (bloomEnabled) { builder.read(bloom); }
+ *                   builder.write(backbuffer); }, [&] { ... });
+ * graph.execute(); // compiles on first use, then replays the schedule
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <common/exception/TraceableException.hpp>
+
+namespace artist::graphic::pipeline
+{
+    using RenderGraphResource = std::uint32_t;
+
+    /**
+     * @struct RenderGraphBarrier
+     * @brief Synchronization needed before a pass reads a resource written by an earlier pass.
+     */
+    struct RenderGraphBarrier
+    {
+        RenderGraphResource resource; ///< Resource written then read.
+        std::size_t writer;           ///< Pass that wrote the resource, as an index of the graph passes.
+        std::size_t reader;           ///< Pass about to read the resource.
+    };
+
+    /**
+     * @struct RenderGraphLifetime
+     * @brief Schedule steps between which a transient resource must exist.
+     */
+    struct RenderGraphLifetime
+    {
+        std::size_t first = std::numeric_limits<std::size_t>::max(); ///< Step of the first use.
+        std::size_t last = 0;                                        ///< Step of the last use.
+
+        [[nodiscard]] bool isUsed() const
+        {
+            return first != std::numeric_limits<std::size_t>::max();
+        }
+    };
+
+    /**
+     * @class RenderGraphBuilder
+     * @brief Collects the resource accesses of one pass during its setup.
+     */
+    class RenderGraphBuilder
+    {
+    public:
+        explicit RenderGraphBuilder(std::size_t resourceCount) : m_resourceCount(resourceCount) {}
+
+        /**
+         * @throws common::exception::TraceableException If the resource does not belong to the graph.
+         */
+        void read(RenderGraphResource resource)
+        {
+            check(resource);
+            m_reads.push_back(resource);
+        }
+
+        /**
+         * @throws common::exception::TraceableException If the resource does not belong to the graph.
+         */
+        void write(RenderGraphResource resource)
+        {
+            check(resource);
+            m_writes.push_back(resource);
+        }
+
+        /**
+         * @brief Keeps the pass even if nothing reads its outputs, e.g. a readback or a query.
+         */
+        void sideEffect()
+        {
+            m_sideEffect = true;
+        }
+
+        [[nodiscard]] const std::vector<RenderGraphResource> &getReads() const
+        {
+            return m_reads;
+        }
+
+        [[nodiscard]] const std::vector<RenderGraphResource> &getWrites() const
+        {
+            return m_writes;
+        }
+
+        [[nodiscard]] bool hasSideEffect() const
+        {
+            return m_sideEffect;
+        }
+
+    private:
+        void check(RenderGraphResource resource) const
+        {
+            if (resource >= m_resourceCount)
+            {
+                throw common::exception::TraceableException<std::out_of_range>(std::format("ERROR::RENDER_GRAPH::UNKNOWN_RESOURCE: Resource {} is not one of the {} resources of the graph", resource, m_resourceCount));
+            }
+        }
+
+        std::size_t m_resourceCount;              ///< Resources of the graph, to validate handles.
+        std::vector<RenderGraphResource> m_reads;  ///< Resources read by the pass.
+        std::vector<RenderGraphResource> m_writes; ///< Resources written by the pass.
+        bool m_sideEffect = false;                 ///< Whether the pass must run even if its outputs are unused.
+    };
+
+    /**
+     * @class RenderGraph
+     * @brief Passes and resources of a frame, and the schedule compiled from them.
+     */
+    class RenderGraph
+    {
+    public:
+        using Setup = std::function<void(RenderGraphBuilder &)>;
+        using Execute = std::function<void()>;
+        using BarrierHandler = std::function<void(const RenderGraphBarrier &)>;
+        using LifetimeHandler = std::function<void(RenderGraphResource)>;
+
+        /**
+         * @brief Declares a resource owned by the graph, needed only between its first and last use.
+         */
+        RenderGraphResource createResource(std::string name)
+        {
+            return addResource(std::move(name), false);
+        }
+
+        /**
+         * @brief Declares a resource living outside the graph: writing it is an output of the frame.
+         */
+        RenderGraphResource importResource(std::string name)
+        {
+            return addResource(std::move(name), true);
+        }
+
+        /**
+         * @brief Adds a pass, scheduled after the passes added before it.
+         *
+         * @param name Name of the pass, for diagnostics.
+         * @param setup Declares the accesses of the pass. Called on every compile.
+         * @param execute Records the work of the pass. Called on every execute, if the pass is kept.
+         * @return The index of the pass.
+         */
+        std::size_t addPass(std::string name, Setup setup, Execute execute)
+        {
+            m_passes.push_back({std::move(name), std::move(setup), std::move(execute)});
+            invalidate();
+            return m_passes.size() - 1;
+        }
+
+        /**
+         * @brief Calls handler before each pass, once per barrier it needs.
+         */
+        void setBarrierHandler(BarrierHandler handler)
+        {
+            m_onBarrier = std::move(handler);
+        }
+
+        /**
+         * @brief Calls realize before the first use of each transient resource and release after its last one.
+         *
+         * Resources whose lifetimes do not overlap can share the same memory.
+         */
+        void setLifetimeHandlers(LifetimeHandler realize, LifetimeHandler release)
+        {
+            m_onRealize = std::move(realize);
+            m_onRelease = std::move(release);
+        }
+
+        /**
+         * @brief Makes the next execute run the setups and compile the graph again.
+         */
+        void invalidate()
+        {
+            m_compiled = false;
+        }
+
+        /**
+         * @brief Runs the setups, culls unused passes and computes barriers and lifetimes.
+         * @throws common::exception::TraceableException If a pass reads a transient resource no earlier pass writes.
+         */
+        void compile()
+        {
+            const std::size_t resourceCount = m_resources.size();
+            std::vector<RenderGraphBuilder> accesses;
+            accesses.reserve(m_passes.size());
+            for (Pass &pass : m_passes)
+            {
+                accesses.emplace_back(resourceCount);
+                pass.setup(accesses.back());
+            }
+
+            // Producer of each read: the last pass writing the resource before the reader
+            std::vector<std::vector<std::pair<RenderGraphResource, std::size_t>>> producers(m_passes.size());
+            std::vector<std::size_t> lastWriter(resourceCount, NO_PASS);
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+            {
+                for (RenderGraphResource resource : accesses[pass].getReads())
+                {
+                    if (lastWriter[resource] == NO_PASS)
+                    {
+                        if (!m_resources[resource].imported)
+                        {
+                            throw common::exception::TraceableException<std::runtime_error>(std::format("ERROR::RENDER_GRAPH::READ_BEFORE_WRITE: Pass {} reads {} before any pass writes it", m_passes[pass].name, m_resources[resource].name));
+                        }
+                        continue; // Imported contents from the previous frame or the application
+                    }
+                    producers[pass].emplace_back(resource, lastWriter[resource]);
+                }
+                for (RenderGraphResource resource : accesses[pass].getWrites())
+                {
+                    lastWriter[resource] = pass;
+                }
+            }
+
+            // Cull from the outputs back: producers always come before their readers
+            std::vector<bool> kept(m_passes.size(), false);
+            for (std::size_t pass = m_passes.size(); pass-- > 0;)
+            {
+                if (accesses[pass].hasSideEffect())
+                {
+                    kept[pass] = true;
+                }
+                for (RenderGraphResource resource : accesses[pass].getWrites())
+                {
+                    kept[pass] = kept[pass] || m_resources[resource].imported;
+                }
+                if (kept[pass])
+                {
+                    for (const auto &[resource, producer] : producers[pass])
+                    {
+                        kept[producer] = true;
+                    }
+                }
+            }
+
+            m_schedule.clear();
+            m_barriers.clear();
+            m_lifetimes.assign(resourceCount, RenderGraphLifetime{});
+            for (std::size_t pass = 0; pass < m_passes.size(); ++pass)
+            {
+                if (!kept[pass])
+                {
+                    continue;
+                }
+                const std::size_t step = m_schedule.size();
+                Step scheduled{pass, m_barriers.size(), 0, {}, {}};
+                for (const auto &[resource, producer] : producers[pass])
+                {
+                    m_barriers.push_back({resource, producer, pass});
+                }
+                scheduled.barrierCount = m_barriers.size() - scheduled.barrierFirst;
+                for (const auto *list : {&accesses[pass].getReads(), &accesses[pass].getWrites()})
+                {
+                    for (RenderGraphResource resource : *list)
+                    {
+                        RenderGraphLifetime &lifetime = m_lifetimes[resource];
+                        lifetime.first = std::min(lifetime.first, step);
+                        lifetime.last = step;
+                    }
+                }
+                m_schedule.push_back(std::move(scheduled));
+            }
+            for (RenderGraphResource resource = 0; resource < resourceCount; ++resource)
+            {
+                const RenderGraphLifetime &lifetime = m_lifetimes[resource];
+                if (lifetime.isUsed() && !m_resources[resource].imported)
+                {
+                    m_schedule[lifetime.first].realize.push_back(resource);
+                    m_schedule[lifetime.last].release.push_back(resource);
+                }
+            }
+            m_compiled = true;
+        }
+
+        /**
+         * @brief Runs the kept passes in order, compiling the graph first if it changed.
+         */
+        void execute()
+        {
+            if (!m_compiled)
+            {
+                compile();
+            }
+            for (const Step &step : m_schedule)
+            {
+                if (m_onRealize)
+                {
+                    for (RenderGraphResource resource : step.realize)
+                    {
+                        m_onRealize(resource);
+                    }
+                }
+                if (m_onBarrier)
+                {
+                    for (std::size_t barrier = step.barrierFirst; barrier < step.barrierFirst + step.barrierCount; ++barrier)
+                    {
+                        m_onBarrier(m_barriers[barrier]);
+                    }
+                }
+                m_passes[step.pass].execute();
+                if (m_onRelease)
+                {
+                    for (RenderGraphResource resource : step.release)
+                    {
+                        m_onRelease(resource);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Indices of the kept passes, in execution order.
+         */
+        [[nodiscard]] std::vector<std::size_t> getExecutionOrder() const
+        {
+            std::vector<std::size_t> order;
+            order.reserve(m_schedule.size());
+            for (const Step &step : m_schedule)
+            {
+                order.push_back(step.pass);
+            }
+            return order;
+        }
+
+        [[nodiscard]] const std::vector<RenderGraphBarrier> &getBarriers() const
+        {
+            return m_barriers;
+        }
+
+        /**
+         * @brief Lifetime of a resource in the compiled schedule, counted in kept passes.
+         */
+        [[nodiscard]] const RenderGraphLifetime &getLifetime(RenderGraphResource resource) const
+        {
+            return m_lifetimes.at(resource);
+        }
+
+        [[nodiscard]] const std::string &getResourceName(RenderGraphResource resource) const
+        {
+            return m_resources.at(resource).name;
+        }
+
+        [[nodiscard]] const std::string &getPassName(std::size_t pass) const
+        {
+            return m_passes.at(pass).name;
+        }
+
+        [[nodiscard]] bool isCompiled() const
+        {
+            return m_compiled;
+        }
+
+    private:
+        static constexpr std::size_t NO_PASS = std::numeric_limits<std::size_t>::max();
+
+        struct Resource
+        {
+            std::string name; ///< Name, for diagnostics.
+            bool imported;    ///< Whether the resource lives outside the graph.
+        };
+
+        struct Pass
+        {
+            std::string name; ///< Name, for diagnostics.
+            Setup setup;      ///< Declares the accesses of the pass.
+            Execute execute;  ///< Records the work of the pass.
+        };
+
+        struct Step
+        {
+            std::size_t pass;                          ///< Index of the pass.
+            std::size_t barrierFirst;                  ///< First barrier to issue before the pass.
+            std::size_t barrierCount;                  ///< Number of barriers to issue before the pass.
+            std::vector<RenderGraphResource> realize;  ///< Transient resources first used by the pass.
+            std::vector<RenderGraphResource> release;  ///< Transient resources last used by the pass.
+        };
+
+        RenderGraphResource addResource(std::string name, bool imported)
+        {
+            m_resources.push_back({std::move(name), imported});
+            invalidate();
+            return static_cast<RenderGraphResource>(m_resources.size() - 1);
+        }
+
+        std::vector<Resource> m_resources;              ///< Declared resources.
+        std::vector<Pass> m_passes;                     ///< Declared passes, in declaration order.
+        std::vector<Step> m_schedule;                   ///< Kept passes, in execution order.
+        std::vector<RenderGraphBarrier> m_barriers;     ///< Barriers of every step, step after step.
+        std::vector<RenderGraphLifetime> m_lifetimes;   ///< Lifetime of each resource in the schedule.
+        BarrierHandler m_onBarrier;                     ///< Issues a barrier.
+        LifetimeHandler m_onRealize;                    ///< Creates a transient resource.
+        LifetimeHandler m_onRelease;                    ///< Releases a transient resource.
+        bool m_compiled = false;                        ///< Whether the schedule matches the passes.
+    };
+} // namespace artist::graphic::pipeline
@@ -104,9 +104,9 @@ namespace artist::graphic::pipeline
             {
                 if (m_context->getShaderCode().empty())
                 {
-                    read(m_context);
+                    read(*m_context);
                 }
-                load(m_context);
+                load(*m_context);
             }
         }
 
@@ -117,14 +117,14 @@ namespace artist::graphic::pipeline
         {
             if (m_context)
             {
-                free(m_context);
+                free(*m_context);
             }
         }
 
     protected:
-        virtual void load(std::shared_ptr<typename API::ShaderContext> context) = 0;
-        virtual void free(std::shared_ptr<typename API::ShaderContext> context) = 0;
-        virtual void read(std::shared_ptr<typename API::ShaderContext> context) = 0;
+        virtual void load(typename API::ShaderContext &context) = 0;
+        virtual void free(typename API::ShaderContext &context) = 0;
+        virtual void read(typename API::ShaderContext &context) = 0;
 
     private:
         std::shared_ptr<typename API::ShaderContext> m_context; // API-specific shader context
@@ -156,7 +156,7 @@ namespace artist::graphic::pipeline
         }
 
     protected:
-        void free(std::shared_ptr<typename API::ShaderContext> context) override
+        void free(typename API::ShaderContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::ShaderContext::template Freer<PROFILE>>)
             {
@@ -164,7 +164,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void load(std::shared_ptr<typename API::ShaderContext> context) override
+        void load(typename API::ShaderContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::ShaderContext::template Loader<PROFILE>>)
             {
@@ -172,7 +172,7 @@ namespace artist::graphic::pipeline
             }
         }
 
-        void read(std::shared_ptr<typename API::ShaderContext> context) override
+        void read(typename API::ShaderContext &context) override
         {
             if constexpr (graphic::validator::HasComponent<typename API::ShaderContext::template Reader<PROFILE>>)
             {
@@ -0,0 +1,144 @@
+/**
+ * @file StaticPipeline.hpp
+ * @brief Pipeline whose passes are fixed at compile time, used without virtual dispatch.
+ *
+ * Pipeline keeps its passes as IPass pointers in its context: using a pass goes through the virtual
+ * use of the pipeline, the pipeline User component, a shared_ptr copy of the pass, then the virtual
+ * use of the pass and its virtual protected overloads. When the passes of a pipeline are known when
+ * it is built, StaticPipeline keeps them in a std::tuple with their concrete types and calls the
+ * User and VertexArrayBinder components of each pass directly. Iterating the passes is a fold
+ * expression over the tuple, so a whole frame compiles down to the component calls themselves.
+ *
+ * Each pass type must be a Pass<API, PROFILE> whose PROFILE passes API::Validator::validatePass.
+ *
+ * @code
+ * StaticPipeline<api::OpenGL, Pass<api::OpenGL, Classic>, Pass<api::OpenGL, Classic>> pipeline(geometryPass, lightingPass);
+ * pipeline.load();
+ * pipeline.run([&](auto index, auto &pass)
+ *              {
+ *                  if constexpr (index == 0) { drawScene(); } else { drawFullscreenQuad(); }
+ *              });
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <graphic/pipeline/Pass.hpp>
+#include <graphic/validator/ComponentConcept.hpp>
+
+namespace artist::graphic::pipeline
+{
+    namespace detail
+    {
+        /**
+         * @brief Extracts the API and PROFILE of a Pass type.
+         */
+        template <typename T>
+        struct PassTraits;
+
+        template <typename API, auto PROFILE>
+        struct PassTraits<Pass<API, PROFILE>>
+        {
+            using Api = API;
+            static constexpr auto profile = PROFILE;
+        };
+
+        template <typename API, typename T>
+        concept StaticPassOf = requires {
+            requires std::same_as<typename PassTraits<T>::Api, API>;
+            requires API::Validator::template validatePass<API, PassTraits<T>::profile>();
+        };
+    }
+
+    /**
+     * @brief Rendering pipeline over a fixed list of pass types.
+     *
+     * @tparam API The graphics API context.
+     * @tparam Passes The Pass<API, PROFILE> type of each pass, in the order they are used.
+     */
+    template <typename API, typename... Passes>
+        requires(sizeof...(Passes) > 0 && (detail::StaticPassOf<API, Passes> && ...))
+    class StaticPipeline
+    {
+    public:
+        static constexpr std::size_t PASSES_COUNT = sizeof...(Passes);
+
+        /**
+         * @param passes The passes, in the order they are used.
+         */
+        explicit StaticPipeline(std::shared_ptr<Passes>... passes)
+            : m_contexts{passes->getContext()...}, m_passes(std::move(passes)...)
+        {
+        }
+
+        /**
+         * @brief Loads every pass, in order.
+         */
+        void load()
+        {
+            std::apply([](auto &...passes)
+                       { (passes->load(), ...); },
+                       m_passes);
+        }
+
+        /**
+         * @brief Uses one pass: makes its program current and binds its vertex array object.
+         * @tparam INDEX The index of the pass.
+         */
+        template <std::size_t INDEX>
+            requires(INDEX < PASSES_COUNT)
+        void use()
+        {
+            using Traits = detail::PassTraits<std::tuple_element_t<INDEX, std::tuple<Passes...>>>;
+            if constexpr (graphic::validator::HasComponent<typename API::PassContext::template User<Traits::profile>>)
+            {
+                API::PassContext::template User<Traits::profile>::on(*std::get<INDEX>(m_contexts));
+            }
+            if constexpr (graphic::validator::HasComponent<typename API::PassContext::template VertexArrayBinder<Traits::profile>>)
+            {
+                API::PassContext::template VertexArrayBinder<Traits::profile>::on(*std::get<INDEX>(m_contexts));
+            }
+        }
+
+        /**
+         * @brief Uses every pass in order, calling body after each one to issue its draws.
+         *
+         * @param body Callable taking a std::integral_constant<std::size_t, INDEX> and the pass, so that
+         *             the draws of each pass can be selected with if constexpr.
+         */
+        template <typename Body>
+        void run(Body &&body)
+        {
+            [this, &body]<std::size_t... INDEX>(std::index_sequence<INDEX...>)
+            {
+                ((use<INDEX>(), body(std::integral_constant<std::size_t, INDEX>{}, *std::get<INDEX>(m_passes))), ...);
+            }(std::index_sequence_for<Passes...>{});
+        }
+
+        /**
+         * @brief Returns a pass with its concrete type.
+         * @tparam INDEX The index of the pass.
+         */
+        template <std::size_t INDEX>
+            requires(INDEX < PASSES_COUNT)
+        [[nodiscard]] const auto &forPass() const
+        {
+            return std::get<INDEX>(m_passes);
+        }
+
+        [[nodiscard]] static constexpr std::size_t getPassesCount()
+        {
+            return PASSES_COUNT;
+        }
+
+    private:
+        std::array<std::shared_ptr<typename API::PassContext>, PASSES_COUNT> m_contexts; ///< Contexts of the passes, read once at construction.
+        std::tuple<std::shared_ptr<Passes>...> m_passes;                                 ///< The passes, keeping their contexts alive.
+    };
+} // namespace artist::graphic::pipeline
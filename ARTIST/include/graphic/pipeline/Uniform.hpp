@@ -65,7 +65,7 @@ namespace artist::graphic::pipeline
             if constexpr (graphic::validator::HasComponent<typename API::UniformContext::template Setter<T>>)
             {
                 m_context->template setValue<T>(value);
-                API::UniformContext::template Setter<T>::on(m_context);
+                API::UniformContext::template Setter<T>::on(*m_context);
             }
             else
             {
@@ -1,13 +1,13 @@
 #pragma once
 
-#include <memory>
 #include <type_traits>
 
 namespace artist::graphic::validator
 {
-    // Concept to check if a type has a static method do with the specified signature
+    // Concept to check if a type has a static method on taking the context by reference: the owner
+    // of the context keeps the shared ownership, components only borrow it for the call
     template <typename T, typename C>
-    concept HasOnMethod = requires(std::shared_ptr<C> context) {
+    concept HasOnMethod = requires(C &context) {
         {
             T::on(context)
         } -> std::same_as<void>;
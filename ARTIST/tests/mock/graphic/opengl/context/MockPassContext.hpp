@@ -12,6 +12,7 @@
 #include <graphic/opengl/pipeline/component/pass/MockUniformReader.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockAttributeReader.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockUser.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockVertexArrayBinder.hpp>
 
 namespace artist::mock::graphic::opengl::context
 {
@@ -31,5 +32,7 @@ namespace artist::mock::graphic::opengl::context
         using AttributeReader = opengl::pipeline::component::pass::MockAttributeReader<PROFILE>;
         template <auto PROFILE>
         using User = opengl::pipeline::component::pass::MockUser<PROFILE>;
+        template <auto PROFILE>
+        using VertexArrayBinder = opengl::pipeline::component::pass::MockVertexArrayBinder<PROFILE>;
     };
 }
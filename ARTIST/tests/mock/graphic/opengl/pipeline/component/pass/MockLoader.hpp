@@ -23,11 +23,11 @@ namespace artist::mock::graphic::opengl::pipeline::component::pass
             ::testing::Mock::VerifyAndClearExpectations(instance().get());
         }
 
-        static void on(std::shared_ptr<graphic::api::MockOpenGL::PassContext> openglContext)
+        static void on(graphic::api::MockOpenGL::PassContext &openglContext)
         {
             instance()->mockOn(openglContext);
         }
 
-        MOCK_METHOD(void, mockOn, (std::shared_ptr<graphic::api::MockOpenGL::PassContext>), ());
+        MOCK_METHOD(void, mockOn, (graphic::api::MockOpenGL::PassContext &), ());
     };
 }
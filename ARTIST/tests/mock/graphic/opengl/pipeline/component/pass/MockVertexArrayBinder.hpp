@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <gmock/gmock.h>
+#include <graphic/MockApi.hpp>
+#include <graphic/opengl/profile/Pass.hpp>
+
+namespace artist::mock::graphic::opengl::pipeline::component::pass
+{
+    template <auto PROFILE>
+    class MockVertexArrayBinder
+    {
+    public:
+        static std::shared_ptr<MockVertexArrayBinder<PROFILE>> instance()
+        {
+            static auto instance = std::make_shared<MockVertexArrayBinder<PROFILE>>();
+            return instance;
+        }
+
+        static void reset()
+        {
+            ::testing::Mock::VerifyAndClearExpectations(instance().get());
+        }
+
+        static void on(graphic::api::MockOpenGL::PassContext &openglContext)
+        {
+            instance()->mockOn(openglContext);
+        }
+
+        MOCK_METHOD(void, mockOn, (graphic::api::MockOpenGL::PassContext &), ());
+    };
+}
@@ -22,11 +22,11 @@ namespace artist::mock::graphic::opengl::pipeline::component::shader
             ::testing::Mock::VerifyAndClearExpectations(instance().get());
         }
 
-        static void on(std::shared_ptr<graphic::api::MockOpenGL::ShaderContext> openglContext)
+        static void on(graphic::api::MockOpenGL::ShaderContext &openglContext)
         {
             instance()->mockOn(openglContext);
         }
 
-        MOCK_METHOD(void, mockOn, (std::shared_ptr<graphic::api::MockOpenGL::ShaderContext> context), ());
+        MOCK_METHOD(void, mockOn, (graphic::api::MockOpenGL::ShaderContext &context), ());
     };
 }
\ No newline at end of file
@@ -24,12 +24,12 @@ namespace artist::mock::graphic::opengl::pipeline::component::shader
             ::testing::Mock::VerifyAndClearExpectations(instance().get());
         }
 
-        static void on(std::shared_ptr<graphic::api::MockOpenGL::ShaderContext> openglContext)
+        static void on(graphic::api::MockOpenGL::ShaderContext &openglContext)
         {
             instance()->mockOn(openglContext);
         }
 
-        MOCK_METHOD(void, mockOn, (std::shared_ptr<graphic::api::MockOpenGL::ShaderContext>), ());
+        MOCK_METHOD(void, mockOn, (graphic::api::MockOpenGL::ShaderContext &), ());
     };
 
 }
\ No newline at end of file
@@ -30,11 +30,12 @@ namespace artist::mock::graphic::pipeline::opengl
         MOCK_METHOD((const std::vector<std::shared_ptr<pipeline::IShader<API>>> &), getShaders, (), (const, override));
 
     protected:
-        MOCK_METHOD(void, readUniforms, (std::shared_ptr<typename API::PassContext> context), (override));
-        MOCK_METHOD(void, readAttributes, (std::shared_ptr<typename API::PassContext> context), (override));
-        MOCK_METHOD(void, free, (std::shared_ptr<typename API::PassContext> context), (override));
-        MOCK_METHOD(void, use, (std::shared_ptr<typename API::PassContext> context), (override));
-        MOCK_METHOD(void, load, (std::shared_ptr<typename API::PassContext> context), (override));
+        MOCK_METHOD(void, readUniforms, (typename API::PassContext &context), (override));
+        MOCK_METHOD(void, readAttributes, (typename API::PassContext &context), (override));
+        MOCK_METHOD(void, free, (typename API::PassContext &context), (override));
+        MOCK_METHOD(void, use, (typename API::PassContext &context), (override));
+        MOCK_METHOD(void, bindVertexArray, (typename API::PassContext &context), (override));
+        MOCK_METHOD(void, load, (typename API::PassContext &context), (override));
 
         MOCK_METHOD((std::shared_ptr<pipeline::IPass<API>>), shared, (), (const, override));
     };
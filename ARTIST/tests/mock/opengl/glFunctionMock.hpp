@@ -79,7 +79,32 @@
 #define glGenBuffers artist::mock::opengl::glFunctionMock::instance()->glGenBuffers_mock
 #define glBindBuffer artist::mock::opengl::glFunctionMock::instance()->glBindBuffer_mock
 #define glBufferData artist::mock::opengl::glFunctionMock::instance()->glBufferData_mock
+#define glBufferSubData artist::mock::opengl::glFunctionMock::instance()->glBufferSubData_mock
 #define glVertexAttribPointer artist::mock::opengl::glFunctionMock::instance()->glVertexAttribPointer_mock
+#define glVertexAttribIPointer artist::mock::opengl::glFunctionMock::instance()->glVertexAttribIPointer_mock
+#define glVertexAttribLPointer artist::mock::opengl::glFunctionMock::instance()->glVertexAttribLPointer_mock
+#define glGenVertexArrays artist::mock::opengl::glFunctionMock::instance()->glGenVertexArrays_mock
+#define glBindVertexArray artist::mock::opengl::glFunctionMock::instance()->glBindVertexArray_mock
+#define glDeleteVertexArrays artist::mock::opengl::glFunctionMock::instance()->glDeleteVertexArrays_mock
+#define glCopyBufferSubData artist::mock::opengl::glFunctionMock::instance()->glCopyBufferSubData_mock
+#define glDrawElements artist::mock::opengl::glFunctionMock::instance()->glDrawElements_mock
+#define glMultiDrawElementsIndirect artist::mock::opengl::glFunctionMock::instance()->glMultiDrawElementsIndirect_mock
+#define glDeleteBuffers artist::mock::opengl::glFunctionMock::instance()->glDeleteBuffers_mock
+#define glBufferStorage artist::mock::opengl::glFunctionMock::instance()->glBufferStorage_mock
+#define glMapBufferRange artist::mock::opengl::glFunctionMock::instance()->glMapBufferRange_mock
+#define glUnmapBuffer artist::mock::opengl::glFunctionMock::instance()->glUnmapBuffer_mock
+#define glFenceSync artist::mock::opengl::glFunctionMock::instance()->glFenceSync_mock
+#define glClientWaitSync artist::mock::opengl::glFunctionMock::instance()->glClientWaitSync_mock
+#define glDeleteSync artist::mock::opengl::glFunctionMock::instance()->glDeleteSync_mock
+#define glGenQueries artist::mock::opengl::glFunctionMock::instance()->glGenQueries_mock
+#define glDeleteQueries artist::mock::opengl::glFunctionMock::instance()->glDeleteQueries_mock
+#define glBeginQuery artist::mock::opengl::glFunctionMock::instance()->glBeginQuery_mock
+#define glEndQuery artist::mock::opengl::glFunctionMock::instance()->glEndQuery_mock
+#define glGetQueryObjectui64v artist::mock::opengl::glFunctionMock::instance()->glGetQueryObjectui64v_mock
+#define glGetQueryObjectuiv artist::mock::opengl::glFunctionMock::instance()->glGetQueryObjectuiv_mock
+#define glEnable artist::mock::opengl::glFunctionMock::instance()->glEnable_mock
+#define glDisable artist::mock::opengl::glFunctionMock::instance()->glDisable_mock
+#define glDrawArrays artist::mock::opengl::glFunctionMock::instance()->glDrawArrays_mock
 #define glIsProgram artist::mock::opengl::glFunctionMock::instance()->glIsProgram_mock
 #define glIsShader artist::mock::opengl::glFunctionMock::instance()->glIsShader_mock
 #define glLinkProgram artist::mock::opengl::glFunctionMock::instance()->glLinkProgram_mock
@@ -204,7 +229,32 @@ namespace artist::mock::opengl
         MOCK_METHOD(void, glGenBuffers_mock, (GLsizei, GLuint *), ());
         MOCK_METHOD(void, glBindBuffer_mock, (GLenum, GLuint), ());
         MOCK_METHOD(void, glBufferData_mock, (GLenum, GLsizeiptr, const GLvoid *, GLenum), ());
+        MOCK_METHOD(void, glBufferSubData_mock, (GLenum, GLintptr, GLsizeiptr, const GLvoid *), ());
         MOCK_METHOD(void, glVertexAttribPointer_mock, (GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid *), ());
+        MOCK_METHOD(void, glVertexAttribIPointer_mock, (GLuint, GLint, GLenum, GLsizei, const GLvoid *), ());
+        MOCK_METHOD(void, glVertexAttribLPointer_mock, (GLuint, GLint, GLenum, GLsizei, const GLvoid *), ());
+        MOCK_METHOD(void, glGenVertexArrays_mock, (GLsizei, GLuint *), ());
+        MOCK_METHOD(void, glBindVertexArray_mock, (GLuint), ());
+        MOCK_METHOD(void, glDeleteVertexArrays_mock, (GLsizei, const GLuint *), ());
+        MOCK_METHOD(void, glDeleteBuffers_mock, (GLsizei, const GLuint *), ());
+        MOCK_METHOD(void, glDrawElements_mock, (GLenum, GLsizei, GLenum, const void *), ());
+        MOCK_METHOD(void, glMultiDrawElementsIndirect_mock, (GLenum, GLenum, const void *, GLsizei, GLsizei), ());
+        MOCK_METHOD(void, glCopyBufferSubData_mock, (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr), ());
+        MOCK_METHOD(void, glBufferStorage_mock, (GLenum, GLsizeiptr, const void *, GLbitfield), ());
+        MOCK_METHOD(void *, glMapBufferRange_mock, (GLenum, GLintptr, GLsizeiptr, GLbitfield), ());
+        MOCK_METHOD(GLboolean, glUnmapBuffer_mock, (GLenum), ());
+        MOCK_METHOD(GLsync, glFenceSync_mock, (GLenum, GLbitfield), ());
+        MOCK_METHOD(GLenum, glClientWaitSync_mock, (GLsync, GLbitfield, GLuint64), ());
+        MOCK_METHOD(void, glDeleteSync_mock, (GLsync), ());
+        MOCK_METHOD(void, glGenQueries_mock, (GLsizei, GLuint *), ());
+        MOCK_METHOD(void, glDeleteQueries_mock, (GLsizei, const GLuint *), ());
+        MOCK_METHOD(void, glBeginQuery_mock, (GLenum, GLuint), ());
+        MOCK_METHOD(void, glEndQuery_mock, (GLenum), ());
+        MOCK_METHOD(void, glGetQueryObjectui64v_mock, (GLuint, GLenum, GLuint64 *), ());
+        MOCK_METHOD(void, glGetQueryObjectuiv_mock, (GLuint, GLenum, GLuint *), ());
+        MOCK_METHOD(void, glEnable_mock, (GLenum), ());
+        MOCK_METHOD(void, glDisable_mock, (GLenum), ());
+        MOCK_METHOD(void, glDrawArrays_mock, (GLenum, GLint, GLsizei), ());
         MOCK_METHOD(GLboolean, glIsProgram_mock, (GLuint), ());
         MOCK_METHOD(GLboolean, glIsShader_mock, (GLuint), ());
         MOCK_METHOD(void, glLinkProgram_mock, (GLuint), ());
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include <common/algorithm/RadixSort.hpp>
+
+using artist::common::algorithm::radixSort;
+
+namespace
+{
+    using Item = std::pair<std::uint64_t, int>;
+
+    std::uint64_t keyOf(const Item &item)
+    {
+        return item.first;
+    }
+}
+
+TEST(RadixSortTests, MatchStableSort)
+{
+    // Arrange
+    std::mt19937_64 random(7);
+    std::vector<Item> items;
+    for (int i = 0; i < 5000; ++i)
+    {
+        items.emplace_back(random() % 64 << (random() % 58), i); // Duplicated keys spread over every byte
+    }
+    std::vector<Item> expected = items;
+    std::ranges::stable_sort(expected, {}, &Item::first);
+
+    // Act
+    radixSort(items, keyOf);
+
+    // Assert
+    ASSERT_EQ(items, expected);
+}
+
+TEST(RadixSortTests, SortKeysDifferingInOneByte)
+{
+    // Arrange
+    std::vector<Item> items{{0x500, 0}, {0x100, 1}, {0x300, 2}, {0x100, 3}};
+
+    // Act
+    radixSort(items, keyOf);
+
+    // Assert
+    ASSERT_EQ(items, (std::vector<Item>{{0x100, 1}, {0x100, 3}, {0x300, 2}, {0x500, 0}}));
+}
+
+TEST(RadixSortTests, ReuseScratchBuffer)
+{
+    // Arrange
+    std::vector<Item> items{{3, 0}, {1, 1}, {2, 2}};
+    std::vector<Item> scratch(8);
+
+    // Act
+    radixSort(std::span<Item>(items), std::span<Item>(scratch), keyOf);
+
+    // Assert
+    ASSERT_EQ(items, (std::vector<Item>{{1, 1}, {2, 2}, {3, 0}}));
+}
+
+TEST(RadixSortTests, LeaveShortInputUntouched)
+{
+    // Arrange
+    std::vector<Item> empty;
+    std::vector<Item> single{{42, 0}};
+
+    // Act
+    radixSort(empty, keyOf);
+    radixSort(single, keyOf);
+
+    // Assert
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(single, (std::vector<Item>{{42, 0}}));
+}
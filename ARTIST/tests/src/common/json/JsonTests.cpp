@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <common/json/Json.hpp>
+#include <TestUtils.hpp>
+
+namespace json = artist::common::json;
+using artist::test::utils::expectSpecificError;
+
+TEST(JsonTests, ParseNestedDocument)
+{
+    // Act
+    json::Value document = json::parse(R"({"asset": {"version": "2.0"}, "counts": [1, 2.5, -3e2], "flag": true, "none": null})");
+
+    // Assert
+    ASSERT_EQ(document.at("asset").getString("version", ""), "2.0");
+    ASSERT_EQ(document.at("counts").getArray().size(), 3);
+    ASSERT_EQ(document.at("counts").at(1).getNumber(), 2.5);
+    ASSERT_EQ(document.at("counts").at(2).getNumber(), -300.0);
+    ASSERT_TRUE(document.at("flag").getBool());
+    ASSERT_TRUE(document.at("none").isNull());
+}
+
+TEST(JsonTests, ParseStringEscapes)
+{
+    // Act
+    json::Value value = json::parse(R"("a\"b\\c\né😀")");
+
+    // Assert
+    ASSERT_EQ(value.getString(), "a\"b\\c\n\xc3\xa9\xf0\x9f\x98\x80");
+}
+
+TEST(JsonTests, ParseSurrogatePairs)
+{
+    // Act
+    json::Value value = json::parse(R"("\ud83d\ude00")");
+
+    // Assert
+    ASSERT_EQ(value.getString(), "\xf0\x9f\x98\x80");
+    expectSpecificError([]()
+                        { json::parse(R"("\ud83d\u0041")"); },
+                        std::runtime_error("ERROR::JSON::PARSE_FAILED: invalid low surrogate"));
+}
+
+TEST(JsonTests, DefaultsForMissingMembers)
+{
+    // Arrange
+    json::Value object = json::parse(R"({"byteOffset": 16})");
+
+    // Assert
+    ASSERT_EQ(object.getNumber("byteOffset", 0), 16);
+    ASSERT_EQ(object.getNumber("byteStride", 12), 12);
+    ASSERT_FALSE(object.getBool("normalized", false));
+    ASSERT_EQ(object.find("missing"), nullptr);
+}
+
+TEST(JsonTests, ThrowOnMissingMember)
+{
+    // Arrange
+    json::Value object = json::parse("{}");
+
+    // Act & Assert
+    expectSpecificError([&object]()
+                        { (void)object.at("accessors"); },
+                        std::runtime_error("ERROR::JSON::MISSING_MEMBER"));
+}
+
+TEST(JsonTests, ThrowOnTypeMismatch)
+{
+    // Arrange
+    json::Value value = json::parse("[1]");
+
+    // Act & Assert
+    expectSpecificError([&value]()
+                        { (void)value.getString(); },
+                        std::runtime_error("ERROR::JSON::TYPE_MISMATCH"));
+}
+
+TEST(JsonTests, ThrowOnInvalidText)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { json::parse(R"({"a": [1, 2})"); },
+                        std::runtime_error("ERROR::JSON::PARSE_FAILED"));
+    expectSpecificError([]()
+                        { json::parse("{} x"); },
+                        std::runtime_error("ERROR::JSON::PARSE_FAILED"));
+    expectSpecificError([]()
+                        { json::parse(std::string(1000, '[')); },
+                        std::runtime_error("ERROR::JSON::PARSE_FAILED"));
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <common/memory/HandlePool.hpp>
+
+using artist::common::memory::Handle;
+using artist::common::memory::HandlePool;
+
+struct ItemTag;
+using ItemPool = HandlePool<ItemTag, int, std::string>;
+
+TEST(HandlePoolTests, CreateAndGet)
+{
+    // Arrange
+    ItemPool pool;
+
+    // Act
+    auto first = pool.create(1, "one");
+    auto second = pool.create(2, "two");
+
+    // Assert
+    ASSERT_EQ(pool.size(), 2);
+    ASSERT_EQ(pool.get<0>(first), 1);
+    ASSERT_EQ(pool.get<1>(second), "two");
+    ASSERT_TRUE(pool.isValid(first));
+    ASSERT_FALSE(pool.isValid(Handle<ItemTag>{}));
+}
+
+TEST(HandlePoolTests, InvalidateHandleOnDestroy)
+{
+    // Arrange
+    ItemPool pool;
+    auto handle = pool.create(1, "one");
+
+    // Act
+    bool destroyed = pool.destroy(handle);
+
+    // Assert
+    ASSERT_TRUE(destroyed);
+    ASSERT_FALSE(pool.isValid(handle));
+    ASSERT_FALSE(pool.destroy(handle));
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(HandlePoolTests, ReuseSlotWithNewGeneration)
+{
+    // Arrange
+    ItemPool pool;
+    auto stale = pool.create(1, "one");
+    pool.destroy(stale);
+
+    // Act
+    auto handle = pool.create(2, "two");
+
+    // Assert
+    ASSERT_EQ(handle.index, stale.index);
+    ASSERT_NE(handle.generation, stale.generation);
+    ASSERT_FALSE(pool.isValid(stale));
+    ASSERT_EQ(pool.get<0>(handle), 2);
+}
+
+TEST(HandlePoolTests, KeepColumnsDenseOnDestroy)
+{
+    // Arrange
+    ItemPool pool;
+    auto first = pool.create(1, "one");
+    auto second = pool.create(2, "two");
+    auto third = pool.create(3, "three");
+
+    // Act
+    pool.destroy(first);
+
+    // Assert
+    ASSERT_EQ(std::vector<int>(pool.column<0>().begin(), pool.column<0>().end()), (std::vector<int>{3, 2}));
+    ASSERT_EQ(pool.getHandle(0), third);
+    ASSERT_EQ(pool.getHandle(1), second);
+    ASSERT_EQ(pool.get<1>(third), "three");
+}
+
+TEST(HandlePoolTests, ThrowOnStaleHandle)
+{
+    // Arrange
+    ItemPool pool;
+    auto handle = pool.create(1, "one");
+    pool.destroy(handle);
+
+    // Act & Assert
+    ASSERT_THROW(static_cast<void>(pool.get<0>(handle)), std::out_of_range);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <common/memory/OffsetAllocator.hpp>
+
+using artist::common::memory::OffsetAllocator;
+
+TEST(OffsetAllocatorTests, AllocateBackToBack)
+{
+    // Arrange
+    OffsetAllocator allocator(1024);
+
+    // Act
+    auto first = allocator.allocate(100);
+    auto second = allocator.allocate(200);
+
+    // Assert
+    ASSERT_EQ(first, 0);
+    ASSERT_EQ(second, 100);
+    ASSERT_EQ(allocator.getFreeSize(), 724);
+}
+
+TEST(OffsetAllocatorTests, ReturnNulloptWhenFull)
+{
+    // Arrange
+    OffsetAllocator allocator(256);
+    allocator.allocate(200);
+
+    // Act & Assert
+    ASSERT_FALSE(allocator.allocate(100).has_value());
+    ASSERT_FALSE(allocator.allocate(0).has_value());
+}
+
+TEST(OffsetAllocatorTests, ReuseBestFittingHole)
+{
+    // Arrange
+    OffsetAllocator allocator(1024);
+    auto a = allocator.allocate(64);
+    allocator.allocate(16);
+    auto b = allocator.allocate(32);
+    allocator.allocate(16);
+    allocator.free(*a, 64);
+    allocator.free(*b, 32);
+
+    // Act
+    auto c = allocator.allocate(24);
+
+    // Assert: the 32 bytes hole fits better than the 64 bytes one or the tail
+    ASSERT_EQ(c, b);
+}
+
+TEST(OffsetAllocatorTests, MergeFreedNeighbours)
+{
+    // Arrange
+    OffsetAllocator allocator(300);
+    auto a = allocator.allocate(100);
+    auto b = allocator.allocate(100);
+    auto c = allocator.allocate(100);
+
+    // Act
+    allocator.free(*a, 100);
+    allocator.free(*c, 100);
+    ASSERT_EQ(allocator.getFreeBlockCount(), 2);
+    allocator.free(*b, 100);
+
+    // Assert
+    ASSERT_EQ(allocator.getFreeBlockCount(), 1);
+    ASSERT_EQ(allocator.allocate(300), 0);
+}
+
+TEST(OffsetAllocatorTests, ResetReleaseEverything)
+{
+    // Arrange
+    OffsetAllocator allocator(128);
+    allocator.allocate(64);
+    allocator.allocate(64);
+
+    // Act
+    allocator.reset();
+
+    // Assert
+    ASSERT_EQ(allocator.getFreeSize(), 128);
+    ASSERT_EQ(allocator.allocate(128), 0);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <common/thread/MpscQueue.hpp>
+#include <TestUtils.hpp>
+
+using artist::common::thread::MpscQueue;
+using artist::test::utils::expectSpecificError;
+
+TEST(MpscQueueTests, PopInPushOrder)
+{
+    // Arrange
+    MpscQueue<int> queue(4);
+    int value = 0;
+
+    // Act
+    const bool pushed = queue.tryPush(1) && queue.tryPush(2) && queue.tryPush(3);
+
+    // Assert
+    ASSERT_TRUE(pushed);
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_FALSE(queue.tryPop(value));
+}
+
+TEST(MpscQueueTests, RejectPushWhenFull)
+{
+    // Arrange
+    MpscQueue<int> queue(2);
+    int value = 0;
+    queue.tryPush(1);
+    queue.tryPush(2);
+
+    // Act
+    const bool pushedWhenFull = queue.tryPush(3);
+    queue.tryPop(value);
+    const bool pushedAfterPop = queue.tryPush(3);
+
+    // Assert
+    ASSERT_FALSE(pushedWhenFull);
+    ASSERT_TRUE(pushedAfterPop);
+}
+
+TEST(MpscQueueTests, KeepOrderOfEachProducer)
+{
+    // Arrange
+    constexpr std::size_t PRODUCERS = 4;
+    constexpr std::size_t ITEMS = 10'000;
+    MpscQueue<std::size_t> queue(64);
+    std::vector<std::size_t> next(PRODUCERS, 0);
+    std::vector<std::jthread> producers;
+
+    // Act
+    for (std::size_t producer = 0; producer < PRODUCERS; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+                               {
+                                   for (std::size_t i = 0; i < ITEMS; ++i)
+                                   {
+                                       while (!queue.tryPush(producer * ITEMS + i))
+                                       {
+                                           std::this_thread::yield();
+                                       }
+                                   } });
+    }
+    bool ordered = true;
+    for (std::size_t received = 0, value = 0; received < PRODUCERS * ITEMS;)
+    {
+        if (!queue.tryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && value % ITEMS == next[value / ITEMS]++;
+        ++received;
+    }
+
+    // Assert
+    ASSERT_TRUE(ordered);
+    for (std::size_t count : next)
+    {
+        ASSERT_EQ(count, ITEMS);
+    }
+}
+
+TEST(MpscQueueTests, ThrowOnCapacityNotPowerOfTwo)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { MpscQueue<int> queue(3); },
+                        std::invalid_argument("ERROR::MPSC_QUEUE::INVALID_CAPACITY: 3 is not a power of two"));
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <common/thread/ThreadPool.hpp>
+#include <TestUtils.hpp>
+
+using artist::common::thread::ThreadPool;
+using artist::test::utils::expectSpecificError;
+
+TEST(ThreadPoolTests, SubmitReturnResult)
+{
+    // Arrange
+    ThreadPool pool(2);
+
+    // Act
+    auto result = pool.submit([]()
+                              { return 42; });
+
+    // Assert
+    ASSERT_EQ(result.get(), 42);
+}
+
+TEST(ThreadPoolTests, ParallelForCoverEveryItemOnce)
+{
+    // Arrange
+    ThreadPool pool(4);
+    std::vector<int> visits(10'000, 0);
+
+    // Act
+    pool.parallelFor(visits.size(), 64, [&visits](std::size_t first, std::size_t last)
+                     {
+                         for (std::size_t i = first; i < last; ++i)
+                         {
+                             ++visits[i];
+                         } });
+
+    // Assert
+    ASSERT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 10'000);
+    ASSERT_EQ(*std::ranges::min_element(visits), 1);
+}
+
+TEST(ThreadPoolTests, ParallelForNestedInTasks)
+{
+    // Arrange
+    ThreadPool pool(1);
+    std::atomic<std::size_t> count = 0;
+
+    // Act
+    auto outer = pool.submit([&pool, &count]()
+                             { pool.parallelFor(100, 10, [&count](std::size_t first, std::size_t last)
+                                                { count += last - first; }); });
+    outer.get();
+
+    // Assert
+    ASSERT_EQ(count, 100);
+}
+
+TEST(ThreadPoolTests, ParallelForRethrow)
+{
+    // Arrange
+    ThreadPool pool(2);
+
+    // Act & Assert
+    expectSpecificError([&pool]()
+                        { pool.parallelFor(100, 10, [](std::size_t first, std::size_t)
+                                           {
+                                               if (first == 50)
+                                               {
+                                                   throw std::runtime_error("ERROR::TEST::CHUNK_FAILED");
+                                               } }); },
+                        std::runtime_error("ERROR::TEST::CHUNK_FAILED"));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <graphic/context/DirtyRanges.hpp>
+
+using artist::graphic::context::DirtyRange;
+using artist::graphic::context::DirtyRanges;
+
+TEST(DirtyRangesTests, MarkDisjointRangesKeepSorted)
+{
+    // Arrange
+    DirtyRanges ranges;
+
+    // Act
+    ranges.mark(40, 8);
+    ranges.mark(0, 4);
+
+    // Assert
+    ASSERT_EQ(ranges.getRanges(), (std::vector<DirtyRange>{{0, 4}, {40, 8}}));
+}
+
+TEST(DirtyRangesTests, MergeOverlappingAndAdjacentRanges)
+{
+    // Arrange
+    DirtyRanges ranges;
+    ranges.mark(0, 4);
+    ranges.mark(8, 4);
+    ranges.mark(20, 4);
+
+    // Act
+    ranges.mark(4, 4);  // Adjacent to both [0, 4) and [8, 12)
+    ranges.mark(18, 4); // Overlaps [20, 24)
+
+    // Assert
+    ASSERT_EQ(ranges.getRanges(), (std::vector<DirtyRange>{{0, 12}, {18, 6}}));
+}
+
+TEST(DirtyRangesTests, MergeRangeSpanningSeveralRanges)
+{
+    // Arrange
+    DirtyRanges ranges;
+    ranges.mark(4, 2);
+    ranges.mark(10, 2);
+    ranges.mark(16, 2);
+
+    // Act
+    ranges.mark(0, 32);
+
+    // Assert
+    ASSERT_EQ(ranges.getRanges(), (std::vector<DirtyRange>{{0, 32}}));
+    ASSERT_TRUE(ranges.covers(32));
+    ASSERT_FALSE(ranges.covers(33));
+}
+
+TEST(DirtyRangesTests, IgnoreEmptyRange)
+{
+    // Arrange
+    DirtyRanges ranges;
+
+    // Act
+    ranges.mark(12, 0);
+
+    // Assert
+    ASSERT_TRUE(ranges.empty());
+}
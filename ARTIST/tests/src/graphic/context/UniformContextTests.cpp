@@ -0,0 +1,74 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/Api.hpp>
+#include <graphic/opengl/context/UniformContext.hpp>
+#include <graphic/opengl/pipeline/component/uniform/Setter.hpp>
+#include <common/exception/TraceableException.hpp>
+#include <TestUtils.hpp>
+
+namespace api = artist::graphic::api;
+
+using artist::test::utils::expectSpecificError;
+
+TEST(UniformContextTests, SetValue_StoreValueInline)
+{
+    // Arrange
+    api::OpenGL::UniformContext uniform;
+
+    // Act
+    uniform.setValue(3.5f);
+
+    // Assert
+    ASSERT_TRUE(uniform.hasValue());
+    ASSERT_EQ(uniform.getValue<float>(), 3.5f);
+}
+
+TEST(UniformContextTests, SetValue_StoreLargestType)
+{
+    // Arrange
+    api::OpenGL::UniformContext uniform;
+    glm::dmat4 value(2.0);
+
+    // Act
+    uniform.setValue(value);
+    value = glm::dmat4(4.0);
+    uniform.setValue(value);
+
+    // Assert
+    static_assert(sizeof(glm::dmat4) <= api::OpenGL::UniformContext::STORAGE_SIZE);
+    const double *stored = glm::value_ptr(uniform.getValue<glm::dmat4>());
+    ASSERT_EQ(stored[0], 4.0);
+    ASSERT_EQ(stored[1], 0.0);
+    ASSERT_EQ(stored[15], 4.0);
+}
+
+TEST(UniformContextTests, SetValue_ThrowOnTypeMismatch)
+{
+    // Arrange
+    api::OpenGL::UniformContext uniform;
+    uniform.setValue(1);
+
+    // Act & Assert
+    expectSpecificError([&]()
+                        { uniform.setValue(1.0f); },
+                        std::runtime_error(std::format("ERROR::UNIFORM::SET::TYPE_MISMATCH: The type of the value ({}, 0x{:04X}) does not match the type of the uniform variable (0x{:04X})", typeid(float).name(), GL_FLOAT, GL_INT)));
+    ASSERT_EQ(uniform.getValue<int>(), 1);
+}
+
+TEST(UniformContextTests, GetValue_ThrowWhenNotSet)
+{
+    // Arrange
+    api::OpenGL::UniformContext uniform;
+
+    // Act & Assert
+    ASSERT_FALSE(uniform.hasValue());
+    expectSpecificError([&]()
+                        { uniform.getValue<float>(); },
+                        std::runtime_error(std::format("ERROR::UNIFORM::GET::TYPE_MISMATCH: The type of the value ({}, 0x{:04X}) does not match the type of the uniform variable (0x{:04X})", typeid(float).name(), GL_FLOAT, 0)));
+}
+
+#endif
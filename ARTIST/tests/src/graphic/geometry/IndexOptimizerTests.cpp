@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <graphic/geometry/IndexOptimizer.hpp>
+
+namespace geometry = artist::graphic::geometry;
+
+namespace
+{
+    // Triangles of a size x size grid of quads, in random order
+    std::vector<std::uint32_t> shuffledGrid(std::uint32_t size)
+    {
+        std::vector<std::array<std::uint32_t, 3>> triangles;
+        const std::uint32_t row = size + 1;
+        for (std::uint32_t y = 0; y < size; ++y)
+        {
+            for (std::uint32_t x = 0; x < size; ++x)
+            {
+                const std::uint32_t corner = y * row + x;
+                triangles.push_back({corner, corner + 1, corner + row});
+                triangles.push_back({corner + 1, corner + row + 1, corner + row});
+            }
+        }
+        std::mt19937 random(7);
+        std::ranges::shuffle(triangles, random);
+        std::vector<std::uint32_t> indices;
+        for (const auto &triangle : triangles)
+        {
+            indices.insert(indices.end(), triangle.begin(), triangle.end());
+        }
+        return indices;
+    }
+
+    // Triangles rotated to start with their smallest index, then sorted: equal for permutations of whole triangles
+    std::vector<std::array<std::uint32_t, 3>> canonicalTriangles(const std::vector<std::uint32_t> &indices)
+    {
+        std::vector<std::array<std::uint32_t, 3>> triangles;
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            std::array<std::uint32_t, 3> triangle{indices[i], indices[i + 1], indices[i + 2]};
+            std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+            triangles.push_back(triangle);
+        }
+        std::ranges::sort(triangles);
+        return triangles;
+    }
+}
+
+TEST(IndexOptimizerTests, AnalyzeVertexCache)
+{
+    // Arrange: two triangles sharing an edge
+    std::vector<std::uint32_t> indices{0, 1, 2, 2, 1, 3};
+
+    // Act & Assert
+    ASSERT_FLOAT_EQ(geometry::analyzeVertexCache(indices, 4, 16), 2.0f);
+    ASSERT_FLOAT_EQ(geometry::analyzeVertexCache(indices, 4, 1), 2.5f);
+}
+
+TEST(IndexOptimizerTests, OptimizeVertexCacheReducesMisses)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices = shuffledGrid(32);
+    const auto triangles = canonicalTriangles(indices);
+    const float before = geometry::analyzeVertexCache(indices, 33 * 33);
+
+    // Act
+    geometry::optimizeVertexCache(indices, 33 * 33);
+
+    // Assert
+    const float after = geometry::analyzeVertexCache(indices, 33 * 33);
+    ASSERT_EQ(canonicalTriangles(indices), triangles);
+    ASSERT_LT(after, 0.8f);
+    ASSERT_LT(after, before / 2.0f);
+}
+
+TEST(IndexOptimizerTests, OptimizeVertexCacheHandlesDegenerateTriangles)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices{0, 0, 1, 1, 2, 3, 3, 3, 3};
+    const auto triangles = canonicalTriangles(indices);
+
+    // Act
+    geometry::optimizeVertexCache(indices, 4);
+
+    // Assert
+    ASSERT_EQ(canonicalTriangles(indices), triangles);
+}
+
+TEST(IndexOptimizerTests, OptimizeVertexCacheRejectsInvalidIndices)
+{
+    // Arrange
+    std::vector<std::uint32_t> notTriangles{0, 1};
+    std::vector<std::uint32_t> outOfRange{0, 1, 4};
+
+    // Act & Assert
+    EXPECT_THROW(geometry::optimizeVertexCache(notTriangles, 4), std::runtime_error);
+    EXPECT_THROW(geometry::optimizeVertexCache(outOfRange, 4), std::out_of_range);
+}
+
+TEST(IndexOptimizerTests, OptimizeOverdrawDrawsOuterClustersFirst)
+{
+    // Arrange: two separate triangles facing +z, the inner one at z = -1, the outer one at z = 1
+    std::vector<float> positions{
+        0.0f, 0.0f, -1.0f, 1.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f,
+        0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f};
+    std::vector<std::uint32_t> indices{0, 1, 2, 3, 4, 5};
+
+    // Act
+    geometry::optimizeOverdraw(indices, positions);
+
+    // Assert
+    ASSERT_EQ(indices, (std::vector<std::uint32_t>{3, 4, 5, 0, 1, 2}));
+}
+
+TEST(IndexOptimizerTests, OptimizeOverdrawKeepsTriangles)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices = shuffledGrid(16);
+    std::vector<float> positions;
+    for (std::uint32_t y = 0; y <= 16; ++y)
+    {
+        for (std::uint32_t x = 0; x <= 16; ++x)
+        {
+            positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y), static_cast<float>((x * y) % 5)});
+        }
+    }
+    geometry::optimizeVertexCache(indices, 17 * 17);
+    const auto triangles = canonicalTriangles(indices);
+
+    // Act
+    geometry::optimizeOverdraw(indices, positions);
+
+    // Assert
+    ASSERT_EQ(canonicalTriangles(indices), triangles);
+}
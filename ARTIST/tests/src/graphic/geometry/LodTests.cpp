@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <graphic/geometry/Lod.hpp>
+#include <TestUtils.hpp>
+
+namespace geometry = artist::graphic::geometry;
+using artist::test::utils::expectSpecificError;
+
+namespace
+{
+    // size x size grid of quads over [0, size]^2, with heights from a function of x and y
+    template <typename Height>
+    void heightField(std::uint32_t size, Height height, std::vector<std::uint32_t> &indices, std::vector<float> &positions)
+    {
+        const std::uint32_t row = size + 1;
+        for (std::uint32_t y = 0; y <= size; ++y)
+        {
+            for (std::uint32_t x = 0; x <= size; ++x)
+            {
+                positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y), height(static_cast<float>(x), static_cast<float>(y))});
+            }
+        }
+        for (std::uint32_t y = 0; y < size; ++y)
+        {
+            for (std::uint32_t x = 0; x < size; ++x)
+            {
+                const std::uint32_t corner = y * row + x;
+                indices.insert(indices.end(), {corner, corner + 1, corner + row, corner + 1, corner + row + 1, corner + row});
+            }
+        }
+    }
+
+    float flat(float, float)
+    {
+        return 0.0f;
+    }
+
+    float bowl(float x, float y)
+    {
+        return 0.05f * ((x - 8.0f) * (x - 8.0f) + (y - 8.0f) * (y - 8.0f));
+    }
+
+    // Signed area of the triangles projected on the xy plane
+    float projectedArea(const std::vector<std::uint32_t> &indices, const std::vector<float> &positions)
+    {
+        float area = 0.0f;
+        for (std::size_t t = 0; t < indices.size(); t += 3)
+        {
+            const float *a = &positions[indices[t] * 3];
+            const float *b = &positions[indices[t + 1] * 3];
+            const float *c = &positions[indices[t + 2] * 3];
+            area += 0.5f * ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]));
+        }
+        return area;
+    }
+}
+
+TEST(LodTests, Simplify_CollapseFlatInteriorWithoutError)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    heightField(16, flat, indices, positions);
+
+    // Act
+    geometry::Simplification simplified = geometry::simplify(indices, positions, 0, 1e-3f);
+
+    // Assert
+    ASSERT_LT(simplified.indices.size(), indices.size() / 4);
+    ASSERT_NEAR(simplified.error, 0.0f, 1e-3f);
+    ASSERT_NEAR(projectedArea(simplified.indices, positions), 256.0f, 1e-3f);
+    const std::set<std::uint32_t> kept(simplified.indices.begin(), simplified.indices.end());
+    for (std::uint32_t i = 0; i <= 16; ++i)
+    {
+        // Border vertices are locked
+        ASSERT_TRUE(kept.contains(i));
+        ASSERT_TRUE(kept.contains(16 * 17 + i));
+        ASSERT_TRUE(kept.contains(i * 17));
+        ASSERT_TRUE(kept.contains(i * 17 + 16));
+    }
+}
+
+TEST(LodTests, Simplify_KeepCurvedSurfaceWithinErrorBudget)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    heightField(16, bowl, indices, positions);
+
+    // Act
+    geometry::Simplification strict = geometry::simplify(indices, positions, 0, 1e-4f);
+    geometry::Simplification loose = geometry::simplify(indices, positions, indices.size() / 2);
+
+    // Assert
+    ASSERT_EQ(strict.indices, indices);
+    ASSERT_EQ(strict.error, 0.0f);
+    ASSERT_LE(loose.indices.size(), indices.size() / 2);
+    ASSERT_GT(loose.error, 0.0f);
+    ASSERT_NEAR(projectedArea(loose.indices, positions), 256.0f, 1e-3f);
+}
+
+TEST(LodTests, BuildLodChain_ReduceLevelByLevel)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    heightField(16, bowl, indices, positions);
+
+    // Act
+    std::vector<geometry::LodLevel> chain = geometry::buildLodChain(indices, positions, 4, 0.5f);
+
+    // Assert
+    ASSERT_EQ(chain.size(), 4);
+    ASSERT_EQ(chain[0].indices, indices);
+    ASSERT_EQ(chain[0].error, 0.0f);
+    for (std::size_t level = 1; level < chain.size(); ++level)
+    {
+        ASSERT_LE(chain[level].indices.size(), chain[level - 1].indices.size() / 2);
+        ASSERT_GE(chain[level].error, chain[level - 1].error);
+    }
+}
+
+TEST(LodTests, BuildLodChain_StopWhenErrorBudgetIsSpent)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    heightField(16, bowl, indices, positions);
+
+    // Act
+    std::vector<geometry::LodLevel> chain = geometry::buildLodChain(indices, positions, 8, 0.5f, 1e-4f);
+
+    // Assert
+    ASSERT_EQ(chain.size(), 1);
+}
+
+TEST(LodTests, BuildLodChain_ThrowOnInvalidReduction)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices{0, 1, 2};
+    std::vector<float> positions(9, 0.0f);
+
+    // Act & Assert
+    expectSpecificError([&indices, &positions]()
+                        { geometry::buildLodChain(indices, positions, 4, 1.0f); },
+                        std::runtime_error("ERROR::GEOMETRY::INVALID_LOD_REDUCTION"));
+}
+
+TEST(LodTests, LodProjection_ProjectErrorInPixels)
+{
+    // Arrange
+    const geometry::LodProjection projection = geometry::LodProjection::perspective(std::acos(-1.0f) / 2.0f, 1000.0f);
+
+    // Assert
+    ASSERT_NEAR(projection.pixelScale, 500.0f, 1e-3f);
+    ASSERT_NEAR(projection.project(0.01f, 5.0f), 1.0f, 1e-5f);
+}
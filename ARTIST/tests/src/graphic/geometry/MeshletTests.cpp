@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <graphic/geometry/Meshlet.hpp>
+#include <TestUtils.hpp>
+
+namespace geometry = artist::graphic::geometry;
+using artist::test::utils::expectSpecificError;
+
+namespace
+{
+    // Flat size x size grid of quads in the z = 0 plane, facing +z
+    void flatGrid(std::uint32_t size, std::vector<std::uint32_t> &indices, std::vector<float> &positions)
+    {
+        const std::uint32_t row = size + 1;
+        for (std::uint32_t y = 0; y <= size; ++y)
+        {
+            for (std::uint32_t x = 0; x <= size; ++x)
+            {
+                positions.insert(positions.end(), {static_cast<float>(x), static_cast<float>(y), 0.0f});
+            }
+        }
+        for (std::uint32_t y = 0; y < size; ++y)
+        {
+            for (std::uint32_t x = 0; x < size; ++x)
+            {
+                const std::uint32_t corner = y * row + x;
+                indices.insert(indices.end(), {corner, corner + 1, corner + row, corner + 1, corner + row + 1, corner + row});
+            }
+        }
+    }
+
+    // Orthographic projection of the [-extent, extent] cube, moved by shift along x
+    geometry::Frustum box(float extent, float shift = 0.0f)
+    {
+        std::array<float, 16> matrix{};
+        matrix[0] = matrix[5] = matrix[10] = 1.0f / extent;
+        matrix[12] = -shift / extent;
+        matrix[15] = 1.0f;
+        return geometry::Frustum::fromMatrix(matrix);
+    }
+}
+
+TEST(MeshletTests, BuildMeshlets_RespectLimits)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    flatGrid(16, indices, positions);
+
+    // Act
+    geometry::MeshletSet set = geometry::buildMeshlets(indices, positions, 32, 40);
+
+    // Assert
+    ASSERT_GT(set.meshlets.size(), 1);
+    ASSERT_EQ(set.indices, indices);
+    std::uint32_t next = 0;
+    for (const geometry::Meshlet &meshlet : set.meshlets)
+    {
+        ASSERT_EQ(meshlet.firstIndex, next);
+        ASSERT_LE(meshlet.vertexCount, 32);
+        ASSERT_LE(meshlet.indexCount / 3, 40);
+        next += meshlet.indexCount;
+    }
+    ASSERT_EQ(next, indices.size());
+}
+
+TEST(MeshletTests, BuildMeshlets_SphereContainsTriangles)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    flatGrid(8, indices, positions);
+
+    // Act
+    geometry::MeshletSet set = geometry::buildMeshlets(indices, positions, 16, 16);
+
+    // Assert
+    for (const geometry::Meshlet &meshlet : set.meshlets)
+    {
+        for (std::uint32_t i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; ++i)
+        {
+            const float dx = positions[set.indices[i] * 3] - meshlet.center[0];
+            const float dy = positions[set.indices[i] * 3 + 1] - meshlet.center[1];
+            const float dz = positions[set.indices[i] * 3 + 2] - meshlet.center[2];
+            ASSERT_LE(std::sqrt(dx * dx + dy * dy + dz * dz), meshlet.radius + 1e-5f);
+        }
+    }
+}
+
+TEST(MeshletTests, BuildMeshlets_FlatClusterConeFacesNormal)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    flatGrid(4, indices, positions);
+
+    // Act
+    geometry::MeshletSet set = geometry::buildMeshlets(indices, positions);
+
+    // Assert
+    ASSERT_EQ(set.meshlets.size(), 1);
+    ASSERT_NEAR(set.meshlets[0].coneAxis[2], 1.0f, 1e-6f);
+    ASSERT_NEAR(set.meshlets[0].coneCutoff, 0.0f, 1e-3f);
+}
+
+TEST(MeshletTests, IsMeshletVisible_CullBackFacingAndOutside)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices;
+    std::vector<float> positions;
+    flatGrid(4, indices, positions);
+    const geometry::Meshlet meshlet = geometry::buildMeshlets(indices, positions).meshlets[0];
+
+    // Assert
+    ASSERT_TRUE(geometry::isMeshletVisible(meshlet, box(100.0f), {2.0f, 2.0f, 10.0f}));
+    ASSERT_FALSE(geometry::isMeshletVisible(meshlet, box(100.0f), {2.0f, 2.0f, -10.0f}));
+    ASSERT_FALSE(geometry::isMeshletVisible(meshlet, box(10.0f, 50.0f), {2.0f, 2.0f, 10.0f}));
+}
+
+TEST(MeshletTests, BuildMeshlets_ThrowOnInvalidLimits)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices{0, 1, 2};
+    std::vector<float> positions(9, 0.0f);
+
+    // Act & Assert
+    expectSpecificError([&indices, &positions]()
+                        { geometry::buildMeshlets(indices, positions, 2, 10); },
+                        std::runtime_error("ERROR::GEOMETRY::INVALID_MESHLET_LIMITS"));
+}
@@ -0,0 +1,176 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/buffer/BufferArena.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+
+namespace mock = artist::mock;
+using artist::graphic::opengl::buffer::BufferArena;
+using artist::graphic::opengl::buffer::BufferNames;
+
+class BufferArenaTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault([lastBuffer = GLuint{0}](GLsizei, GLuint *buffer) mutable
+                           { *buffer = ++lastBuffer; });
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+};
+
+TEST_F(BufferArenaTests, Allocate_ShareOnePage)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_COPY_WRITE_BUFFER, 1024, nullptr, GL_STATIC_DRAW)).Times(1);
+
+    // Act
+    auto first = arena.allocate(12);
+    auto second = arena.allocate(40);
+
+    // Assert
+    ASSERT_EQ(first->bufferId, second->bufferId);
+    ASSERT_EQ(first->offset, 0);
+    ASSERT_EQ(first->size, 12);
+    ASSERT_EQ(second->offset, 16);
+    ASSERT_EQ(arena.getPageCount(), 1);
+}
+
+TEST_F(BufferArenaTests, Allocate_OpenNewPageWhenFull)
+{
+    // Arrange
+    BufferArena arena(64, 16);
+    auto first = arena.allocate(64);
+
+    // Act
+    auto second = arena.allocate(16);
+    auto large = arena.allocate(256);
+
+    // Assert
+    ASSERT_NE(first->bufferId, second->bufferId);
+    ASSERT_NE(second->bufferId, large->bufferId);
+    ASSERT_EQ(arena.getPageCount(), 3);
+}
+
+TEST_F(BufferArenaTests, Free_ReuseRange)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    auto first = arena.allocate(32);
+    arena.allocate(32);
+
+    // Act
+    arena.free(first);
+    auto reused = arena.allocate(16);
+
+    // Assert
+    ASSERT_EQ(first->bufferId, 0);
+    ASSERT_EQ(reused->offset, 0);
+    ASSERT_EQ(arena.getAllocationCount(), 2);
+    ASSERT_THROW(arena.free(first), std::runtime_error);
+}
+
+TEST_F(BufferArenaTests, Compact_PackLiveAllocations)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    auto a = arena.allocate(32);
+    auto b = arena.allocate(32);
+    auto c = arena.allocate(32);
+    arena.free(b);
+    GLuint oldBuffer = a->bufferId;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, 32)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 64, 32, 32)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(oldBuffer))).Times(1);
+
+    // Act
+    std::size_t relocated = arena.compact();
+
+    // Assert
+    ASSERT_EQ(relocated, 2);
+    ASSERT_NE(a->bufferId, oldBuffer);
+    ASSERT_EQ(a->bufferId, c->bufferId);
+    ASSERT_EQ(c->offset, 32);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+}
+
+TEST_F(BufferArenaTests, Compact_ReleaseEmptyPages)
+{
+    // Arrange
+    BufferArena arena(64, 16);
+    arena.allocate(64);
+    auto second = arena.allocate(64);
+    GLuint secondBuffer = second->bufferId;
+    arena.free(second);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(secondBuffer))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock).Times(0);
+
+    // Act
+    arena.compact();
+
+    // Assert
+    ASSERT_EQ(arena.getPageCount(), 1);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+}
+
+TEST_F(BufferArenaTests, Compact_LogReleaseOfRepackedPage)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    auto a = arena.allocate(32);
+    auto b = arena.allocate(32);
+    arena.allocate(32);
+    arena.free(a);
+    GLuint oldBuffer = b->bufferId;
+    const auto epoch = BufferNames::getEpoch();
+
+    // Act
+    arena.compact();
+
+    // Assert
+    auto released = BufferNames::getReleasedSince(epoch);
+    ASSERT_TRUE(released.has_value());
+    ASSERT_EQ(released->size(), 1);
+    ASSERT_EQ(released->front(), oldBuffer);
+}
+
+TEST_F(BufferArenaTests, Free_FindRelocatedAllocation)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    auto a = arena.allocate(32);
+    auto b = arena.allocate(32);
+    auto c = arena.allocate(32);
+    arena.free(a);
+    arena.compact();
+    BufferArena other(1024, 16);
+    auto foreign = other.allocate(32);
+    foreign->bufferId = c->bufferId;
+
+    // Act
+    arena.free(c);
+
+    // Assert
+    ASSERT_EQ(c->bufferId, 0);
+    ASSERT_EQ(arena.getAllocationCount(), 1);
+    ASSERT_EQ(b->offset, 0);
+    ASSERT_THROW(arena.free(foreign), std::runtime_error);
+}
+
+#endif
@@ -0,0 +1,142 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/buffer/ClusterBuffer.hpp>
+
+namespace mock = artist::mock;
+namespace geometry = artist::graphic::geometry;
+using artist::graphic::opengl::buffer::ClusterBuffer;
+using artist::graphic::opengl::buffer::DrawElementsIndirectCommand;
+
+class ClusterBufferTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(9));
+
+        // Flat 8x8 grid of quads in the z = 0 plane, facing +z
+        for (std::uint32_t y = 0; y <= 8; ++y)
+        {
+            for (std::uint32_t x = 0; x <= 8; ++x)
+            {
+                m_positions.insert(m_positions.end(), {static_cast<float>(x), static_cast<float>(y), 0.0f});
+            }
+        }
+        for (std::uint32_t y = 0; y < 8; ++y)
+        {
+            for (std::uint32_t x = 0; x < 8; ++x)
+            {
+                const std::uint32_t corner = y * 9 + x;
+                m_indices.insert(m_indices.end(), {corner, corner + 1, corner + 9, corner + 1, corner + 10, corner + 9});
+            }
+        }
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    // Orthographic projection of the [low, high] range along y, across the rows of the grid, and [-100, 100] along x and z
+    static geometry::Frustum slab(float low, float high)
+    {
+        std::array<float, 16> matrix{};
+        matrix[5] = 2.0f / (high - low);
+        matrix[13] = -(high + low) / (high - low);
+        matrix[0] = matrix[10] = 0.01f;
+        matrix[15] = 1.0f;
+        return geometry::Frustum::fromMatrix(matrix);
+    }
+
+    std::vector<std::uint32_t> m_indices;
+    std::vector<float> m_positions;
+};
+
+TEST_F(ClusterBufferTests, Cull_MergeConsecutiveVisibleMeshlets)
+{
+    // Arrange
+    ClusterBuffer clusters;
+    clusters.set(geometry::buildMeshlets(m_indices, m_positions, 16, 16), 81);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_DRAW_INDIRECT_BUFFER, 9)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_DRAW_INDIRECT_BUFFER, sizeof(DrawElementsIndirectCommand), ::testing::_, GL_STREAM_DRAW)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_DRAW_INDIRECT_BUFFER, 0)).Times(1);
+
+    // Act
+    std::size_t visible = clusters.cull(slab(-100.0f, 100.0f), {4.0f, 4.0f, 10.0f});
+
+    // Assert
+    ASSERT_GT(clusters.getMeshlets().size(), 1);
+    ASSERT_EQ(visible, clusters.getMeshlets().size());
+    ASSERT_EQ(clusters.getCommands().size(), 1);
+    ASSERT_EQ(clusters.getCommands()[0].count, m_indices.size());
+    ASSERT_EQ(clusters.getCommands()[0].firstIndex, 0);
+    ASSERT_EQ(clusters.getCommands()[0].instanceCount, 1);
+}
+
+TEST_F(ClusterBufferTests, Cull_SkipMeshletsOutsideFrustum)
+{
+    // Arrange
+    ClusterBuffer clusters;
+    clusters.set(geometry::buildMeshlets(m_indices, m_positions, 16, 16), 81);
+
+    // Act
+    std::size_t visible = clusters.cull(slab(-10.0f, 2.5f), {4.0f, 4.0f, 10.0f});
+
+    // Assert
+    ASSERT_GT(visible, 0);
+    ASSERT_LT(visible, clusters.getMeshlets().size());
+    std::uint32_t expectedCount = 0;
+    for (const geometry::Meshlet &meshlet : clusters.getMeshlets())
+    {
+        expectedCount += geometry::isMeshletVisible(meshlet, slab(-10.0f, 2.5f), {4.0f, 4.0f, 10.0f}) ? meshlet.indexCount : 0;
+    }
+    std::uint32_t count = 0;
+    for (const DrawElementsIndirectCommand &command : clusters.getCommands())
+    {
+        count += command.count;
+    }
+    ASSERT_EQ(count, expectedCount);
+}
+
+TEST_F(ClusterBufferTests, Draw_IssueOneMultiDraw)
+{
+    // Arrange
+    ClusterBuffer clusters;
+    clusters.set(geometry::buildMeshlets(m_indices, m_positions, 16, 16), 81);
+    clusters.cull(slab(-100.0f, 100.0f), {4.0f, 4.0f, 10.0f});
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glMultiDrawElementsIndirect_mock(GL_TRIANGLES, GL_UNSIGNED_SHORT, nullptr, 1, 0)).Times(1);
+
+    // Act
+    clusters.draw();
+}
+
+TEST_F(ClusterBufferTests, Draw_SkipWhenBackFacing)
+{
+    // Arrange
+    ClusterBuffer clusters;
+    clusters.set(geometry::buildMeshlets(m_indices, m_positions, 16, 16), 81);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glMultiDrawElementsIndirect_mock(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
+
+    // Act
+    std::size_t visible = clusters.cull(slab(-100.0f, 100.0f), {4.0f, 4.0f, -10.0f});
+    clusters.draw();
+
+    // Assert
+    ASSERT_EQ(visible, 0);
+    ASSERT_TRUE(clusters.getCommands().empty());
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,109 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/buffer/IndexBuffer.hpp>
+
+namespace mock = artist::mock;
+using artist::graphic::opengl::buffer::BufferAllocation;
+using artist::graphic::opengl::buffer::IndexBuffer;
+
+class IndexBufferTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(9));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+};
+
+TEST_F(IndexBufferTests, SelectIndexType)
+{
+    ASSERT_EQ(IndexBuffer::selectIndexType(3), GL_UNSIGNED_SHORT);
+    ASSERT_EQ(IndexBuffer::selectIndexType(65536), GL_UNSIGNED_SHORT);
+    ASSERT_EQ(IndexBuffer::selectIndexType(65537), GL_UNSIGNED_INT);
+}
+
+TEST_F(IndexBufferTests, Set_Upload16BitIndices)
+{
+    // Arrange
+    IndexBuffer indexBuffer;
+    std::vector<std::uint32_t> indices{0, 1, 2, 2, 1, 3};
+    std::vector<std::uint16_t> uploaded;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_COPY_WRITE_BUFFER, 9)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_COPY_WRITE_BUFFER, 0)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_COPY_WRITE_BUFFER, 12, ::testing::_, GL_STATIC_DRAW))
+        .WillOnce([&uploaded](GLenum, GLsizeiptr size, const GLvoid *data, GLenum)
+                  { uploaded.assign(static_cast<const std::uint16_t *>(data), static_cast<const std::uint16_t *>(data) + size / 2); });
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(9))).Times(1);
+
+    // Act
+    indexBuffer.set(indices, 4);
+
+    // Assert
+    ASSERT_EQ(uploaded, (std::vector<std::uint16_t>{0, 1, 2, 2, 1, 3}));
+    ASSERT_EQ(indexBuffer.getIndexType(), GL_UNSIGNED_SHORT);
+    ASSERT_EQ(indexBuffer.getCount(), 6);
+    ASSERT_EQ(indexBuffer.getBufferID(), 9);
+}
+
+TEST_F(IndexBufferTests, Set_Upload32BitIndicesForLargeMeshes)
+{
+    // Arrange
+    IndexBuffer indexBuffer;
+    std::vector<std::uint32_t> indices{0, 70000, 1};
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_COPY_WRITE_BUFFER, 12, indices.data(), GL_STATIC_DRAW)).Times(1);
+
+    // Act
+    indexBuffer.set(indices, 70001);
+
+    // Assert
+    ASSERT_EQ(indexBuffer.getIndexType(), GL_UNSIGNED_INT);
+}
+
+TEST_F(IndexBufferTests, Set_WriteIntoAllocation)
+{
+    // Arrange
+    IndexBuffer indexBuffer;
+    indexBuffer.setAllocation(std::make_shared<BufferAllocation>(BufferAllocation{5, 128, 64}));
+    std::vector<std::uint32_t> indices{0, 1, 2};
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_COPY_WRITE_BUFFER, 128, 6, ::testing::_)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDrawElements_mock(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, reinterpret_cast<const void *>(128))).Times(1);
+
+    // Act
+    indexBuffer.set(indices, 3);
+    indexBuffer.draw();
+
+    // Assert
+    ASSERT_EQ(indexBuffer.getBufferID(), 5);
+}
+
+TEST_F(IndexBufferTests, Set_ThrowOnIndexOutOfRange)
+{
+    // Arrange
+    IndexBuffer indexBuffer;
+    std::vector<std::uint32_t> indices{0, 1, 3};
+
+    // Act & Assert
+    EXPECT_THROW(indexBuffer.set(indices, 3), std::out_of_range);
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/Api.hpp>
+#include <graphic/opengl/buffer/InterleavedBuffer.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/profile/Attribute.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Setter.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Binder.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Unbinder.hpp>
+#include <TestUtils.hpp>
+
+namespace api = artist::graphic::api;
+namespace mock = artist::mock;
+namespace context = artist::graphic::opengl::context;
+using artist::graphic::opengl::buffer::InterleavedBuffer;
+using artist::test::utils::expectSpecificError;
+using OpenGLAttribute = artist::graphic::pipeline::Attribute<api::OpenGL, artist::graphic::opengl::profile::Attribute::Classic>;
+
+struct InterleavedTestVertex
+{
+    glm::vec3 position;
+    glm::vec2 uv;
+    glm::uvec4 bones;
+};
+ARTIST_VERTEX_LAYOUT(InterleavedTestVertex, position, uv, bones)
+
+class InterleavedBufferTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(4));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static std::shared_ptr<context::OpenGLAttributeContext> addAttribute(context::OpenGLPassContext &pass, const std::string &name)
+    {
+        auto attributeContext = std::make_shared<context::OpenGLAttributeContext>();
+        attributeContext->setAttributeName(name);
+        pass.addAttribute(name, std::make_shared<OpenGLAttribute>(attributeContext));
+        return attributeContext;
+    }
+};
+
+TEST_F(InterleavedBufferTests, Set_UploadVerticesOnce)
+{
+    // Arrange
+    InterleavedBuffer<InterleavedTestVertex> vertices;
+    std::vector<InterleavedTestVertex> values(8);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 8 * sizeof(InterleavedTestVertex), values.data(), GL_STATIC_DRAW)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock).Times(0);
+
+    // Act
+    vertices.set(std::span<const InterleavedTestVertex>(values));
+
+    // Assert
+    ASSERT_EQ(vertices.getBufferID(), 4);
+    ASSERT_EQ(vertices.size(), 8);
+}
+
+TEST_F(InterleavedBufferTests, Set_OrphanStoreOfSameSize)
+{
+    // Arrange
+    InterleavedBuffer<InterleavedTestVertex> vertices;
+    std::vector<InterleavedTestVertex> values(8);
+    vertices.set(std::span<const InterleavedTestVertex>(values));
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 8 * sizeof(InterleavedTestVertex), nullptr, GL_STATIC_DRAW)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 0, 8 * sizeof(InterleavedTestVertex), values.data())).Times(1);
+
+    // Act
+    vertices.set(std::span<const InterleavedTestVertex>(values));
+}
+
+TEST_F(InterleavedBufferTests, Update_UploadModifiedVertices)
+{
+    // Arrange
+    InterleavedBuffer<InterleavedTestVertex> vertices;
+    std::vector<InterleavedTestVertex> values(8);
+    vertices.set(std::span<const InterleavedTestVertex>(values));
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 2 * sizeof(InterleavedTestVertex), 3 * sizeof(InterleavedTestVertex), values.data() + 2)).Times(1);
+
+    // Act
+    vertices.update(values, 2, 3);
+
+    // Assert
+    expectSpecificError([&]()
+                        { vertices.update(values, 6, 3); },
+                        std::out_of_range("ERROR::INTERLEAVED_BUFFER::OUT_OF_RANGE: Vertices [6, 9) are outside of a buffer of 8 vertices"));
+}
+
+TEST_F(InterleavedBufferTests, Attach_ShareBufferAcrossElements)
+{
+    // Arrange
+    InterleavedBuffer<InterleavedTestVertex> vertices;
+    std::vector<InterleavedTestVertex> values(8);
+    vertices.set(std::span<const InterleavedTestVertex>(values));
+    context::OpenGLPassContext pass;
+    auto position = addAttribute(pass, "position");
+    auto uv = addAttribute(pass, "uv");
+    auto bones = addAttribute(pass, "bones");
+    auto color = addAttribute(pass, "color");
+
+    // Act
+    vertices.attach(pass);
+
+    // Assert
+    ASSERT_EQ(position->getBufferID(), 4);
+    ASSERT_EQ(uv->getBufferID(), 4);
+    ASSERT_EQ(bones->getBufferID(), 4);
+    ASSERT_EQ(color->getBufferID(), 0);
+    ASSERT_EQ(uv->getStride(), sizeof(InterleavedTestVertex));
+    ASSERT_EQ(uv->getOffset(), offsetof(InterleavedTestVertex, uv));
+    ASSERT_EQ(uv->getGLSize(), 2);
+    ASSERT_EQ(bones->getGLType(), GL_UNSIGNED_INT);
+    ASSERT_EQ(bones->getVertexFetch(), artist::graphic::opengl::layout::VertexFetch::Integer);
+}
+
+TEST_F(InterleavedBufferTests, Attach_ThrowWhenElementIsMissing)
+{
+    // Arrange
+    InterleavedBuffer<InterleavedTestVertex> vertices;
+    context::OpenGLAttributeContext attribute;
+    attribute.setAttributeName("color");
+
+    // Act & Assert
+    expectSpecificError([&]()
+                        { vertices.attach(attribute); },
+                        std::runtime_error("ERROR::INTERLEAVED_BUFFER::ELEMENT_NOT_FOUND: No element named color in the vertex layout"));
+}
+
+TEST_F(InterleavedBufferTests, Destroy_ReleaseBufferOfAttachedAttributes)
+{
+    // Arrange
+    context::OpenGLAttributeContext attribute;
+    attribute.setAttributeName("position");
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(4))).Times(1);
+
+    // Act
+    {
+        InterleavedBuffer<InterleavedTestVertex> vertices;
+        vertices.attach(attribute);
+    }
+
+    // Assert
+    ASSERT_EQ(attribute.getBufferID(), 0);
+}
+
+#endif
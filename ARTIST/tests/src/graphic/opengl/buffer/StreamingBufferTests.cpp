@@ -0,0 +1,203 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/buffer/StreamingBuffer.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace context = artist::graphic::opengl::context;
+using artist::graphic::opengl::buffer::StreamingBuffer;
+using artist::test::utils::expectSpecificError;
+
+class StreamingBufferTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_memory.resize(3 * 64);
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(4));
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock)
+            .WillByDefault(::testing::Return(m_memory.data()));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static GLsync fence(std::uintptr_t id)
+    {
+        return reinterpret_cast<GLsync>(id);
+    }
+
+    std::vector<std::byte> m_memory;
+};
+
+TEST_F(StreamingBufferTests, Create_MapPersistentStorage)
+{
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferStorage_mock(GL_ARRAY_BUFFER, 3 * 64, nullptr, StreamingBuffer::STORAGE_FLAGS)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock(GL_ARRAY_BUFFER, 0, 3 * 64, StreamingBuffer::STORAGE_FLAGS)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUnmapBuffer_mock(GL_ARRAY_BUFFER)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(4))).Times(1);
+
+    // Act
+    StreamingBuffer stream(64, 3);
+
+    // Assert
+    ASSERT_EQ(stream.getBufferID(), 4);
+    ASSERT_EQ(stream.getRegionCount(), 3);
+}
+
+TEST_F(StreamingBufferTests, Create_ThrowWhenMapFails)
+{
+    // Arrange
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock).WillByDefault(::testing::Return(nullptr));
+
+    // Act & Assert
+    expectSpecificError([]()
+                        { StreamingBuffer stream(64, 3); },
+                        std::runtime_error("ERROR::STREAMING_BUFFER::MAP_FAILED"));
+}
+
+TEST_F(StreamingBufferTests, Write_CopyIntoCurrentRegion)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+    std::vector<float> values{1.0f, 2.0f, 3.0f};
+
+    // Act
+    stream.beginFrame();
+    GLintptr first = stream.write<float>(values);
+    GLintptr second = stream.write<float>(values);
+
+    // Assert
+    ASSERT_EQ(first, 0);
+    ASSERT_EQ(second, StreamingBuffer::ALIGNMENT);
+    ASSERT_EQ(reinterpret_cast<const float *>(m_memory.data())[2], 3.0f);
+}
+
+TEST_F(StreamingBufferTests, WriteInterleaved_InterleaveComponentArraysIntoRegion)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+    std::vector<float> x{1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> y{10.0f, 20.0f, 30.0f, 40.0f};
+    std::vector<const float *> streams{x.data(), y.data()};
+    stream.beginFrame();
+    stream.write<float>(x);
+
+    // Act
+    GLintptr offset = stream.writeInterleaved<glm::vec2>(streams, 4);
+
+    // Assert
+    ASSERT_EQ(offset, StreamingBuffer::ALIGNMENT);
+    const auto *vertices = reinterpret_cast<const float *>(m_memory.data() + offset);
+    ASSERT_EQ(std::vector<float>(vertices, vertices + 8), (std::vector<float>{1.0f, 10.0f, 2.0f, 20.0f, 3.0f, 30.0f, 4.0f, 40.0f}));
+}
+
+TEST_F(StreamingBufferTests, Allocate_ThrowWhenRegionIsFull)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+    stream.beginFrame();
+    stream.allocate<glm::vec4>(3);
+
+    // Act & Assert
+    EXPECT_THROW(stream.allocate<glm::vec4>(2), std::runtime_error);
+}
+
+TEST_F(StreamingBufferTests, EndFrame_FenceRegionAndMoveToNext)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock(GL_SYNC_GPU_COMMANDS_COMPLETE, 0))
+        .WillOnce(::testing::Return(fence(1)));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(fence(1))).Times(1);
+
+    // Act
+    stream.beginFrame();
+    stream.endFrame();
+    stream.beginFrame();
+    GLintptr offset = stream.write<float>(std::vector<float>{1.0f});
+
+    // Assert
+    ASSERT_EQ(stream.getCurrentRegion(), 1);
+    ASSERT_EQ(offset, 64);
+}
+
+TEST_F(StreamingBufferTests, BeginFrame_WaitFenceOfReusedRegion)
+{
+    // Arrange
+    StreamingBuffer stream(64, 2);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock)
+        .WillOnce(::testing::Return(fence(1)))
+        .WillOnce(::testing::Return(fence(2)));
+    stream.beginFrame();
+    stream.endFrame();
+    stream.beginFrame();
+    stream.endFrame();
+
+    // Expected call
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(fence(1), GL_SYNC_FLUSH_COMMANDS_BIT, StreamingBuffer::WAIT_TIMEOUT))
+        .WillOnce(::testing::Return(GL_TIMEOUT_EXPIRED))
+        .WillOnce(::testing::Return(GL_CONDITION_SATISFIED));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(fence(1))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(fence(2))).Times(1);
+
+    // Act
+    stream.beginFrame();
+
+    // Assert
+    ASSERT_EQ(stream.getCurrentRegion(), 0);
+}
+
+TEST_F(StreamingBufferTests, Attach_PointAttributeAtStreamedVertices)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+    context::OpenGLAttributeContext attribute;
+    stream.beginFrame();
+    auto allocation = stream.allocate<glm::vec3>(2);
+
+    // Act
+    stream.attach<glm::vec3>(attribute, allocation.offset);
+
+    // Assert
+    ASSERT_EQ(attribute.getBufferID(), 4);
+    ASSERT_EQ(attribute.getBufferOffset(), allocation.offset);
+    ASSERT_EQ(attribute.getGLSize(), 3);
+    ASSERT_EQ(attribute.getStride(), sizeof(glm::vec3));
+}
+
+TEST_F(StreamingBufferTests, Attach_KeepOwnBufferOfAttribute)
+{
+    // Arrange
+    StreamingBuffer stream(64, 3);
+    context::OpenGLAttributeContext attribute;
+    attribute.setBufferID(9);
+    attribute.setBufferOffset(32);
+    stream.beginFrame();
+    auto allocation = stream.allocate<glm::vec3>(2);
+    stream.attach<glm::vec3>(attribute, allocation.offset);
+
+    // Act
+    attribute.setStreamingRange(nullptr);
+
+    // Assert
+    ASSERT_EQ(attribute.getBufferID(), 9);
+    ASSERT_EQ(attribute.getBufferOffset(), 32);
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/buffer/UploadQueue.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+using artist::graphic::opengl::buffer::BufferAllocation;
+using artist::graphic::opengl::buffer::UploadQueue;
+using artist::test::utils::expectSpecificError;
+
+class UploadQueueTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_staging.resize(256);
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(4));
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock)
+            .WillByDefault(::testing::Return(m_staging.data()));
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock)
+            .WillByDefault(::testing::Return(reinterpret_cast<GLsync>(std::uintptr_t{1})));
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock)
+            .WillByDefault(::testing::Return(GL_ALREADY_SIGNALED));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static std::vector<std::byte> bytes(std::size_t count)
+    {
+        std::vector<std::byte> data(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            data[i] = static_cast<std::byte>(i);
+        }
+        return data;
+    }
+
+    static bool isReady(const std::shared_future<void> &future)
+    {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    std::vector<std::byte> m_staging;
+};
+
+TEST_F(UploadQueueTests, Create_MapStagingBuffer)
+{
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferStorage_mock(GL_COPY_READ_BUFFER, 256, nullptr, UploadQueue::STORAGE_FLAGS)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock(GL_COPY_READ_BUFFER, 0, 256, UploadQueue::STORAGE_FLAGS)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUnmapBuffer_mock(GL_COPY_READ_BUFFER)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(4))).Times(1);
+
+    // Act
+    UploadQueue uploads(256, 64, false);
+
+    // Assert
+    ASSERT_EQ(uploads.getStagingBufferID(), 4);
+    ASSERT_TRUE(uploads.isIdle());
+}
+
+TEST_F(UploadQueueTests, Create_ThrowWhenBudgetIsTooSmall)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { UploadQueue uploads(256, 8, false); },
+                        std::runtime_error("ERROR::UPLOAD_QUEUE::INVALID_SIZES: staging 256 bytes, budget 8 bytes"));
+}
+
+TEST_F(UploadQueueTests, Process_CopyStagedDataIntoDestination)
+{
+    // Arrange
+    UploadQueue uploads(256, 64, false);
+    auto done = uploads.submit(bytes(32), 9, 16);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(::testing::_, ::testing::_)).Times(::testing::AnyNumber());
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_COPY_WRITE_BUFFER, 9)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 16, 32)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)).Times(1);
+
+    // Act
+    std::size_t staged = uploads.stagePending();
+    std::size_t copied = uploads.process();
+
+    // Assert
+    ASSERT_EQ(staged, 1);
+    ASSERT_EQ(copied, 32);
+    ASSERT_EQ(std::memcmp(m_staging.data(), bytes(32).data(), 32), 0);
+    ASSERT_FALSE(isReady(done));
+
+    // Act
+    uploads.process();
+
+    // Assert
+    ASSERT_TRUE(isReady(done));
+    ASSERT_TRUE(uploads.isIdle());
+}
+
+TEST_F(UploadQueueTests, Process_SpreadLargeUploadOverFrames)
+{
+    // Arrange
+    UploadQueue uploads(256, 64, false);
+    auto done = uploads.submit(bytes(160), 9, 0);
+    uploads.stagePending();
+
+    // Expected call
+    {
+        ::testing::InSequence sequence;
+        EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, 64)).Times(1);
+        EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 64, 64, 64)).Times(1);
+        EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 128, 128, 32)).Times(1);
+    }
+
+    // Act
+    std::vector<std::size_t> frames;
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        frames.push_back(uploads.process());
+    }
+
+    // Assert
+    ASSERT_EQ(frames, (std::vector<std::size_t>{64, 64, 32, 0}));
+    ASSERT_TRUE(isReady(done));
+}
+
+TEST_F(UploadQueueTests, Process_ReuseStagingMemoryOnceFenceIsSignaled)
+{
+    // Arrange
+    UploadQueue uploads(128, 64, false);
+    auto done = uploads.submit(bytes(192), 9, 0);
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock)
+        .WillByDefault(::testing::Return(GL_TIMEOUT_EXPIRED));
+
+    // Act & Assert
+    ASSERT_EQ(uploads.stagePending(), 2);
+    ASSERT_EQ(uploads.process(), 64);
+    ASSERT_EQ(uploads.stagePending(), 0);
+
+    // Arrange
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock)
+        .WillByDefault(::testing::Return(GL_ALREADY_SIGNALED));
+
+    // Act & Assert
+    ASSERT_EQ(uploads.process(), 64);
+    ASSERT_EQ(uploads.stagePending(), 1);
+    ASSERT_FALSE(isReady(done));
+    ASSERT_EQ(uploads.process(), 64);
+    uploads.process();
+    ASSERT_TRUE(isReady(done));
+}
+
+TEST_F(UploadQueueTests, Process_ReadAllocationWhenCopying)
+{
+    // Arrange
+    UploadQueue uploads(256, 64, false);
+    auto allocation = std::make_shared<BufferAllocation>(BufferAllocation{3, 128, 64});
+    uploads.submit(bytes(16), allocation, 8);
+    uploads.stagePending();
+    *allocation = BufferAllocation{5, 32, 64}; // Moved by a compaction
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(::testing::_, ::testing::_)).Times(::testing::AnyNumber());
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_COPY_WRITE_BUFFER, 5)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 40, 16)).Times(1);
+
+    // Act
+    uploads.process();
+}
+
+TEST_F(UploadQueueTests, Submit_ThrowWhenOutOfRange)
+{
+    // Arrange
+    UploadQueue uploads(256, 64, false);
+    auto allocation = std::make_shared<BufferAllocation>(BufferAllocation{3, 0, 16});
+
+    // Act & Assert
+    expectSpecificError([&]()
+                        { uploads.submit(bytes(16), allocation, 8); },
+                        std::out_of_range("ERROR::UPLOAD_QUEUE::OUT_OF_RANGE: 16 bytes at offset 8 do not fit in 16 bytes"));
+}
+
+TEST_F(UploadQueueTests, Worker_StageSubmissionsInBackground)
+{
+    // Arrange
+    UploadQueue uploads(256, 64, true);
+    auto done = uploads.submit(bytes(100), 9, 0);
+
+    // Act
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!isReady(done) && std::chrono::steady_clock::now() < deadline)
+    {
+        uploads.process();
+        std::this_thread::yield();
+    }
+
+    // Assert
+    ASSERT_TRUE(isReady(done));
+    ASSERT_TRUE(uploads.isIdle());
+}
+
+TEST_F(UploadQueueTests, Worker_StopWhenDestroyedRightAfterStart)
+{
+    // Act: the stop request races with the worker reaching its wait, it must never be lost
+    for (int i = 0; i < 200; ++i)
+    {
+        UploadQueue uploads(256, 64, true);
+    }
+
+    // Assert
+    SUCCEED();
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <graphic/opengl/buffer/UsageTracker.hpp>
+
+using artist::graphic::opengl::buffer::UpdateStrategy;
+using artist::graphic::opengl::buffer::UsageTracker;
+using namespace std::chrono_literals;
+
+class UsageTrackerTests : public ::testing::Test
+{
+protected:
+    /**
+     * @brief Records count uploads of dirtyBytes out of 100 bytes, one every interval.
+     */
+    UpdateStrategy recordUploads(std::size_t count, std::chrono::milliseconds interval, std::size_t dirtyBytes)
+    {
+        UpdateStrategy strategy = UpdateStrategy::Undecided;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            strategy = m_tracker.record(m_now, dirtyBytes, 100);
+            m_now += interval;
+        }
+        return strategy;
+    }
+
+    UsageTracker m_tracker;
+    UsageTracker::Clock::time_point m_now{};
+};
+
+TEST_F(UsageTrackerTests, Record_UndecidedDuringWarmUp)
+{
+    // Act
+    UpdateStrategy strategy = recordUploads(UsageTracker::WARM_UP_UPLOADS - 1, 16ms, 100);
+
+    // Assert
+    ASSERT_EQ(strategy, UpdateStrategy::Undecided);
+    ASSERT_EQ(m_tracker.getUploadCount(), UsageTracker::WARM_UP_UPLOADS - 1);
+}
+
+TEST_F(UsageTrackerTests, Record_StreamFullRewritesEveryFrame)
+{
+    // Act
+    UpdateStrategy strategy = recordUploads(UsageTracker::WARM_UP_UPLOADS, 16ms, 100);
+
+    // Assert
+    ASSERT_EQ(strategy, UpdateStrategy::Streaming);
+    ASSERT_NEAR(m_tracker.getAverageInterval().count(), 0.016, 1e-9);
+    ASSERT_DOUBLE_EQ(m_tracker.getAverageDirtyFraction(), 1.0);
+}
+
+TEST_F(UsageTrackerTests, Record_SubDataForPartialUpdates)
+{
+    // Act
+    UpdateStrategy strategy = recordUploads(UsageTracker::WARM_UP_UPLOADS, 16ms, 10);
+
+    // Assert
+    ASSERT_EQ(strategy, UpdateStrategy::SubData);
+}
+
+TEST_F(UsageTrackerTests, Record_ImmutableForRareUpdates)
+{
+    // Act
+    UpdateStrategy strategy = recordUploads(UsageTracker::WARM_UP_UPLOADS, 5000ms, 100);
+
+    // Assert
+    ASSERT_EQ(strategy, UpdateStrategy::Immutable);
+}
+
+TEST_F(UsageTrackerTests, Record_FollowChangingPattern)
+{
+    // Arrange
+    recordUploads(UsageTracker::WARM_UP_UPLOADS, 16ms, 100);
+
+    // Act
+    UpdateStrategy strategy = recordUploads(16, 200ms, 10);
+
+    // Assert
+    ASSERT_EQ(strategy, UpdateStrategy::SubData);
+}
+
+TEST_F(UsageTrackerTests, Reset_ForgetObservedUploads)
+{
+    // Arrange
+    recordUploads(UsageTracker::WARM_UP_UPLOADS, 16ms, 100);
+
+    // Act
+    m_tracker.reset();
+
+    // Assert
+    ASSERT_EQ(m_tracker.getStrategy(), UpdateStrategy::Undecided);
+    ASSERT_EQ(m_tracker.getUploadCount(), 0);
+}
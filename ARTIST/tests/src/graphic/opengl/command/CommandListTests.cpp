@@ -0,0 +1,172 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <glm/glm.hpp>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/pipeline/MockPass.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/profile/Pipeline.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/User.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/Resetter.hpp>
+#include <graphic/opengl/context/PipelineContext.hpp>
+#include <graphic/opengl/command/CommandList.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::graphic::api;
+namespace command = artist::graphic::opengl::command;
+namespace pipeline = artist::graphic::pipeline;
+using artist::graphic::opengl::buffer::IndexBuffer;
+using artist::graphic::opengl::context::OpenGLPassContext;
+using artist::graphic::opengl::profile::Pipeline::Classic;
+using artist::mock::graphic::pipeline::opengl::MockPass;
+using artist::test::utils::expectSpecificError;
+
+class CommandListTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_pass.setPassID(3);
+        m_pass.setCurrentVertexArray(9);
+        addUniform(m_pass, "scale", 4);
+        addUniform(m_pass, "view", 5);
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static void addUniform(OpenGLPassContext &pass, const std::string &name, GLuint location)
+    {
+        auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+        uniform->getContext()->setUniformID(location);
+        pass.addUniform(name, uniform);
+    }
+
+    OpenGLPassContext m_pass;
+};
+
+TEST_F(CommandListTests, ReplayRecordedCommandsInOrder)
+{
+    // Arrange
+    command::CommandRecorder recorder;
+    recorder.usePass(m_pass);
+    recorder.uniform("scale", 2.0f);
+    recorder.enable(GL_DEPTH_TEST);
+    recorder.drawArrays(GL_TRIANGLES, 0, 36);
+    recorder.disable(GL_DEPTH_TEST);
+    command::CommandList list = recorder.finish();
+    ::testing::InSequence sequence;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUseProgram_mock(3)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(9)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniform1f_mock(4, 2.0f)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEnable_mock(GL_DEPTH_TEST)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDrawArrays_mock(GL_TRIANGLES, 0, 36)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDisable_mock(GL_DEPTH_TEST)).Times(1);
+
+    // Act
+    list.replay();
+
+    // Assert
+    ASSERT_EQ(list.getCommands().size(), 6);
+}
+
+TEST_F(CommandListTests, PatchParameterBeforeReplay)
+{
+    // Arrange
+    command::CommandRecorder recorder;
+    recorder.usePass(m_pass);
+    const auto view = recorder.parameter("view", glm::mat4(1.0f));
+    command::CommandList list = recorder.finish();
+    float uploaded = 0.0f;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniformMatrix4fv_mock(5, 1, GL_FALSE, ::testing::_))
+        .WillOnce([&uploaded](GLint, GLsizei, GLboolean, const GLfloat *value)
+                  { uploaded = value[0]; });
+
+    // Act
+    list.patch(view, glm::mat4(7.0f));
+    list.replay();
+
+    // Assert
+    ASSERT_EQ(uploaded, 7.0f);
+}
+
+TEST_F(CommandListTests, DrawIndexedRangeOfPassIndices)
+{
+    // Arrange
+    auto indices = std::make_shared<IndexBuffer>();
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+        .WillByDefault(::testing::SetArgPointee<1>(6));
+    indices->set(std::vector<std::uint32_t>{0, 1, 2, 2, 1, 3}, 4);
+    m_pass.setIndexBuffer(indices);
+    command::CommandRecorder recorder;
+    recorder.usePass(m_pass);
+    recorder.drawIndexed(3, 3);
+    command::CommandList list = recorder.finish();
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDrawElements_mock(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, reinterpret_cast<const void *>(6))).Times(1);
+
+    // Act
+    list.replay();
+}
+
+TEST_F(CommandListTests, RecordPipelinePasses)
+{
+    // Arrange
+    auto pass1 = std::make_shared<MockPass<api::OpenGL>>();
+    auto pass2 = std::make_shared<MockPass<api::OpenGL>>();
+    pass1->getContext()->setPassID(11);
+    pass2->getContext()->setPassID(12);
+    pipeline::Pipeline<api::OpenGL, Classic> pipeline({pass1, pass2});
+
+    // Expected call
+    EXPECT_CALL(*pass1, use()).Times(1);
+    EXPECT_CALL(*pass2, use()).Times(1);
+
+    // Act
+    command::CommandList list = command::recordPipeline(pipeline, [](int pass, command::CommandRecorder &recorder)
+                                                        { recorder.drawArrays(GL_TRIANGLES, 0, 3 * (pass + 1)); });
+
+    // Assert
+    const auto commands = list.getCommands();
+    ASSERT_EQ(commands.size(), 4);
+    ASSERT_EQ(commands[0].type, command::CommandType::UseProgram);
+    ASSERT_EQ(commands[0].object, 11);
+    ASSERT_EQ(commands[2].object, 12);
+    ASSERT_EQ(commands[3].count, 6);
+    ASSERT_EQ(pipeline.getContext()->getCurrentPass(), -1);
+}
+
+TEST_F(CommandListTests, ThrowOnUnknownUniform)
+{
+    // Arrange
+    command::CommandRecorder recorder;
+    recorder.usePass(m_pass);
+
+    // Act & Assert
+    expectSpecificError([&recorder]()
+                        { recorder.uniform("missing", 1); },
+                        std::runtime_error("ERROR::COMMAND_RECORDER::UNIFORM_NOT_FOUND: Uniform missing not found"));
+}
+
+TEST_F(CommandListTests, ThrowOnForeignSlot)
+{
+    // Arrange
+    command::CommandList list;
+
+    // Act & Assert
+    expectSpecificError([&list]()
+                        { list.patch(command::ParameterSlot<float>{0}, 1.0f); },
+                        std::out_of_range("ERROR::COMMAND_LIST::INVALID_SLOT: No parameter at offset 0"));
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,197 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/command/ParallelRecorder.hpp>
+#include <graphic/opengl/context/PipelineContext.hpp>
+#include <graphic/pipeline/DrawKey.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::graphic::api;
+namespace command = artist::graphic::opengl::command;
+namespace pipeline = artist::graphic::pipeline;
+using artist::common::thread::ThreadPool;
+using artist::graphic::opengl::context::OpenGLPassContext;
+using artist::graphic::pipeline::DrawKeyLayout;
+
+class ParallelRecorderTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_passes.push_back(capture(3, 9));
+        m_passes.push_back(capture(4, 10));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static command::PassView capture(GLuint program, GLuint vertexArray)
+    {
+        OpenGLPassContext pass;
+        pass.setPassID(program);
+        pass.setCurrentVertexArray(vertexArray);
+        auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+        uniform->getContext()->setUniformID(program + 10);
+        pass.addUniform("model", uniform);
+        return command::PassView::capture(pass);
+    }
+
+    static std::size_t countType(const command::CommandList &list, command::CommandType type)
+    {
+        std::size_t count = 0;
+        for (const command::Command &command : list.getCommands())
+        {
+            count += command.type == type;
+        }
+        return count;
+    }
+
+    std::vector<command::PassView> m_passes;
+};
+
+TEST_F(ParallelRecorderTests, PassView_FindUniform)
+{
+    // Act & Assert
+    ASSERT_EQ(m_passes[0].getProgram(), 3);
+    ASSERT_EQ(m_passes[0].getVertexArray(), 9);
+    ASSERT_EQ(m_passes[0].findUniform("model"), 13);
+    ASSERT_EQ(m_passes[0].findUniform("view"), -1);
+    ASSERT_FALSE(m_passes[0].hasIndices());
+}
+
+TEST_F(ParallelRecorderTests, Merge_OrderPacketsByKeyAndDropRepeatedBinds)
+{
+    // Arrange
+    std::vector<command::ThreadCommandList> lists(2);
+    lists[0].beginDraw(m_passes[1], 1).drawArrays(GL_TRIANGLES, 0, 1);
+    lists[0].beginDraw(m_passes[0], 0).drawArrays(GL_TRIANGLES, 0, 2);
+    lists[1].beginDraw(m_passes[0], 0).drawArrays(GL_TRIANGLES, 0, 3);
+    lists[1].beginDraw(m_passes[1], 1).drawArrays(GL_TRIANGLES, 0, 4);
+
+    // Act
+    command::CommandList merged = command::mergeCommandLists(lists);
+
+    // Assert
+    std::vector<GLsizei> draws;
+    for (const command::Command &command : merged.getCommands())
+    {
+        if (command.type == command::CommandType::DrawArrays)
+        {
+            draws.push_back(command.count);
+        }
+    }
+    ASSERT_EQ(draws, (std::vector<GLsizei>{2, 3, 1, 4}));
+    ASSERT_EQ(countType(merged, command::CommandType::UseProgram), 2);
+    ASSERT_EQ(countType(merged, command::CommandType::BindVertexArray), 2);
+}
+
+TEST_F(ParallelRecorderTests, Merge_KeepUniformValues)
+{
+    // Arrange
+    std::vector<command::ThreadCommandList> lists(2);
+    lists[0].beginDraw(m_passes[0], 1).uniform("model", 1.0f);
+    lists[1].beginDraw(m_passes[0], 0).uniform("model", 2.0f);
+    command::CommandList merged = command::mergeCommandLists(lists);
+    ::testing::InSequence sequence;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUseProgram_mock(3)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(9)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniform1f_mock(13, 2.0f)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniform1f_mock(13, 1.0f)).Times(1);
+
+    // Act
+    merged.replay();
+}
+
+TEST_F(ParallelRecorderTests, Merge_BindEachProgramOnceWithDrawKeys)
+{
+    // Arrange
+    const DrawKeyLayout layout = DrawKeyLayout::opaque();
+    std::vector<command::ThreadCommandList> lists(1);
+    for (std::uint32_t object = 0; object < 100; ++object)
+    {
+        const std::uint32_t program = object % 2;
+        lists[0].beginDraw(m_passes[program], layout.encode({.program = program, .depth = 1.0f - static_cast<float>(object) / 100.0f}))
+            .drawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(object));
+    }
+
+    // Act
+    command::CommandList merged = command::mergeCommandLists(lists);
+
+    // Assert
+    ASSERT_EQ(countType(merged, command::CommandType::UseProgram), 2);
+    const auto commands = merged.getCommands();
+    ASSERT_EQ(commands[0].object, 3);
+    ASSERT_EQ(commands[2].count, 98); // Closest draw of the first program first
+}
+
+TEST_F(ParallelRecorderTests, Merge_OrderPacketsWithDrawKeyLayoutOfPipeline)
+{
+    // Arrange
+    artist::graphic::opengl::context::OpenGLPipelineContext pipelineContext;
+    pipelineContext.setDrawKeyLayout(DrawKeyLayout::transparent());
+    const DrawKeyLayout &layout = pipelineContext.getDrawKeyLayout();
+    std::vector<command::ThreadCommandList> lists(1);
+    for (const auto &[count, depth] : {std::pair{1, 0.1f}, std::pair{2, 0.9f}, std::pair{3, 0.5f}})
+    {
+        lists[0].beginDraw(m_passes[0], layout, {.depth = depth}).drawArrays(GL_TRIANGLES, 0, count);
+    }
+
+    // Act
+    command::CommandList merged = command::mergeCommandLists(lists);
+
+    // Assert: back to front
+    std::vector<GLsizei> counts;
+    for (const command::Command &command : merged.getCommands())
+    {
+        if (command.type == command::CommandType::DrawArrays)
+        {
+            counts.push_back(command.count);
+        }
+    }
+    ASSERT_EQ(counts, (std::vector<GLsizei>{2, 3, 1}));
+}
+
+TEST_F(ParallelRecorderTests, RecordParallel_MatchSequentialRecording)
+{
+    // Arrange
+    ThreadPool pool(4);
+    const std::size_t objectCount = 10000;
+    auto record = [this](command::ThreadCommandList &list, std::size_t first, std::size_t last)
+    {
+        for (std::size_t object = first; object < last; ++object)
+        {
+            command::CommandRecorder &recorder = list.beginDraw(m_passes[object % 2], object % 2);
+            recorder.uniform("model", static_cast<float>(object));
+            recorder.drawArrays(GL_TRIANGLES, 0, 3);
+        }
+    };
+    std::vector<command::ThreadCommandList> sequential(1);
+    record(sequential[0], 0, objectCount);
+    const command::CommandList expected = command::mergeCommandLists(sequential);
+
+    // Act
+    const command::CommandList merged = command::recordParallel(pool, objectCount, 256, record);
+
+    // Assert
+    ASSERT_EQ(merged.getCommands().size(), expected.getCommands().size());
+    ASSERT_EQ(countType(merged, command::CommandType::UseProgram), 2);
+    ASSERT_EQ(countType(merged, command::CommandType::DrawArrays), objectCount);
+    for (std::size_t i = 0; i < merged.getCommands().size(); ++i)
+    {
+        const command::Command &command = merged.getCommands()[i];
+        ASSERT_EQ(command.type, expected.getCommands()[i].type);
+        ASSERT_TRUE(std::ranges::equal(merged.getValue(command), expected.getValue(expected.getCommands()[i])));
+    }
+}
+
+#endif // __mock_gl__
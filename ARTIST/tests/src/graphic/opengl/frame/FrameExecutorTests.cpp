@@ -0,0 +1,186 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/frame/FrameExecutor.hpp>
+#include <graphic/opengl/profile/Pipeline.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/pipeline/MockPass.hpp>
+#include <graphic/opengl/context/MockPipelineContext.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/MockUser.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/MockResetter.hpp>
+#include <graphic/MockApi.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::mock::graphic::api;
+namespace pipeline = artist::graphic::pipeline;
+using artist::graphic::opengl::frame::FrameExecutor;
+using artist::graphic::opengl::profile::Pipeline::Classic;
+using artist::test::utils::expectSpecificError;
+using mock::graphic::opengl::pipeline::component::pipeline::MockResetter;
+using mock::graphic::opengl::pipeline::component::pipeline::MockUser;
+using mock::graphic::pipeline::opengl::MockPass;
+
+namespace
+{
+    struct RecordingResource
+    {
+        void beginFrame()
+        {
+            events.push_back("begin");
+        }
+
+        void endFrame()
+        {
+            events.push_back("end");
+        }
+
+        [[nodiscard]] std::size_t getRegionCount() const
+        {
+            return regions;
+        }
+
+        std::size_t regions = 2;
+        std::vector<std::string> events;
+    };
+}
+
+class FrameExecutorTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock(GL_SYNC_GPU_COMMANDS_COMPLETE, 0))
+            .WillByDefault([lastFence = std::uintptr_t{0}](GLenum, GLbitfield) mutable
+                           { return reinterpret_cast<GLsync>(++lastFence); });
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+        MockUser<Classic>::reset();
+        MockResetter<Classic>::reset();
+    }
+};
+
+TEST_F(FrameExecutorTests, WaitOnlyWhenRingIsFull)
+{
+    // Arrange
+    FrameExecutor frames(2);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(reinterpret_cast<GLsync>(1), GL_SYNC_FLUSH_COMMANDS_BIT, 0))
+        .WillOnce(::testing::Return(GL_ALREADY_SIGNALED));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(reinterpret_cast<GLsync>(1))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(reinterpret_cast<GLsync>(2))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(reinterpret_cast<GLsync>(3))).Times(1);
+
+    // Act
+    std::vector<std::size_t> slots;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        frames.execute([&slots](std::size_t slot)
+                       { slots.push_back(slot); });
+    }
+
+    // Assert
+    ASSERT_EQ(slots, (std::vector<std::size_t>{0, 1, 0}));
+    ASSERT_EQ(frames.getFrameCount(), 3);
+}
+
+TEST_F(FrameExecutorTests, ReportWaitTime)
+{
+    // Arrange
+    FrameExecutor frames(1);
+    frames.execute([](std::size_t) {});
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(reinterpret_cast<GLsync>(1), GL_SYNC_FLUSH_COMMANDS_BIT, 0))
+        .WillOnce(::testing::Return(GL_TIMEOUT_EXPIRED));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(reinterpret_cast<GLsync>(1), 0, FrameExecutor::WAIT_TIMEOUT))
+        .WillOnce([](GLsync, GLbitfield, GLuint64)
+                  {
+                      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                      return GL_CONDITION_SATISFIED; });
+
+    // Act
+    frames.beginFrame();
+
+    // Assert
+    ASSERT_GE(frames.getLastWaitTime(), std::chrono::milliseconds(2));
+    ASSERT_EQ(frames.getTotalWaitTime(), frames.getLastWaitTime());
+}
+
+TEST_F(FrameExecutorTests, RotateTrackedResources)
+{
+    // Arrange
+    FrameExecutor frames(2);
+    RecordingResource resource;
+    frames.track(resource);
+
+    // Act
+    frames.execute([&resource](std::size_t)
+                   { resource.events.push_back("record"); });
+
+    // Assert
+    ASSERT_EQ(resource.events, (std::vector<std::string>{"begin", "record", "end"}));
+}
+
+TEST_F(FrameExecutorTests, ExecutePipelinePasses)
+{
+    // Arrange
+    FrameExecutor frames(2);
+    auto mockPass1 = std::make_shared<MockPass<api::MockOpenGL>>();
+    auto mockPass2 = std::make_shared<MockPass<api::MockOpenGL>>();
+    pipeline::Pipeline<api::MockOpenGL, Classic> pipeline({mockPass1, mockPass2});
+    std::vector<int> drawn;
+
+    // Expected call
+    EXPECT_CALL(*MockUser<Classic>::instance(), mockOn(::testing::_)).Times(2);
+    EXPECT_CALL(*MockResetter<Classic>::instance(), mockOn(::testing::_)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)).Times(1);
+
+    // Act
+    frames.execute(pipeline, [&drawn](int pass)
+                   { drawn.push_back(pass); });
+
+    // Assert
+    ASSERT_EQ(drawn, (std::vector<int>{0, 1}));
+}
+
+TEST_F(FrameExecutorTests, ThrowOnRingMismatch)
+{
+    // Arrange
+    FrameExecutor frames(2);
+    RecordingResource resource{3, {}};
+
+    // Act & Assert
+    expectSpecificError([&frames, &resource]()
+                        { frames.track(resource); },
+                        std::runtime_error("ERROR::FRAME_EXECUTOR::RING_MISMATCH"));
+}
+
+TEST_F(FrameExecutorTests, ThrowOnWaitFailure)
+{
+    // Arrange
+    FrameExecutor frames(1);
+    frames.execute([](std::size_t) {});
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(GL_WAIT_FAILED));
+
+    // Act & Assert
+    expectSpecificError([&frames]()
+                        { frames.beginFrame(); },
+                        std::runtime_error("ERROR::FRAME_EXECUTOR::WAIT_FAILED"));
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,205 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/pipeline/MockPass.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/profile/Pipeline.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/User.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/Resetter.hpp>
+#include <graphic/opengl/context/PipelineContext.hpp>
+#include <graphic/opengl/frame/GpuScheduler.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::graphic::api;
+namespace pipeline = artist::graphic::pipeline;
+using artist::graphic::opengl::frame::GpuScheduler;
+using artist::graphic::opengl::frame::GpuTask;
+using artist::graphic::opengl::profile::Pipeline::Classic;
+using artist::mock::graphic::pipeline::opengl::MockPass;
+using artist::test::utils::expectSpecificError;
+
+namespace
+{
+    const GLsync FENCE = reinterpret_cast<GLsync>(7);
+
+    GpuTask<> awaitFence(GpuScheduler &scheduler, bool &resumed)
+    {
+        co_await scheduler.fence();
+        resumed = true;
+    }
+
+    GpuTask<GLuint64> awaitQuery(GpuScheduler &scheduler, GLuint query)
+    {
+        co_return co_await scheduler.query(query) * 2;
+    }
+
+    GpuTask<> awaitNested(GpuScheduler &scheduler, GLuint query, GLuint64 &result)
+    {
+        result = co_await awaitQuery(scheduler, query);
+    }
+
+    GpuTask<> awaitFuture(GpuScheduler &scheduler, std::future<int> loading, int &result)
+    {
+        result = co_await scheduler.ready(std::move(loading));
+    }
+}
+
+class GpuSchedulerTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glFenceSync_mock(GL_SYNC_GPU_COMMANDS_COMPLETE, 0))
+            .WillByDefault(::testing::Return(FENCE));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+};
+
+TEST_F(GpuSchedulerTests, ResumeOnceFenceIsSignaled)
+{
+    // Arrange
+    GpuScheduler scheduler;
+    bool resumed = false;
+    ::testing::InSequence sequence;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(FENCE, GL_SYNC_FLUSH_COMMANDS_BIT, 0)).WillOnce(::testing::Return(GL_TIMEOUT_EXPIRED));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(FENCE, 0, 0)).WillOnce(::testing::Return(GL_TIMEOUT_EXPIRED)).WillOnce(::testing::Return(GL_CONDITION_SATISFIED));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteSync_mock(FENCE)).Times(1);
+
+    // Act
+    scheduler.spawn(awaitFence(scheduler, resumed));
+    const bool resumedAfterSpawn = resumed;
+    const std::size_t resumedByFirstPoll = scheduler.poll();
+    const std::size_t resumedBySecondPoll = scheduler.poll();
+
+    // Assert
+    ASSERT_FALSE(resumedAfterSpawn);
+    ASSERT_EQ(resumedByFirstPoll, 0);
+    ASSERT_EQ(resumedBySecondPoll, 1);
+    ASSERT_TRUE(resumed);
+    ASSERT_EQ(scheduler.getTaskCount(), 0);
+}
+
+TEST_F(GpuSchedulerTests, ReturnQueryResultToAwaitingTask)
+{
+    // Arrange
+    GpuScheduler scheduler;
+    GLuint64 result = 0;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGetQueryObjectuiv_mock(3, GL_QUERY_RESULT_AVAILABLE, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<2>(GL_FALSE))
+        .WillOnce(::testing::SetArgPointee<2>(GL_TRUE));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGetQueryObjectui64v_mock(3, GL_QUERY_RESULT, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<2>(21));
+
+    // Act
+    scheduler.spawn(awaitNested(scheduler, 3, result));
+    const std::size_t waiting = scheduler.getWaitingCount();
+    scheduler.poll();
+
+    // Assert
+    ASSERT_EQ(waiting, 1);
+    ASSERT_EQ(result, 42);
+    ASSERT_EQ(scheduler.getTaskCount(), 0);
+}
+
+TEST_F(GpuSchedulerTests, ResumeOnceFutureIsReady)
+{
+    // Arrange
+    GpuScheduler scheduler;
+    std::promise<int> loading;
+    int result = 0;
+    scheduler.spawn(awaitFuture(scheduler, loading.get_future(), result));
+
+    // Act
+    const std::size_t resumedBeforeLoad = scheduler.poll();
+    loading.set_value(5);
+    const std::size_t resumedAfterLoad = scheduler.poll();
+
+    // Assert
+    ASSERT_EQ(resumedBeforeLoad, 0);
+    ASSERT_EQ(resumedAfterLoad, 1);
+    ASSERT_EQ(result, 5);
+}
+
+TEST_F(GpuSchedulerTests, ResumeWithoutSuspendingWhenReady)
+{
+    // Arrange
+    GpuScheduler scheduler;
+    std::promise<int> loading;
+    loading.set_value(9);
+    int result = 0;
+
+    // Act
+    scheduler.spawn(awaitFuture(scheduler, loading.get_future(), result));
+
+    // Assert
+    ASSERT_EQ(result, 9);
+    ASSERT_EQ(scheduler.getTaskCount(), 0);
+}
+
+TEST_F(GpuSchedulerTests, PollRethrowFailedWait)
+{
+    // Arrange
+    GpuScheduler scheduler;
+    bool resumed = false;
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glClientWaitSync_mock(FENCE, ::testing::_, 0))
+        .WillOnce(::testing::Return(GL_TIMEOUT_EXPIRED))
+        .WillOnce(::testing::Return(GL_WAIT_FAILED));
+    scheduler.spawn(awaitFence(scheduler, resumed));
+
+    // Act & Assert
+    expectSpecificError([&scheduler]()
+                        { scheduler.poll(); },
+                        std::runtime_error("ERROR::GPU_SCHEDULER::WAIT_FAILED"));
+    ASSERT_FALSE(resumed);
+    ASSERT_EQ(scheduler.getTaskCount(), 0);
+}
+
+TEST_F(GpuSchedulerTests, ExecutePipelinePassesAfterAwaitedSteps)
+{
+    // Arrange
+    auto pass1 = std::make_shared<MockPass<api::OpenGL>>();
+    auto pass2 = std::make_shared<MockPass<api::OpenGL>>();
+    pipeline::Pipeline<api::OpenGL, Classic> pipeline({pass1, pass2});
+    GpuScheduler scheduler;
+    std::promise<int> loading;
+    std::future<int> loaded = loading.get_future();
+    auto step = [&scheduler, &loaded](int pass) -> GpuTask<>
+    {
+        if (pass == 0)
+        {
+            co_await scheduler.ready(std::move(loaded));
+        }
+    };
+
+    // Expected call
+    EXPECT_CALL(*pass1, use()).Times(1);
+    EXPECT_CALL(*pass2, use()).Times(0);
+
+    // Act
+    scheduler.spawn(artist::graphic::opengl::frame::executePipeline(pipeline, step));
+    scheduler.poll();
+    ::testing::Mock::VerifyAndClearExpectations(pass2.get());
+    EXPECT_CALL(*pass2, use()).Times(1);
+    loading.set_value(1);
+    scheduler.poll();
+
+    // Assert
+    ASSERT_EQ(scheduler.getTaskCount(), 0);
+    ASSERT_EQ(pipeline.getContext()->getCurrentPass(), -1);
+}
+
+#endif // __mock_gl__
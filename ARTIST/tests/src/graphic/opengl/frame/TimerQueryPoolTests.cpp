@@ -0,0 +1,59 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/frame/TimerQueryPool.hpp>
+
+namespace mock = artist::mock;
+using artist::graphic::opengl::frame::TimerQueryPool;
+
+class TimerQueryPoolTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenQueries_mock(2, ::testing::_))
+            .WillByDefault([](GLsizei, GLuint *queries)
+                           {
+                               queries[0] = 7;
+                               queries[1] = 8; });
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+};
+
+TEST_F(TimerQueryPoolTests, ReadResultWhenSlotComesBack)
+{
+    // Arrange
+    TimerQueryPool pool(2);
+    ::testing::InSequence sequence;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBeginQuery_mock(GL_TIME_ELAPSED, 7)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEndQuery_mock(GL_TIME_ELAPSED)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBeginQuery_mock(GL_TIME_ELAPSED, 8)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEndQuery_mock(GL_TIME_ELAPSED)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGetQueryObjectui64v_mock(7, GL_QUERY_RESULT, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<2>(1500));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBeginQuery_mock(GL_TIME_ELAPSED, 7)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteQueries_mock(2, ::testing::_)).Times(1);
+
+    // Act
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        pool.beginFrame();
+        pool.endFrame();
+    }
+    pool.beginFrame();
+
+    // Assert
+    ASSERT_EQ(pool.getLastGpuTime(), std::chrono::nanoseconds(1500));
+    ASSERT_EQ(pool.getRegionCount(), 2);
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <graphic/opengl/layout/VertexEncoding.hpp>
+
+namespace layout = artist::graphic::opengl::layout;
+
+namespace
+{
+    // Regular values plus the edge cases every encoder path must agree on
+    std::vector<float> sampleValues()
+    {
+        std::vector<float> values{0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f, 1.5f, -1.5f, 65504.0f, 65520.0f, 1e-8f, 6e-8f,
+                                  std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                  std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min(),
+                                  1.0f / 254.0f, 1.0f / 510.0f, 0.00196078431f};
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+        while (values.size() < 1027)
+        {
+            values.push_back(distribution(random));
+        }
+        return values;
+    }
+}
+
+TEST(VertexEncodingTests, HalfKnownValues)
+{
+    ASSERT_EQ(layout::scalar::toHalf(1.0f), 0x3c00);
+    ASSERT_EQ(layout::scalar::toHalf(-2.0f), 0xc000);
+    ASSERT_EQ(layout::scalar::toHalf(0.1f), 0x2e66);
+    ASSERT_EQ(layout::scalar::toHalf(65504.0f), 0x7bff);
+    ASSERT_EQ(layout::scalar::toHalf(65520.0f), 0x7c00);
+    ASSERT_EQ(layout::scalar::toHalf(std::bit_cast<float>(0x33800000u)), 0x0001); // 2^-24
+    ASSERT_EQ(layout::scalar::toHalf(-0.0f), 0x8000);
+    ASSERT_EQ(layout::scalar::toHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7e00, 0x7e00);
+}
+
+TEST(VertexEncodingTests, NormalizedKnownValues)
+{
+    // Arrange
+    std::vector<float> values{-2.0f, -1.0f, 0.0f, 0.5f, 1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), -0.5f};
+    std::vector<std::int8_t> snorm8(values.size());
+    std::vector<std::uint8_t> unorm8(values.size());
+    std::vector<std::uint16_t> unorm16(values.size());
+
+    // Act
+    layout::encodeNormalized<std::int8_t>(values, snorm8.data());
+    layout::encodeNormalized<std::uint8_t>(values, unorm8.data());
+    layout::encodeNormalized<std::uint16_t>(values, unorm16.data());
+
+    // Assert
+    ASSERT_EQ(snorm8, (std::vector<std::int8_t>{-127, -127, 0, 64, 127, 127, -127, -64}));
+    ASSERT_EQ(unorm8, (std::vector<std::uint8_t>{0, 0, 0, 128, 255, 255, 0, 0}));
+    ASSERT_EQ(unorm16, (std::vector<std::uint16_t>{0, 0, 0, 32768, 65535, 65535, 0, 0}));
+}
+
+TEST(VertexEncodingTests, Pack2101010)
+{
+    // Arrange
+    std::vector<float> values{1.0f, -1.0f, 0.0f, 1.0f, 0.5f, 0.0f, -0.5f, -1.0f};
+    std::vector<std::uint32_t> packed(2);
+
+    // Act
+    layout::encode2101010(values, 4, packed.data());
+
+    // Assert
+    ASSERT_EQ(packed[0], 511u | (0x201u << 10) | (0u << 20) | (1u << 30));
+    ASSERT_EQ(packed[1], 256u | (0u << 10) | (0x300u << 20) | (3u << 30));
+}
+
+TEST(VertexEncodingTests, HalfMatchesScalar)
+{
+    // Arrange
+    std::vector<float> values = sampleValues();
+    std::vector<std::uint16_t> vectorized(values.size());
+    std::vector<std::uint16_t> scalar(values.size());
+
+    // Act
+    layout::encodeHalf(values, vectorized.data());
+    layout::scalar::encodeHalf(values, scalar.data());
+
+    // Assert
+    ASSERT_EQ(vectorized, scalar);
+}
+
+TEST(VertexEncodingTests, NormalizedMatchesScalar)
+{
+    // Arrange
+    std::vector<float> values = sampleValues();
+    std::vector<std::int8_t> snorm8(values.size()), snorm8Scalar(values.size());
+    std::vector<std::uint8_t> unorm8(values.size()), unorm8Scalar(values.size());
+    std::vector<std::int16_t> snorm16(values.size()), snorm16Scalar(values.size());
+    std::vector<std::uint16_t> unorm16(values.size()), unorm16Scalar(values.size());
+
+    // Act
+    layout::encodeNormalized<std::int8_t>(values, snorm8.data());
+    layout::scalar::encodeNormalized<std::int8_t>(values, snorm8Scalar.data());
+    layout::encodeNormalized<std::uint8_t>(values, unorm8.data());
+    layout::scalar::encodeNormalized<std::uint8_t>(values, unorm8Scalar.data());
+    layout::encodeNormalized<std::int16_t>(values, snorm16.data());
+    layout::scalar::encodeNormalized<std::int16_t>(values, snorm16Scalar.data());
+    layout::encodeNormalized<std::uint16_t>(values, unorm16.data());
+    layout::scalar::encodeNormalized<std::uint16_t>(values, unorm16Scalar.data());
+
+    // Assert
+    ASSERT_EQ(snorm8, snorm8Scalar);
+    ASSERT_EQ(unorm8, unorm8Scalar);
+    ASSERT_EQ(snorm16, snorm16Scalar);
+    ASSERT_EQ(unorm16, unorm16Scalar);
+}
+
+TEST(VertexEncodingTests, Pack2101010MatchesScalar)
+{
+    // Arrange
+    std::vector<float> values = sampleValues();
+    values.resize(values.size() / 12 * 12);
+    std::vector<std::uint32_t> vec3(values.size() / 3), vec3Scalar(values.size() / 3);
+    std::vector<std::uint32_t> vec4(values.size() / 4), vec4Scalar(values.size() / 4);
+
+    // Act
+    layout::encode2101010(values, 3, vec3.data());
+    layout::scalar::encode2101010(values, 3, vec3Scalar.data());
+    layout::encode2101010(values, 4, vec4.data());
+    layout::scalar::encode2101010(values, 4, vec4Scalar.data());
+
+    // Assert
+    ASSERT_EQ(vec3, vec3Scalar);
+    ASSERT_EQ(vec4, vec4Scalar);
+}
+
+TEST(VertexEncodingTests, EncodeThrowsOnUnsupportedType)
+{
+    // Arrange
+    std::vector<float> values(4);
+    std::vector<std::byte> output(16);
+
+    // Act & Assert
+    EXPECT_THROW(layout::encode(values, GL_FLOAT, 4, output), std::runtime_error);
+    EXPECT_THROW(layout::encode(values, GL_INT_2_10_10_10_REV, 2, output), std::runtime_error);
+    EXPECT_THROW(layout::encode(values, GL_HALF_FLOAT, 4, std::span<std::byte>(output).first(4)), std::runtime_error);
+}
+
+TEST(VertexEncodingTests, EncodeMatchesScalarAtEveryLevel)
+{
+    namespace simd = artist::common::simd;
+    std::vector<float> values = sampleValues();
+    values.resize(values.size() / 12 * 12);
+    for (GLenum glType : {GL_HALF_FLOAT, GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT, GL_INT_2_10_10_10_REV})
+    {
+        // Arrange
+        const std::size_t size = values.size() / 3 * layout::encodedStride(glType, 3);
+        std::vector<std::byte> expected(size);
+        simd::setSimdLevel(simd::SimdLevel::Scalar);
+        layout::encode(values, glType, 3, expected);
+
+        for (simd::SimdLevel level : {simd::SimdLevel::Sse41, simd::SimdLevel::Avx2})
+        {
+            std::vector<std::byte> actual(size);
+            simd::setSimdLevel(level);
+
+            // Act
+            layout::encode(values, glType, 3, actual);
+
+            // Assert
+            ASSERT_EQ(actual, expected) << "type " << glType << ", level " << static_cast<int>(level);
+        }
+    }
+    simd::setSimdLevel(simd::SimdLevel::Avx2);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <glm/glm.hpp>
+#include <graphic/opengl/layout/VertexLayout.hpp>
+
+namespace layout = artist::graphic::opengl::layout;
+
+struct LayoutTestVertex
+{
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec2 uv;
+    GLubyte material;
+};
+ARTIST_VERTEX_LAYOUT(LayoutTestVertex, position, normal, uv, material)
+
+struct LayoutTestUnsupported
+{
+    bool flag;
+};
+
+class VertexLayoutTests : public ::testing::Test
+{
+};
+
+TEST_F(VertexLayoutTests, SeparateStreamLayout)
+{
+    // Arrange
+    using Layout = layout::VertexLayout<glm::vec4>;
+
+    // Assert
+    ASSERT_EQ(Layout::stride, sizeof(glm::vec4));
+    ASSERT_EQ(Layout::elements.size(), 1);
+    ASSERT_EQ(Layout::elements[0].components, 4);
+    ASSERT_EQ(Layout::elements[0].glType, GL_FLOAT);
+    ASSERT_EQ(Layout::elements[0].offset, 0);
+}
+
+TEST_F(VertexLayoutTests, InterleavedLayoutFromMembers)
+{
+    // Arrange
+    using Layout = layout::VertexLayout<LayoutTestVertex>;
+
+    // Assert
+    ASSERT_EQ(Layout::stride, sizeof(LayoutTestVertex));
+    ASSERT_EQ(Layout::elements.size(), 4);
+    ASSERT_STREQ(Layout::elements[1].name, "normal");
+    ASSERT_EQ(Layout::elements[1].components, 3);
+    ASSERT_EQ(Layout::elements[1].offset, offsetof(LayoutTestVertex, normal));
+    ASSERT_EQ(Layout::elements[2].components, 2);
+    ASSERT_EQ(Layout::elements[2].offset, offsetof(LayoutTestVertex, uv));
+    ASSERT_EQ(Layout::elements[3].glType, GL_UNSIGNED_BYTE);
+    ASSERT_EQ(Layout::elements[3].offset, offsetof(LayoutTestVertex, material));
+}
+
+TEST_F(VertexLayoutTests, FindElementByName)
+{
+    // Act
+    const layout::VertexElement *uv = layout::findElement<LayoutTestVertex>("uv");
+    const layout::VertexElement *missing = layout::findElement<LayoutTestVertex>("tangent");
+    const layout::VertexElement *single = layout::findElement<glm::vec2>("anything");
+
+    // Assert
+    ASSERT_NE(uv, nullptr);
+    ASSERT_EQ(uv->offset, offsetof(LayoutTestVertex, uv));
+    ASSERT_EQ(missing, nullptr);
+    ASSERT_NE(single, nullptr);
+    ASSERT_EQ(single->components, 2);
+}
+
+TEST_F(VertexLayoutTests, UnsupportedTypesAreRejected)
+{
+    static_assert(layout::HasVertexLayout<LayoutTestVertex>);
+    static_assert(layout::HasVertexLayout<GLfloat>);
+    static_assert(!layout::HasVertexLayout<LayoutTestUnsupported>);
+}
+
+TEST_F(VertexLayoutTests, FetchFollowsComponentType)
+{
+    // Arrange
+    using Layout = layout::VertexLayout<LayoutTestVertex>;
+
+    // Assert
+    ASSERT_EQ(Layout::elements[0].fetch, layout::VertexFetch::Float);
+    ASSERT_EQ(Layout::elements[3].fetch, layout::VertexFetch::Integer);
+    ASSERT_EQ(layout::VertexLayout<glm::ivec4>::elements[0].fetch, layout::VertexFetch::Integer);
+    ASSERT_EQ(layout::VertexLayout<glm::dvec3>::elements[0].fetch, layout::VertexFetch::Double);
+    ASSERT_EQ(layout::defaultFetch(GL_UNSIGNED_BYTE, true), layout::VertexFetch::Float);
+    ASSERT_EQ(layout::defaultFetch(GL_SHORT, false), layout::VertexFetch::Integer);
+    ASSERT_EQ(layout::defaultFetch(GL_HALF_FLOAT, false), layout::VertexFetch::Float);
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+#include <common/simd/CpuFeatures.hpp>
+#include <graphic/opengl/layout/VertexTranscoding.hpp>
+
+namespace layout = artist::graphic::opengl::layout;
+namespace simd = artist::common::simd;
+
+struct TranscodingTestVertex
+{
+    glm::vec3 position;
+    glm::vec2 uv;
+    glm::vec4 color;
+};
+ARTIST_VERTEX_LAYOUT(TranscodingTestVertex, position, uv, color)
+
+namespace
+{
+    constexpr std::uint32_t SENTINEL = 0xdeadbeef;
+
+    // Arbitrary bit patterns, NaN payloads and denormals included, so any conversion would show
+    std::vector<std::vector<float>> randomStreams(std::size_t streams, std::size_t count)
+    {
+        std::mt19937 random(static_cast<std::uint32_t>(streams * 1000 + count));
+        std::vector<std::vector<float>> values(streams, std::vector<float>(count));
+        for (auto &stream : values)
+        {
+            for (float &value : stream)
+            {
+                value = std::bit_cast<float>(static_cast<std::uint32_t>(random()));
+            }
+        }
+        return values;
+    }
+
+    std::vector<const float *> pointers(const std::vector<std::vector<float>> &streams)
+    {
+        std::vector<const float *> result;
+        for (const auto &stream : streams)
+        {
+            result.push_back(stream.data());
+        }
+        return result;
+    }
+
+    std::vector<float> sentinels(std::size_t count)
+    {
+        return std::vector<float>(count, std::bit_cast<float>(SENTINEL));
+    }
+
+    const std::vector<simd::SimdLevel> LEVELS{simd::SimdLevel::Scalar, simd::SimdLevel::Sse41, simd::SimdLevel::Avx2};
+}
+
+class VertexTranscodingTests : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        simd::setSimdLevel(simd::SimdLevel::Avx2);
+    }
+};
+
+TEST_F(VertexTranscodingTests, Interleave_MatchScalarBitForBit)
+{
+    for (simd::SimdLevel level : LEVELS)
+    {
+        simd::setSimdLevel(level);
+        for (std::size_t components = 1; components <= 4; ++components)
+        {
+            for (std::size_t stride : {components, components + 1, std::size_t{12}})
+            {
+                for (std::size_t count : {std::size_t{0}, std::size_t{3}, std::size_t{8}, std::size_t{37}})
+                {
+                    // Arrange
+                    auto streams = randomStreams(components, count);
+                    auto input = pointers(streams);
+                    std::vector<float> expected = sentinels(count * stride + 1);
+                    std::vector<float> actual = sentinels(count * stride + 1);
+                    layout::scalar::interleave(input, 0, count, expected.data(), stride);
+
+                    // Act
+                    layout::interleave(input, count, actual.data(), stride);
+
+                    // Assert
+                    ASSERT_EQ(std::memcmp(actual.data(), expected.data(), actual.size() * sizeof(float)), 0)
+                        << "level " << static_cast<int>(level) << ", " << components << " components, stride " << stride << ", " << count << " vertices";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(VertexTranscodingTests, Deinterleave_MatchScalarBitForBit)
+{
+    for (simd::SimdLevel level : LEVELS)
+    {
+        simd::setSimdLevel(level);
+        for (std::size_t components = 1; components <= 4; ++components)
+        {
+            for (std::size_t stride : {components, components + 1, std::size_t{12}})
+            {
+                for (std::size_t count : {std::size_t{0}, std::size_t{3}, std::size_t{8}, std::size_t{37}})
+                {
+                    // Arrange
+                    auto interleaved = randomStreams(1, count * stride)[0];
+                    std::vector<std::vector<float>> expected(components, sentinels(count + 1));
+                    std::vector<std::vector<float>> actual(components, sentinels(count + 1));
+                    std::vector<float *> expectedPointers;
+                    std::vector<float *> actualPointers;
+                    for (std::size_t c = 0; c < components; ++c)
+                    {
+                        expectedPointers.push_back(expected[c].data());
+                        actualPointers.push_back(actual[c].data());
+                    }
+                    layout::scalar::deinterleave(interleaved.data(), stride, 0, count, expectedPointers);
+
+                    // Act
+                    layout::deinterleave(interleaved.data(), stride, count, actualPointers);
+
+                    // Assert
+                    for (std::size_t c = 0; c < components; ++c)
+                    {
+                        ASSERT_EQ(std::memcmp(actual[c].data(), expected[c].data(), actual[c].size() * sizeof(float)), 0)
+                            << "level " << static_cast<int>(level) << ", " << components << " components, stride " << stride << ", " << count << " vertices";
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(VertexTranscodingTests, InterleaveVertices_RoundTripThroughLayout)
+{
+    // Arrange
+    constexpr std::size_t count = 21;
+    auto streams = randomStreams(9, count);
+    std::vector<TranscodingTestVertex> vertices(count);
+    std::vector<std::vector<float>> restored(9, std::vector<float>(count));
+    std::vector<float *> restoredPointers;
+    for (auto &stream : restored)
+    {
+        restoredPointers.push_back(stream.data());
+    }
+
+    // Act
+    layout::interleaveVertices<TranscodingTestVertex>(pointers(streams), count, std::as_writable_bytes(std::span(vertices)));
+    layout::deinterleaveVertices<TranscodingTestVertex>(std::as_bytes(std::span(vertices)), count, restoredPointers);
+
+    // Assert
+    ASSERT_EQ(std::bit_cast<std::uint32_t>(vertices[5].uv[1]), std::bit_cast<std::uint32_t>(streams[4][5]));
+    ASSERT_EQ(std::bit_cast<std::uint32_t>(vertices[20].color[3]), std::bit_cast<std::uint32_t>(streams[8][20]));
+    for (std::size_t c = 0; c < streams.size(); ++c)
+    {
+        ASSERT_EQ(std::memcmp(restored[c].data(), streams[c].data(), count * sizeof(float)), 0);
+    }
+}
+
+TEST_F(VertexTranscodingTests, InterleaveVertices_ThrowOnStreamCountMismatch)
+{
+    // Arrange
+    auto streams = randomStreams(5, 4);
+    std::vector<TranscodingTestVertex> vertices(4);
+
+    // Act & Assert
+    ASSERT_THROW(layout::interleaveVertices<TranscodingTestVertex>(pointers(streams), 4, std::as_writable_bytes(std::span(vertices))), std::invalid_argument);
+}
+
+TEST_F(VertexTranscodingTests, Interleave_ThrowWhenStrideIsTooSmall)
+{
+    // Arrange
+    auto streams = randomStreams(3, 4);
+    std::vector<float> output(8);
+
+    // Act & Assert
+    ASSERT_THROW(layout::interleave(pointers(streams), 4, output.data(), 2), std::invalid_argument);
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <graphic/opengl/mesh/GltfImporter.hpp>
+#include <TestUtils.hpp>
+
+namespace mesh = artist::graphic::opengl::mesh;
+using artist::common::thread::ThreadPool;
+using artist::test::utils::expectSpecificError;
+
+struct GltfTestVertex
+{
+    glm::vec3 position;
+    glm::vec2 texcoord_0;
+    glm::vec3 normal;
+};
+ARTIST_VERTEX_LAYOUT(GltfTestVertex, position, texcoord_0, normal)
+
+class GltfImporterTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Three vertices interleaved as float position + normalized unsigned short texcoord, then byte indices
+        const float positions[3][3] = {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}};
+        const std::uint16_t texcoords[3][2] = {{0, 0}, {65535, 0}, {0, 65535}};
+        for (int i = 0; i < 3; ++i)
+        {
+            append(positions[i], sizeof(positions[i]));
+            append(texcoords[i], sizeof(texcoords[i]));
+        }
+        const std::uint8_t indices[4] = {0, 1, 2, 0};
+        append(indices, sizeof(indices));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    void append(const void *data, std::size_t size)
+    {
+        const auto *bytes = static_cast<const std::byte *>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    std::string document(const std::string &bufferUri, const std::string &indexCount = "3") const
+    {
+        return R"({"asset": {"version": "2.0"},
+            "buffers": [{)" + bufferUri + R"("byteLength": )" + std::to_string(m_buffer.size()) + R"(}],
+            "bufferViews": [{"buffer": 0, "byteLength": 48, "byteStride": 16}, {"buffer": 0, "byteOffset": 48, "byteLength": 4}],
+            "accessors": [
+                {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3"},
+                {"bufferView": 0, "byteOffset": 12, "componentType": 5123, "normalized": true, "count": 3, "type": "VEC2"},
+                {"bufferView": 1, "componentType": 5121, "count": )" + indexCount + R"(, "type": "SCALAR"}],
+            "meshes": [{"name": "triangle", "primitives": [{"attributes": {"POSITION": 0, "TEXCOORD_0": 1}, "indices": 2}]}]})";
+    }
+
+    std::string base64() const
+    {
+        static constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string text;
+        for (std::size_t i = 0; i < m_buffer.size(); i += 3)
+        {
+            std::uint32_t bits = std::to_integer<std::uint32_t>(m_buffer[i]) << 16;
+            bits |= i + 1 < m_buffer.size() ? std::to_integer<std::uint32_t>(m_buffer[i + 1]) << 8 : 0;
+            bits |= i + 2 < m_buffer.size() ? std::to_integer<std::uint32_t>(m_buffer[i + 2]) : 0;
+            text += ALPHABET[(bits >> 18) & 63];
+            text += ALPHABET[(bits >> 12) & 63];
+            text += i + 1 < m_buffer.size() ? ALPHABET[(bits >> 6) & 63] : '=';
+            text += i + 2 < m_buffer.size() ? ALPHABET[bits & 63] : '=';
+        }
+        return text;
+    }
+
+    void writeGltf(const std::string &text)
+    {
+        m_path = std::filesystem::temp_directory_path() / "artist_gltf_tests.gltf";
+        std::ofstream(m_path, std::ios::binary) << text;
+    }
+
+    void writeGlb(std::string text)
+    {
+        text.resize((text.size() + 3) / 4 * 4, ' ');
+        std::vector<std::byte> binary = m_buffer;
+        binary.resize((binary.size() + 3) / 4 * 4);
+        const std::uint32_t header[3] = {0x46546c67, 2, static_cast<std::uint32_t>(12 + 8 + text.size() + 8 + binary.size())};
+        const std::uint32_t jsonChunk[2] = {static_cast<std::uint32_t>(text.size()), 0x4e4f534a};
+        const std::uint32_t binChunk[2] = {static_cast<std::uint32_t>(binary.size()), 0x004e4942};
+        m_path = std::filesystem::temp_directory_path() / "artist_gltf_tests.glb";
+        std::ofstream out(m_path, std::ios::binary);
+        out.write(reinterpret_cast<const char *>(header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(jsonChunk), sizeof(jsonChunk));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        out.write(reinterpret_cast<const char *>(binChunk), sizeof(binChunk));
+        out.write(reinterpret_cast<const char *>(binary.data()), static_cast<std::streamsize>(binary.size()));
+    }
+
+    std::vector<std::byte> m_buffer;
+    std::filesystem::path m_path;
+};
+
+TEST_F(GltfImporterTests, ImportEmbeddedBuffer)
+{
+    // Arrange
+    writeGltf(document(R"("uri": "data:application/octet-stream;base64,)" + base64() + R"(", )"));
+    ThreadPool pool(2);
+
+    // Act
+    auto primitives = mesh::GltfImporter(m_path).importPrimitives<GltfTestVertex>(pool);
+
+    // Assert
+    ASSERT_EQ(primitives.size(), 1);
+    ASSERT_EQ(primitives[0].name, "triangle");
+    ASSERT_EQ(primitives[0].mode, GL_TRIANGLES);
+    ASSERT_EQ(primitives[0].vertices.size(), 3);
+    ASSERT_EQ(primitives[0].vertices[2].position.y, 2.0f);
+    ASSERT_EQ(primitives[0].vertices[1].texcoord_0.x, 1.0f);
+    ASSERT_EQ(primitives[0].vertices[2].texcoord_0.y, 1.0f);
+    ASSERT_EQ(primitives[0].vertices[1].normal.z, 0.0f);
+    ASSERT_EQ(primitives[0].indices, (std::vector<std::uint32_t>{0, 1, 2}));
+}
+
+TEST_F(GltfImporterTests, ImportBinaryContainer)
+{
+    // Arrange
+    writeGlb(document(""));
+    ThreadPool pool(2);
+
+    // Act
+    auto primitives = mesh::GltfImporter(m_path).importPrimitives<glm::vec3>(pool);
+
+    // Assert
+    ASSERT_EQ(primitives.size(), 1);
+    ASSERT_EQ(primitives[0].vertices[1].x, 1.0f);
+    ASSERT_EQ(primitives[0].vertices[2].y, 2.0f);
+    ASSERT_EQ(primitives[0].indices.size(), 3);
+}
+
+TEST_F(GltfImporterTests, ThrowOnIndexOutOfRange)
+{
+    // Arrange
+    m_buffer[48 + 1] = std::byte{7};
+    writeGlb(document(""));
+    ThreadPool pool(2);
+    mesh::GltfImporter importer(m_path);
+
+    // Act & Assert
+    expectSpecificError([&importer, &pool]()
+                        { importer.importPrimitives<GltfTestVertex>(pool); },
+                        std::runtime_error("ERROR::GLTF::INDEX_OUT_OF_RANGE"));
+}
+
+TEST_F(GltfImporterTests, ThrowOnAccessorOutOfView)
+{
+    // Arrange
+    writeGlb(document("", "5"));
+    ThreadPool pool(2);
+    mesh::GltfImporter importer(m_path);
+
+    // Act & Assert
+    expectSpecificError([&importer, &pool]()
+                        { importer.importPrimitives<GltfTestVertex>(pool); },
+                        std::runtime_error("ERROR::GLTF::ACCESSOR_OUT_OF_RANGE"));
+}
+
+TEST_F(GltfImporterTests, ThrowOnCountThatIsNotAnIndexInRange)
+{
+    ThreadPool pool(2);
+    for (const std::string count : {"-1", "1.5", "1e300", "2147483648"})
+    {
+        // Arrange
+        writeGlb(document("", count));
+        mesh::GltfImporter importer(m_path);
+
+        // Act & Assert
+        expectSpecificError([&importer, &pool]()
+                            { importer.importPrimitives<GltfTestVertex>(pool); },
+                            std::runtime_error("ERROR::GLTF::INVALID_INTEGER: count must be an integer in [0, 2147483647]"));
+    }
+}
+
+TEST_F(GltfImporterTests, ThrowOnPositionWithoutBufferView)
+{
+    // Arrange
+    const std::string bufferView = R"("bufferView": 0, )";
+    std::string text = document("");
+    text.erase(text.find(bufferView + R"("componentType": 5126)"), bufferView.size());
+    writeGlb(text);
+    ThreadPool pool(2);
+    mesh::GltfImporter importer(m_path);
+
+    // Act & Assert
+    expectSpecificError([&importer, &pool]()
+                        { importer.importPrimitives<GltfTestVertex>(pool); },
+                        std::runtime_error("ERROR::GLTF::POSITION_WITHOUT_BUFFER_VIEW"));
+}
+
+TEST_F(GltfImporterTests, ThrowOnRemoteBuffer)
+{
+    // Arrange
+    writeGltf(document(R"("uri": "https://example.com/scene.bin", )"));
+
+    // Act & Assert
+    expectSpecificError([this]()
+                        { mesh::GltfImporter importer(m_path); },
+                        std::runtime_error("ERROR::GLTF::REMOTE_URI_NOT_SUPPORTED"));
+}
@@ -0,0 +1,109 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/mesh/LodMesh.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace mesh = artist::graphic::opengl::mesh;
+namespace geometry = artist::graphic::geometry;
+using artist::graphic::opengl::buffer::BufferArena;
+using artist::graphic::opengl::context::OpenGLPassContext;
+using artist::test::utils::expectSpecificError;
+
+class LodMeshTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault(::testing::SetArgPointee<1>(5));
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    std::vector<geometry::LodLevel> m_chain{{{0, 1, 2, 2, 1, 3}, 0.0f}, {{0, 1, 3}, 0.5f}};
+};
+
+TEST_F(LodMeshTests, Upload_StoreLevelsInOneRange)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    std::vector<std::uint16_t> uploaded;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_COPY_WRITE_BUFFER, 0, 18, ::testing::_))
+        .WillOnce([&uploaded](GLenum, GLintptr, GLsizeiptr size, const GLvoid *data)
+                  { uploaded.assign(static_cast<const std::uint16_t *>(data), static_cast<const std::uint16_t *>(data) + size / 2); });
+
+    // Act
+    mesh::LodMesh lods = mesh::uploadLodChain(m_chain, 4, arena);
+
+    // Assert
+    ASSERT_EQ(uploaded, (std::vector<std::uint16_t>{0, 1, 2, 2, 1, 3, 0, 1, 3}));
+    ASSERT_EQ(lods.levels.size(), 2);
+    ASSERT_EQ(lods.levels[1].firstIndex, 6);
+    ASSERT_EQ(lods.levels[1].count, 3);
+    ASSERT_EQ(lods.levels[1].error, 0.5f);
+}
+
+TEST_F(LodMeshTests, Draw_SelectLevelFromProjectedError)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::LodMesh lods = mesh::uploadLodChain(m_chain, 4, arena);
+    OpenGLPassContext pass;
+    lods.attach(pass);
+    pass.setLodProjection({100.0f, 1.0f});
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDrawElements_mock(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, reinterpret_cast<const void *>(0))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDrawElements_mock(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, reinterpret_cast<const void *>(12))).Times(1);
+
+    // Act
+    std::size_t near = lods.draw(pass, 10.0f);
+    std::size_t far = lods.draw(pass, 100.0f);
+
+    // Assert
+    ASSERT_EQ(near, 0);
+    ASSERT_EQ(far, 1);
+    ASSERT_EQ(pass.getIndexBuffer(), lods.indices);
+}
+
+TEST_F(LodMeshTests, Draw_UseSourceWithoutProjection)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::LodMesh lods = mesh::uploadLodChain(m_chain, 4, arena);
+    OpenGLPassContext pass;
+    lods.attach(pass);
+
+    // Act
+    std::size_t level = lods.draw(pass, 1000.0f);
+
+    // Assert
+    ASSERT_EQ(level, 0);
+}
+
+TEST_F(LodMeshTests, Draw_ThrowWhenNotAttached)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::LodMesh lods = mesh::uploadLodChain(m_chain, 4, arena);
+    OpenGLPassContext pass;
+
+    // Act & Assert
+    expectSpecificError([&lods, &pass]()
+                        { lods.draw(pass, 1.0f); },
+                        std::runtime_error("ERROR::LOD_MESH::NOT_ATTACHED"));
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <graphic/opengl/mesh/MeshFile.hpp>
+#include <TestUtils.hpp>
+
+namespace mesh = artist::graphic::opengl::mesh;
+using artist::test::utils::expectSpecificError;
+
+struct MeshTestVertex
+{
+    glm::vec3 position;
+    glm::vec2 uv;
+};
+ARTIST_VERTEX_LAYOUT(MeshTestVertex, position, uv)
+
+class MeshFileTests : public ::testing::Test
+{
+protected:
+    static std::vector<std::byte> write(std::span<const MeshTestVertex> vertices, std::span<const std::uint32_t> indices)
+    {
+        std::ostringstream out(std::ios::binary);
+        mesh::writeMesh<MeshTestVertex>(out, vertices, indices);
+        const std::string bytes = out.str();
+        std::vector<std::byte> file(bytes.size());
+        std::memcpy(file.data(), bytes.data(), bytes.size());
+        return file;
+    }
+
+    std::vector<MeshTestVertex> m_vertices{{{0, 0, 0}, {0, 0}}, {{1, 0, 0}, {1, 0}}, {{0, 1, 0}, {0, 1}}, {{1, 1, 0}, {1, 1}}};
+    std::vector<std::uint32_t> m_indices{0, 1, 2, 2, 1, 3};
+};
+
+TEST_F(MeshFileTests, WriteAndParse_RoundTrip)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+
+    // Act
+    mesh::MeshView view = mesh::parseMesh(file);
+
+    // Assert
+    ASSERT_EQ(view.header.vertexCount, 4);
+    ASSERT_EQ(view.header.vertexStride, sizeof(MeshTestVertex));
+    ASSERT_EQ(view.header.indexType, GL_UNSIGNED_SHORT);
+    ASSERT_EQ(view.header.vertexOffset % mesh::BLOB_ALIGNMENT, 0);
+    ASSERT_EQ(view.header.indexOffset % mesh::BLOB_ALIGNMENT, 0);
+    ASSERT_EQ(view.elements.size(), 2);
+    ASSERT_EQ(view.elements[1].getName(), "uv");
+    ASSERT_EQ(view.elements[1].components, 2);
+    ASSERT_EQ(view.elements[1].offset, offsetof(MeshTestVertex, uv));
+    ASSERT_EQ(std::memcmp(view.vertices.data(), m_vertices.data(), view.vertices.size()), 0);
+    ASSERT_EQ(view.indices.size(), m_indices.size() * sizeof(std::uint16_t));
+    ASSERT_EQ(reinterpret_cast<const std::uint16_t *>(view.indices.data())[5], 3);
+}
+
+TEST_F(MeshFileTests, Parse_BlobsPointIntoFile)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+
+    // Act
+    mesh::MeshView view = mesh::parseMesh(file);
+
+    // Assert
+    ASSERT_EQ(view.vertices.data(), file.data() + view.header.vertexOffset);
+    ASSERT_EQ(view.indices.data(), file.data() + view.header.indexOffset);
+}
+
+TEST_F(MeshFileTests, Parse_NonIndexedMesh)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, {});
+
+    // Act
+    mesh::MeshView view = mesh::parseMesh(file);
+
+    // Assert
+    ASSERT_EQ(view.header.indexType, 0);
+    ASSERT_TRUE(view.indices.empty());
+}
+
+TEST_F(MeshFileTests, FindElement_ByName)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    mesh::MeshView view = mesh::parseMesh(file);
+
+    // Assert
+    ASSERT_EQ(view.findElement("uv"), &view.elements[1]);
+    ASSERT_EQ(view.findElement("normal"), nullptr);
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnBadMagic)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    file[0] = std::byte{'X'};
+
+    // Act & Assert
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::BAD_MAGIC"));
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnTruncatedFile)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    file.resize(file.size() - 1);
+
+    // Act & Assert
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::TRUNCATED"));
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnZeroStride)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    mesh::MeshFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    header.vertexStride = 0;
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    // Act & Assert
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::INVALID_HEADER"));
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnCountsOverflowingTheBlobSize)
+{
+    // Arrange: 2^62 vertices of 20 bytes wrap around to a size of 0
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    mesh::MeshFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    header.vertexCount = std::uint64_t{1} << 62;
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    // Act & Assert
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::TOO_LARGE: The vertex blob has 4611686018427387904 entries, more than a draw call can address"));
+
+    header.vertexCount = m_vertices.size();
+    header.indexCount = 0x80000000;
+    std::memcpy(file.data(), &header, sizeof(header));
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::TOO_LARGE: The index blob has 2147483648 entries, more than a draw call can address"));
+
+    header.indexCount = 0x7fffffff;
+    std::memcpy(file.data(), &header, sizeof(header));
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::TRUNCATED"));
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnInvalidElement)
+{
+    // Arrange: position is a vec3 at offset 0, uv a vec2 at offset 12, in vertices of 20 bytes
+    const std::vector<std::byte> valid = write(m_vertices, m_indices);
+    const std::size_t uv = sizeof(mesh::MeshFileHeader) + sizeof(mesh::MeshFileElement);
+    auto withElement = [&valid, uv](auto change)
+    {
+        std::vector<std::byte> file = valid;
+        mesh::MeshFileElement element;
+        std::memcpy(&element, file.data() + uv, sizeof(element));
+        change(element);
+        std::memcpy(file.data() + uv, &element, sizeof(element));
+        return file;
+    };
+
+    // Act & Assert
+    for (const std::vector<std::byte> &file : {withElement([](mesh::MeshFileElement &element)
+                                                           { element.glType = 0x1234; }),
+                                               withElement([](mesh::MeshFileElement &element)
+                                                           { element.components = 3; }),
+                                               withElement([](mesh::MeshFileElement &element)
+                                                           { element.offset = 16; })})
+    {
+        expectSpecificError([&file]()
+                            { mesh::parseMesh(file); },
+                            std::runtime_error("ERROR::MESH_FILE::INVALID_ELEMENT: uv"));
+    }
+}
+
+TEST_F(MeshFileTests, Parse_ThrowOnIndexOutOfRange)
+{
+    // Arrange
+    std::vector<std::byte> file = write(m_vertices, m_indices);
+    const mesh::MeshView view = mesh::parseMesh(file);
+    const std::uint16_t index = 4;
+    std::memcpy(file.data() + view.header.indexOffset + 2 * sizeof(index), &index, sizeof(index));
+
+    // Act & Assert
+    expectSpecificError([&file]()
+                        { mesh::parseMesh(file); },
+                        std::runtime_error("ERROR::MESH_FILE::INDEX_OUT_OF_RANGE: Index 4 addresses one of 4 vertices"));
+}
+
+TEST_F(MeshFileTests, Write_ThrowOnIndexOutOfRange)
+{
+    // Arrange
+    std::vector<std::uint32_t> indices{0, 1, 4};
+
+    // Act & Assert
+    expectSpecificError([this, &indices]()
+                        { write(m_vertices, indices); },
+                        std::out_of_range("ERROR::MESH_FILE::INDEX_OUT_OF_RANGE"));
+}
+
+TEST_F(MeshFileTests, MeshFile_MapFromDisk)
+{
+    // Arrange
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "artist_mesh_file_tests.amsh";
+    {
+        std::ofstream out(path, std::ios::binary);
+        mesh::writeMesh<MeshTestVertex>(out, m_vertices, m_indices);
+    }
+
+    // Act
+    {
+        mesh::MeshFile file(path);
+
+        // Assert
+        ASSERT_EQ(file.getView().header.vertexCount, 4);
+        ASSERT_EQ(std::memcmp(file.getView().vertices.data(), m_vertices.data(), file.getView().vertices.size()), 0);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_F(MeshFileTests, MeshFile_ThrowOnMissingFile)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { mesh::MeshFile file(std::filesystem::temp_directory_path() / "artist_missing_mesh.amsh"); },
+                        std::runtime_error("ERROR::MAPPED_FILE::OPEN_FAILED"));
+}
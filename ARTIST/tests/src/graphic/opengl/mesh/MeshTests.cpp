@@ -0,0 +1,150 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/mesh/Mesh.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace mesh = artist::graphic::opengl::mesh;
+namespace context = artist::graphic::opengl::context;
+using artist::graphic::opengl::buffer::BufferArena;
+using artist::graphic::opengl::buffer::UploadQueue;
+using artist::test::utils::expectSpecificError;
+
+struct MeshLoadVertex
+{
+    glm::vec3 position;
+    glm::vec3 normal;
+};
+ARTIST_VERTEX_LAYOUT(MeshLoadVertex, position, normal)
+
+class MeshTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_))
+            .WillByDefault([lastBuffer = GLuint{0}](GLsizei, GLuint *buffer) mutable
+                           { *buffer = ++lastBuffer; });
+        m_path = std::filesystem::temp_directory_path() / "artist_mesh_tests.amsh";
+        std::ofstream out(m_path, std::ios::binary);
+        mesh::writeMesh<MeshLoadVertex>(out, m_vertices, m_indices);
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+        std::filesystem::remove(m_path);
+    }
+
+    std::filesystem::path m_path;
+    std::vector<MeshLoadVertex> m_vertices{{{0, 0, 0}, {0, 0, 1}}, {{1, 0, 0}, {0, 0, 1}}, {{0, 1, 0}, {0, 0, 1}}};
+    std::vector<std::uint32_t> m_indices{0, 1, 2};
+};
+
+TEST_F(MeshTests, Load_UploadStraightFromMapping)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    auto file = std::make_shared<mesh::MeshFile>(m_path);
+    const mesh::MeshView &view = file->getView();
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_COPY_WRITE_BUFFER, 0, 3 * sizeof(MeshLoadVertex), view.vertices.data())).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_COPY_WRITE_BUFFER, 80, 6, view.indices.data())).Times(1);
+
+    // Act
+    mesh::Mesh loaded = mesh::loadMesh(file, arena);
+
+    // Assert
+    ASSERT_EQ(loaded.vertices->size, 3 * sizeof(MeshLoadVertex));
+    ASSERT_EQ(loaded.indices->getIndexType(), GL_UNSIGNED_SHORT);
+    ASSERT_EQ(loaded.indices->getCount(), 3);
+    ASSERT_EQ(loaded.indices->getBufferID(), loaded.vertices->bufferId);
+    ASSERT_EQ(loaded.ready.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+}
+
+TEST_F(MeshTests, Load_QueueUploadsFromMapping)
+{
+    // Arrange
+    std::vector<std::byte> staging(1024);
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock)
+        .WillByDefault(::testing::Return(staging.data()));
+    BufferArena arena(1024, 16);
+    UploadQueue uploads(1024, 512, false);
+    auto file = std::make_shared<mesh::MeshFile>(m_path);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock).Times(2);
+
+    // Act
+    mesh::Mesh loaded = mesh::loadMesh(file, arena, uploads);
+    uploads.stagePending();
+    uploads.process();
+
+    // Assert
+    ASSERT_EQ(std::memcmp(staging.data(), m_vertices.data(), 3 * sizeof(MeshLoadVertex)), 0);
+    ASSERT_EQ(loaded.indices->getCount(), 3);
+    ASSERT_EQ(loaded.ready.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+}
+
+TEST_F(MeshTests, Attach_FormatFromFileElements)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::Mesh loaded = mesh::loadMesh(std::make_shared<mesh::MeshFile>(m_path), arena);
+    context::OpenGLAttributeContext attribute;
+    attribute.setAttributeName("normal");
+
+    // Act
+    loaded.attach(attribute);
+
+    // Assert
+    ASSERT_EQ(attribute.getGLSize(), 3);
+    ASSERT_EQ(attribute.getGLType(), GL_FLOAT);
+    ASSERT_EQ(attribute.getStride(), sizeof(MeshLoadVertex));
+    ASSERT_EQ(attribute.getOffset(), offsetof(MeshLoadVertex, normal));
+    ASSERT_EQ(attribute.getBufferID(), loaded.vertices->bufferId);
+    ASSERT_EQ(attribute.getBufferOffset(), loaded.vertices->offset);
+}
+
+TEST_F(MeshTests, Attach_ThrowOnUnknownElement)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::Mesh loaded = mesh::loadMesh(std::make_shared<mesh::MeshFile>(m_path), arena);
+    context::OpenGLAttributeContext attribute;
+    attribute.setAttributeName("tangent");
+
+    // Act & Assert
+    expectSpecificError([&loaded, &attribute]()
+                        { loaded.attach(attribute); },
+                        std::runtime_error("ERROR::MESH::ELEMENT_NOT_FOUND"));
+}
+
+TEST_F(MeshTests, Free_ReleaseRanges)
+{
+    // Arrange
+    BufferArena arena(1024, 16);
+    mesh::Mesh loaded = mesh::loadMesh(std::make_shared<mesh::MeshFile>(m_path), arena);
+
+    // Act
+    mesh::freeMesh(loaded, arena);
+
+    // Assert
+    ASSERT_EQ(arena.getAllocationCount(), 0);
+    ASSERT_EQ(loaded.file, nullptr);
+}
+
+#endif
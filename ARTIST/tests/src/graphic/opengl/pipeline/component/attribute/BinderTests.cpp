@@ -43,7 +43,7 @@ TEST_F(AttributeBinderTests, BindAttributeTest_createBuffer)
                                     { *buffer = 42; }));
 
     // Act
-    ASSERT_NO_THROW(binder->on(attributeContext));
+    ASSERT_NO_THROW(binder->on(*attributeContext));
 
     // Assert
     ASSERT_EQ(attributeContext->getBufferID(), 42);
@@ -64,21 +64,10 @@ TEST_F(AttributeBinderTests, BindAttributeTest_bindBuffer)
         .Times(1);
 
     // Act
-    ASSERT_NO_THROW(binder->on(attributeContext));
+    ASSERT_NO_THROW(binder->on(*attributeContext));
 
     // Assert
     ASSERT_EQ(attributeContext->getBufferID(), 42);
 }
 
-TEST_F(AttributeBinderTests, BindAttributeTest_invalidContext)
-{
-    // Arrange
-    auto binder = std::make_shared<attribute::OpenGLBinder<Classic>>();
-
-    // Act & Assert
-    expectSpecificError([&binder]()
-                        { binder->on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::ATTRIBUTE::SET::NON_OPENGL_CONTEXT")));
-}
-
 #endif // __mock_gl__
\ No newline at end of file
@@ -2,9 +2,16 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <vector>
+#include <glm/glm.hpp>
 #include <opengl/glFunctionMock.hpp>
 #include <graphic/Api.hpp>
+#include <graphic/opengl/buffer/StreamingBuffer.hpp>
+#include <graphic/opengl/buffer/UploadQueue.hpp>
+#include <graphic/opengl/buffer/UsageTracker.hpp>
 #include <graphic/opengl/context/AttributeContext.hpp>
 #include <graphic/opengl/pipeline/component/attribute/Setter.hpp>
 #include <common/exception/TraceableException.hpp>
@@ -17,6 +24,13 @@ namespace attribute = artist::graphic::opengl::pipeline::component::attribute;
 
 using artist::test::utils::expectSpecificError;
 
+struct SetterTestVertex
+{
+    glm::vec3 position;
+    glm::vec2 uv;
+};
+ARTIST_VERTEX_LAYOUT(SetterTestVertex, position, uv)
+
 class AttributeSetterTests : public ::testing::Test
 {
 protected:
@@ -36,39 +50,473 @@ TEST_F(AttributeSetterTests, SetAttributeTest_CallBufferData)
     attribute->setValue(attrValue);
 
     // Expected call
-    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, sizeof(attrValue.get()), attrValue.get(), GL_STATIC_DRAW))
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, sizeof(float), attrValue.get(), GL_STATIC_DRAW))
         .Times(1);
 
     // Act
-    attribute::OpenGLSetter<float>::on(attribute);
+    attribute::OpenGLSetter<float>::on(*attribute);
 }
 
-TEST_F(AttributeSetterTests, SetAttributeTest_CallVertexAttribPointer)
+TEST_F(AttributeSetterTests, SetAttributeTest_RecordFormatWithoutVertexAttribPointer)
 {
     // Arrange
     std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
     attribute->setBufferID(1);
     attribute->setGLUsage(GL_STATIC_DRAW);
     attribute->setAttributeID(1);
-    attribute->setGLSize(1);
-    attribute->setGLType(GL_FLOAT);
     std::shared_ptr<float> attrValue = std::make_shared<float>(1.0f);
     attribute->setValue(attrValue);
 
+    // Expected call: the format is specified once by the pass vertex array object
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock).Times(0);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getGLSize(), 1);
+    ASSERT_EQ(attribute->getGLType(), GL_FLOAT);
+    ASSERT_EQ(attribute->getStride(), sizeof(float));
+    ASSERT_EQ(attribute->getOffset(), 0);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_UploadWholeArray)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLUsage(GL_STATIC_DRAW);
+    attribute->setAttributeID(2);
+    std::vector<glm::vec3> positions(4);
+    attribute->setValues<glm::vec3>(positions);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 4 * sizeof(glm::vec3), positions.data(), GL_STATIC_DRAW))
+        .Times(1);
+
+    // Act
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getGLSize(), 3);
+    ASSERT_EQ(attribute->getStride(), sizeof(glm::vec3));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_InterleavedLayoutUsesElementOffset)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLUsage(GL_STATIC_DRAW);
+    attribute->setAttributeID(3);
+    attribute->setAttributeName("uv");
+    std::vector<SetterTestVertex> vertices(3);
+    attribute->setValues<SetterTestVertex>(vertices);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 3 * sizeof(SetterTestVertex), vertices.data(), GL_STATIC_DRAW))
+        .Times(1);
+
+    // Act
+    attribute::OpenGLSetter<SetterTestVertex>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getGLSize(), 2);
+    ASSERT_EQ(attribute->getGLType(), GL_FLOAT);
+    ASSERT_EQ(attribute->getStride(), sizeof(SetterTestVertex));
+    ASSERT_EQ(attribute->getOffset(), offsetof(SetterTestVertex, uv));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_PartialUpdateUploadsDirtyRanges)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    std::vector<float> values(1000, 0.0f);
+    attribute->setValues<float>(values);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(1);
+    attribute::OpenGLSetter<float>::on(*attribute);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    values[10] = 1.0f;
+    values[11] = 1.0f;
+    values[500] = 1.0f;
+    attribute->updateValues<float>(values, 10, 1);
+    attribute->updateValues<float>(values, 11, 1);
+    attribute->updateValues<float>(values, 500, 1);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 10 * sizeof(float), 2 * sizeof(float), &values[10]))
+        .Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 500 * sizeof(float), sizeof(float), &values[500]))
+        .Times(1);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Assert
+    ASSERT_TRUE(attribute->getDirtyRanges().empty());
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_FullRewriteOrphansBuffer)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLUsage(GL_DYNAMIC_DRAW);
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(1);
+    attribute::OpenGLSetter<float>::on(*attribute);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    attribute->setValues<float>(values);
+
+    // Expected call
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 16 * sizeof(float), nullptr, GL_DYNAMIC_DRAW))
+        .Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 0, 16 * sizeof(float), values.data()))
+        .Times(1);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_ResizeReallocatesBuffer)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(1);
+    attribute::OpenGLSetter<float>::on(*attribute);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    values.resize(32, 0.0f);
+    attribute->updateValues<float>(values, 16, 16);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 32 * sizeof(float), values.data(), GL_STATIC_DRAW))
+        .Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock).Times(0);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getBufferSize(), 32 * sizeof(float));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_WriteIntoArenaAllocation)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setAllocation(std::make_shared<artist::graphic::opengl::buffer::BufferAllocation>(artist::graphic::opengl::buffer::BufferAllocation{3, 256, 64}));
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+
     // Expected call
-    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock(1, 1, GL_FLOAT, GL_FALSE, sizeof(attrValue.get()), (void *)nullptr))
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 256, 16 * sizeof(float), values.data()))
         .Times(1);
 
     // Act
-    attribute::OpenGLSetter<float>::on(attribute);
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getBufferID(), 3);
+    ASSERT_EQ(attribute->getBufferOffset(), 256);
 }
 
-TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenContextIsNullptr)
+TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenAllocationIsTooSmall)
 {
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setAllocation(std::make_shared<artist::graphic::opengl::buffer::BufferAllocation>(artist::graphic::opengl::buffer::BufferAllocation{3, 0, 16}));
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+
+    // Act & Assert
+    expectSpecificError([&]()
+                        { attribute::OpenGLSetter<float>::on(*attribute); },
+                        std::runtime_error("ERROR::ATTRIBUTE::SET::ALLOCATION_TOO_SMALL: 64 bytes do not fit in an allocation of 16 bytes"));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_QueueDirtyRangesOnUploadQueue)
+{
+    // Arrange
+    std::vector<std::byte> staging(256);
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock).WillByDefault(::testing::Return(staging.data()));
+    auto uploads = std::make_shared<artist::graphic::opengl::buffer::UploadQueue>(256, 64, false);
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setUploadQueue(uploads);
+    std::vector<float> values(8, 1.0f);
+    attribute->setValues<float>(values);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 8 * sizeof(float), nullptr, GL_STATIC_DRAW)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCopyBufferSubData_mock(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, 8 * sizeof(float))).Times(1);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+    values.assign(8, 2.0f); // The queued copy no longer depends on the values
+    uploads->stagePending();
+    uploads->process();
+
+    // Assert
+    ASSERT_TRUE(attribute->getUploadCompletion().valid());
+    ASSERT_EQ(std::memcmp(staging.data(), std::vector<float>(8, 1.0f).data(), 8 * sizeof(float)), 0);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_MigrateToStreamingWhenRewrittenEveryUpload)
+{
+    // Arrange
+    std::vector<std::byte> mapped(3 * 64);
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_)).WillByDefault(::testing::SetArgPointee<1>(8));
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glMapBufferRange_mock).WillByDefault(::testing::Return(mapped.data()));
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    std::vector<float> values(16, 0.0f);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferStorage_mock(GL_ARRAY_BUFFER, 3 * 64, nullptr, artist::graphic::opengl::buffer::StreamingBuffer::STORAGE_FLAGS)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(::testing::AnyNumber());
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW)).Times(1);
+
+    // Act
+    for (std::size_t upload = 0; upload < artist::graphic::opengl::buffer::UsageTracker::WARM_UP_UPLOADS; ++upload)
+    {
+        values.assign(16, static_cast<float>(upload));
+        attribute->setValues<float>(values);
+        attribute::OpenGLSetter<float>::on(*attribute);
+    }
+
+    // Assert
+    ASSERT_EQ(attribute->getUpdateStrategy(), artist::graphic::opengl::buffer::UpdateStrategy::Streaming);
+    ASSERT_EQ(attribute->getGLUsage(), GL_STREAM_DRAW);
+    ASSERT_EQ(attribute->getBufferID(), 8);
+    ASSERT_EQ(attribute->getBufferOffset(), 0);
+    ASSERT_EQ(std::memcmp(mapped.data(), values.data(), 64), 0);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_MigrateToSubDataWhenPartiallyUpdated)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 16 * sizeof(float), values.data(), GL_DYNAMIC_DRAW)).Times(1);
+
+    // Act
+    for (std::size_t upload = 1; upload < artist::graphic::opengl::buffer::UsageTracker::WARM_UP_UPLOADS; ++upload)
+    {
+        attribute->updateValues<float>(values, upload, 1);
+        attribute::OpenGLSetter<float>::on(*attribute);
+    }
+
+    // Assert
+    ASSERT_EQ(attribute->getUpdateStrategy(), artist::graphic::opengl::buffer::UpdateStrategy::SubData);
+    ASSERT_EQ(attribute->getGLUsage(), GL_DYNAMIC_DRAW);
+    ASSERT_EQ(attribute->getBufferID(), 1);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_ReplaceImmutableBufferBeforeReleasingIt)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setUpdateStrategy(artist::graphic::opengl::buffer::UpdateStrategy::Immutable);
+    attribute->setBufferSize(16 * sizeof(float));
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+    const auto epoch = artist::graphic::opengl::buffer::BufferNames::getEpoch();
+
+    // Expected call
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenBuffers_mock(1, ::testing::_)).WillOnce(::testing::SetArgPointee<1>(9));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteBuffers_mock(1, ::testing::Pointee(1))).Times(1);
+
+    // Act
+    for (std::size_t upload = 0; upload < artist::graphic::opengl::buffer::UsageTracker::WARM_UP_UPLOADS; ++upload)
+    {
+        attribute->updateValues<float>(values, upload, 1);
+        attribute::OpenGLSetter<float>::on(*attribute);
+    }
+
+    // Assert
+    ASSERT_EQ(attribute->getUpdateStrategy(), artist::graphic::opengl::buffer::UpdateStrategy::SubData);
+    ASSERT_EQ(attribute->getBufferID(), 9);
+    auto released = artist::graphic::opengl::buffer::BufferNames::getReleasedSince(epoch);
+    ASSERT_TRUE(released.has_value());
+    ASSERT_EQ(std::vector<GLuint>(released->begin(), released->end()), std::vector<GLuint>{1});
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_MigrateToImmutableWhenRarelyUpdated)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    const auto past = artist::graphic::opengl::buffer::UsageTracker::Clock::now() - std::chrono::seconds(60);
+    for (std::size_t upload = 1; upload < artist::graphic::opengl::buffer::UsageTracker::WARM_UP_UPLOADS; ++upload)
+    {
+        attribute->getUsageTracker().record(past + std::chrono::seconds(5 * upload), 64, 64);
+    }
+    std::vector<float> values(16, 0.0f);
+    attribute->setValues<float>(values);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferStorage_mock(GL_ARRAY_BUFFER, 16 * sizeof(float), values.data(), GL_DYNAMIC_STORAGE_BIT)).Times(1);
+
+    // Act
+    attribute::OpenGLSetter<float>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getUpdateStrategy(), artist::graphic::opengl::buffer::UpdateStrategy::Immutable);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_KeepUsageHintWhenAdaptiveUsageIsDisabled)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setAdaptiveUsage(false);
+    std::vector<float> values(16, 0.0f);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferStorage_mock).Times(0);
+
+    // Act
+    for (std::size_t upload = 0; upload < 2 * artist::graphic::opengl::buffer::UsageTracker::WARM_UP_UPLOADS; ++upload)
+    {
+        attribute->setValues<float>(values);
+        attribute::OpenGLSetter<float>::on(*attribute);
+    }
+
+    // Assert
+    ASSERT_EQ(attribute->getUpdateStrategy(), artist::graphic::opengl::buffer::UpdateStrategy::Undecided);
+    ASSERT_EQ(attribute->getGLUsage(), GL_STATIC_DRAW);
+    ASSERT_EQ(attribute->getUsageTracker().getUploadCount(), 0);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_EncodeCompressedType)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLType(GL_BYTE);
+    std::vector<glm::vec3> normals{glm::vec3(1.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)};
+    attribute->setValues<glm::vec3>(normals);
+    std::vector<std::int8_t> uploaded;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 6, ::testing::_, GL_STATIC_DRAW))
+        .WillOnce([&uploaded](GLenum, GLsizeiptr size, const GLvoid *data, GLenum)
+                  { uploaded.assign(static_cast<const std::int8_t *>(data), static_cast<const std::int8_t *>(data) + size); });
+
+    // Act
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(uploaded, (std::vector<std::int8_t>{127, 0, -127, 0, 127, 0}));
+    ASSERT_EQ(attribute->getGLType(), GL_BYTE);
+    ASSERT_EQ(attribute->getGLSize(), 3);
+    ASSERT_TRUE(attribute->isNormalized());
+    ASSERT_EQ(attribute->getStride(), 3);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_EncodeOnlyDirtyVertices)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLType(GL_INT_2_10_10_10_REV);
+    std::vector<glm::vec3> normals(100, glm::vec3(0.0f, 0.0f, 1.0f));
+    attribute->setValues<glm::vec3>(normals);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 400, ::testing::_, GL_STATIC_DRAW)).Times(1);
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    normals[10] = glm::vec3(1.0f, 0.0f, 0.0f);
+    attribute->updateValues<glm::vec3>(normals, 10, 1);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 40, 4, attribute->getEncodedData().data() + 40))
+        .Times(1);
+
+    // Act
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getGLSize(), 4);
+    ASSERT_EQ(attribute->getStride(), 4);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_ReencodeAllVerticesWhenTypeOfSameStrideChanges)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLType(GL_HALF_FLOAT);
+    std::vector<glm::vec3> normals(100, glm::vec3(0.0f, 0.5f, 1.0f));
+    attribute->setValues<glm::vec3>(normals);
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    attribute->setGLType(GL_SHORT);
+    normals[10] = glm::vec3(1.0f, 0.0f, 0.0f);
+    attribute->updateValues<glm::vec3>(normals, 10, 1);
+    std::vector<std::byte> expected(600);
+    artist::graphic::opengl::layout::encode(std::span<const float>(&normals[0].x, 300), GL_SHORT, 3, expected);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferSubData_mock(GL_ARRAY_BUFFER, 0, 600, ::testing::_)).Times(1);
+
+    // Act
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(attribute->getEncodedData(), expected);
+    ASSERT_EQ(attribute->getEncodedType(), GL_SHORT);
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenElementIsMissing)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setAttributeName("normal");
+    std::vector<SetterTestVertex> vertices(3);
+    attribute->setValues<SetterTestVertex>(vertices);
+
+    // Act & Assert
+    expectSpecificError<std::runtime_error>([&]()
+                                            { attribute::OpenGLSetter<SetterTestVertex>::on(*attribute); },
+                                            artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::LAYOUT_ELEMENT_NOT_FOUND"));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionOnTypeMismatch)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    std::vector<glm::vec3> positions(2);
+    attribute->setValues<glm::vec3>(positions);
+    std::vector<glm::vec2> uvs(2);
+
     // Act & Assert
     expectSpecificError<std::runtime_error>([&]()
-                                            { attribute::OpenGLSetter<float>::on(nullptr); },
-                                            artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::NON_OPENGL_CONTEXT"));
+                                            { attribute->setValues<glm::vec2>(uvs); },
+                                            artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::TYPE_MISMATCH"));
 }
 
 TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenBufferIsNotSet)
@@ -78,8 +526,60 @@ TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenBufferIsNotSet)
 
     // Act & Assert
     expectSpecificError<std::runtime_error>([&]()
-                                            { attribute::OpenGLSetter<float>::on(attribute); },
+                                            { attribute::OpenGLSetter<float>::on(*attribute); },
                                             artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::BUFFER_ID_NOT_SET"));
 }
 
+TEST_F(AttributeSetterTests, SetAttributeTest_ThrowExceptionWhenAttachedToStreamingBuffer)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setStreamingRange(std::make_shared<artist::graphic::opengl::buffer::BufferAllocation>(artist::graphic::opengl::buffer::BufferAllocation{4, 16, 64}));
+    std::vector<float> values(4, 0.0f);
+    attribute->setValues<float>(values);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock).Times(0);
+
+    // Act & Assert
+    expectSpecificError<std::runtime_error>([&]()
+                                            { attribute::OpenGLSetter<float>::on(*attribute); },
+                                            artist::common::exception::TraceableException<std::runtime_error>("ERROR::ATTRIBUTE::SET::ATTACHED_TO_STREAMING_BUFFER: Clear the streaming range before setting values"));
+}
+
+TEST_F(AttributeSetterTests, SetAttributeTest_UploadVerticesInterleavedFromComponentArrays)
+{
+    // Arrange
+    std::shared_ptr<context::OpenGLAttributeContext> attribute = std::make_shared<context::OpenGLAttributeContext>();
+    attribute->setBufferID(1);
+    attribute->setGLUsage(GL_STATIC_DRAW);
+    std::vector<float> xs{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> ys{10.0f, 11.0f, 12.0f, 13.0f, 14.0f};
+    std::vector<float> zs{20.0f, 21.0f, 22.0f, 23.0f, 24.0f};
+    std::vector<const float *> components{xs.data(), ys.data(), zs.data()};
+    std::vector<glm::vec3> uploaded;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBufferData_mock(GL_ARRAY_BUFFER, 5 * sizeof(glm::vec3), ::testing::_, GL_STATIC_DRAW))
+        .WillOnce([&](GLenum, GLsizeiptr size, const void *data, GLenum)
+                  {
+                      uploaded.resize(static_cast<std::size_t>(size) / sizeof(glm::vec3));
+                      std::memcpy(uploaded.data(), data, static_cast<std::size_t>(size)); });
+
+    // Act
+    attribute->setComponents<glm::vec3>(components, 5);
+    attribute::OpenGLSetter<glm::vec3>::on(*attribute);
+
+    // Assert
+    ASSERT_EQ(uploaded.size(), 5);
+    for (std::size_t v = 0; v < uploaded.size(); ++v)
+    {
+        ASSERT_EQ(uploaded[v], glm::vec3(xs[v], ys[v], zs[v]));
+    }
+    expectSpecificError([&]()
+                        { attribute->setComponents<glm::vec3>(std::span<const float *const>(components).first(2), 5); },
+                        std::invalid_argument("ERROR::VERTEX_TRANSCODING::SIZE_MISMATCH: 2 streams for 3 components, 60 bytes for 5 vertices"));
+}
+
 #endif // __mock_gl__
\ No newline at end of file
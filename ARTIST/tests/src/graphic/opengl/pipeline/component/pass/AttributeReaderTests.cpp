@@ -42,7 +42,7 @@ TEST_F(AttributeReaderTests, ReadAttributes_CallGetProgramiv)
         .WillOnce(::testing::SetArgPointee<2>(numAttributes));
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLPassAttributeReader<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassAttributeReader<Classic>::on(*openglContext));
 }
 
 TEST_F(AttributeReaderTests, ReadAttributes_CallGetActiveAttribAndGetAttribLocation)
@@ -63,7 +63,7 @@ TEST_F(AttributeReaderTests, ReadAttributes_CallGetActiveAttribAndGetAttribLocat
         .Times(1);
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLPassAttributeReader<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassAttributeReader<Classic>::on(*openglContext));
 
     // Assert
     // Optionally check if the attributes are correctly added to the context
@@ -71,16 +71,6 @@ TEST_F(AttributeReaderTests, ReadAttributes_CallGetActiveAttribAndGetAttribLocat
     ASSERT_TRUE(openglContext->getAttributes().contains(mock::opengl::glFunctionMock::ATTRIBUTE_NAME));
 }
 
-TEST_F(AttributeReaderTests, ReadAttributes_NullContext)
-{
-    // Arrange
-
-    // Act & Assert
-    expectSpecificError([]()
-                        { pass::OpenGLPassAttributeReader<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>("ERROR::PASS::NON_OPENGL_CONTEXT"));
-}
-
 TEST_F(AttributeReaderTests, ReadAttributes_InvalidPassID)
 {
     // Arrange
@@ -88,7 +78,7 @@ TEST_F(AttributeReaderTests, ReadAttributes_InvalidPassID)
 
     // Act & Assert
     expectSpecificError([&openglContext]()
-                        { pass::OpenGLPassAttributeReader<Classic>::on(openglContext); },
+                        { pass::OpenGLPassAttributeReader<Classic>::on(*openglContext); },
                         artist::common::exception::TraceableException<std::runtime_error>("ERROR::PASS::INVALID_PROGRAM_ID"));
 }
 
@@ -14,6 +14,7 @@
 namespace api = artist::graphic::api;
 namespace mock = artist::mock;
 namespace context = artist::graphic::opengl::context;
+namespace layout = artist::graphic::opengl::layout;
 namespace pass = artist::graphic::opengl::pipeline::component::pass;
 using artist::graphic::opengl::profile::Pass::Classic;
 using MockShader = artist::mock::graphic::pipeline::MockShader<api::OpenGL>;
@@ -45,18 +46,28 @@ TEST_F(PassFreerTests, FreePassTest_validContext)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteProgram_mock(1)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
 
     // Assert
     ASSERT_EQ(openglContext->getPassID(), 0);
 }
 
-TEST_F(PassFreerTests, FreePassTest_nullContext)
+TEST_F(PassFreerTests, FreePassTest_deleteVertexArrays)
 {
     // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    openglContext->setPassID(1);
+    openglContext->addVertexArray({{{0, 7, 3, GL_FLOAT, GL_FALSE, 0, 0, layout::VertexFetch::Float}}}, 5);
 
-    // Act & Assert
-    EXPECT_THROW(pass::OpenGLPassFreer<Classic>::on(nullptr), std::runtime_error);
+    // Expect calls
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteVertexArrays_mock(1, ::testing::Pointee(5))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteProgram_mock(1)).Times(1);
+
+    // Act
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
+
+    // Assert
+    ASSERT_TRUE(openglContext->getVertexArrays().empty());
 }
 
 TEST_F(PassFreerTests, FreePassTest_noPassID)
@@ -65,7 +76,7 @@ TEST_F(PassFreerTests, FreePassTest_noPassID)
     auto openglContext = std::make_shared<context::OpenGLPassContext>(); // No pipeline ID set
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
     ASSERT_EQ(openglContext->getPassID(), 0); // Ensure pipeline ID remains 0
 }
 
@@ -82,7 +93,7 @@ TEST_F(PassFreerTests, FreePassTest_detachShaders)
     // ...
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
 }
 
 TEST_F(PassFreerTests, FreePassTest_deletePipeline)
@@ -95,7 +106,7 @@ TEST_F(PassFreerTests, FreePassTest_deletePipeline)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteProgram_mock(1)).Times(1);
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
 }
 
 TEST_F(PassFreerTests, FreePassTest_noShaders)
@@ -108,7 +119,7 @@ TEST_F(PassFreerTests, FreePassTest_noShaders)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDetachShader_mock(::testing::_, ::testing::_)).Times(0);
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassFreer<Classic>::on(*openglContext));
 }
 
 #endif // __mock_gl__
\ No newline at end of file
@@ -35,7 +35,7 @@ TEST_F(LoaderTests, LoadPassTest_validContext)
     auto openglContext = std::make_shared<context::OpenGLPassContext>();
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(*openglContext));
 
     // Assert
     ASSERT_EQ(openglContext->getPassID(), 1);
@@ -50,7 +50,7 @@ TEST_F(LoaderTests, LoadPassTest_createPipeline)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCreateProgram_mock()).Times(1);
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(*openglContext));
 }
 
 TEST_F(LoaderTests, LoadPassTest_linkPipeline)
@@ -62,16 +62,7 @@ TEST_F(LoaderTests, LoadPassTest_linkPipeline)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glLinkProgram_mock(1)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(openglContext));
-}
-
-TEST_F(LoaderTests, LoadPassTest_nullContext)
-{
-    // Arrange
-    // Act & Assert
-    expectSpecificError([]()
-                        { pass::OpenGLLoader<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::PROGRAM::NON_OPENGL_CONTEXT")));
+    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(*openglContext));
 }
 
 TEST_F(LoaderTests, LoadPassTest_pipelineCreationFailed)
@@ -85,7 +76,7 @@ TEST_F(LoaderTests, LoadPassTest_pipelineCreationFailed)
 
     // Act & Assert
     expectSpecificError([&openglContext]()
-                        { pass::OpenGLLoader<Classic>::on(openglContext); },
+                        { pass::OpenGLLoader<Classic>::on(*openglContext); },
                         artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::PROGRAM_CREATION_FAILED\nFailed to create shader pipeline.")));
 }
 
@@ -110,7 +101,7 @@ TEST_F(LoaderTests, LoadPassTest_linkFailed)
 
     // Act & Assert
     expectSpecificError([&openglContext]()
-                        { pass::OpenGLLoader<Classic>::on(openglContext); },
+                        { pass::OpenGLLoader<Classic>::on(*openglContext); },
                         artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::PROGRAM::LINK_FAILED")));
 }
 
@@ -128,7 +119,7 @@ TEST_F(LoaderTests, LoadPassTest_linkSuccess)
                                     { *params = GL_TRUE; }));
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLLoader<Classic>::on(*openglContext));
 }
 
 #endif // __mock_gl__
@@ -44,17 +44,7 @@ TEST_F(ShaderAttacherTests, AttachShaders_ValidContext)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glAttachShader_mock(1, 42)).Times(1);
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLShaderAttacher<Classic>::on(openglContext));
-}
-
-TEST_F(ShaderAttacherTests, AttachShaders_NullContext)
-{
-    // Arrange
-
-    // Act & Assert
-    expectSpecificError([]()
-                        { pass::OpenGLShaderAttacher<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>("ERROR::SHADER::NON_OPENGL_CONTEXT"));
+    ASSERT_NO_THROW(pass::OpenGLShaderAttacher<Classic>::on(*openglContext));
 }
 
 TEST_F(ShaderAttacherTests, AttachShaders_InvalidPassID)
@@ -64,7 +54,7 @@ TEST_F(ShaderAttacherTests, AttachShaders_InvalidPassID)
 
     // Act & Assert
     expectSpecificError([&openglContext]()
-                        { pass::OpenGLShaderAttacher<Classic>::on(openglContext); },
+                        { pass::OpenGLShaderAttacher<Classic>::on(*openglContext); },
                         artist::common::exception::TraceableException<std::runtime_error>("ERROR::SHADER::INVALID_PROGRAM_ID"));
 }
 
@@ -75,7 +65,7 @@ TEST_F(ShaderAttacherTests, AttachShaders_NoShaders)
     openglContext->setPassID(1); // Set a valid pipeline ID
 
     // Act & Assert
-    ASSERT_NO_THROW(pass::OpenGLShaderAttacher<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLShaderAttacher<Classic>::on(*openglContext));
 }
 
 #endif // __mock_gl__
\ No newline at end of file
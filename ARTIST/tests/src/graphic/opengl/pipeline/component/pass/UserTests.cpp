@@ -37,19 +37,9 @@ TEST_F(UserTests, UsePass_ValidContext)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUseProgram_mock(1)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(pass::OpenGLPassUser<Classic>::on(openglContext));
+    ASSERT_NO_THROW(pass::OpenGLPassUser<Classic>::on(*openglContext));
 
     // Additional validations can be performed here if necessary
 }
 
-TEST_F(UserTests, UsePass_NullContext)
-{
-    // Arrange
-
-    // Act & Assert
-    expectSpecificError([]()
-                        { pass::OpenGLPassUser<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>("ERROR::SHADER::NON_OPENGL_CONTEXT"));
-}
-
 #endif // __mock_gl__
\ No newline at end of file
@@ -0,0 +1,273 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/Api.hpp>
+#include <graphic/opengl/context/PassContext.hpp>
+#include <graphic/opengl/profile/Pass.hpp>
+#include <graphic/opengl/profile/Attribute.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Setter.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Binder.hpp>
+#include <graphic/opengl/pipeline/component/attribute/Unbinder.hpp>
+#include <graphic/opengl/pipeline/component/pass/VertexArrayBinder.hpp>
+#include <graphic/opengl/buffer/BufferNames.hpp>
+
+namespace api = artist::graphic::api;
+namespace mock = artist::mock;
+namespace context = artist::graphic::opengl::context;
+namespace pass = artist::graphic::opengl::pipeline::component::pass;
+using artist::graphic::opengl::profile::Pass::Classic;
+using OpenGLAttribute = artist::graphic::pipeline::Attribute<api::OpenGL, artist::graphic::opengl::profile::Attribute::Classic>;
+
+class PassVertexArrayBinderTests : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    static std::shared_ptr<context::OpenGLAttributeContext> addAttribute(const std::shared_ptr<context::OpenGLPassContext> &openglContext, const std::string &name, GLuint location, GLuint bufferId)
+    {
+        auto attributeContext = std::make_shared<context::OpenGLAttributeContext>();
+        attributeContext->setAttributeID(location);
+        attributeContext->setAttributeName(name);
+        attributeContext->setBufferID(bufferId);
+        attributeContext->setGLSize(3);
+        attributeContext->setGLType(GL_FLOAT);
+        attributeContext->setStride(3 * sizeof(float));
+        openglContext->addAttribute(name, std::make_shared<OpenGLAttribute>(attributeContext));
+        return attributeContext;
+    }
+};
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_CreateOnFirstUse)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    addAttribute(openglContext, "position", 0, 7);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ARRAY_BUFFER, 7)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ARRAY_BUFFER, 0)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEnableVertexAttribArray_mock(0)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(5)).Times(2);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+    ASSERT_EQ(openglContext->getCurrentVertexArray(), 5);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_ReuseCachedVertexArray)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    addAttribute(openglContext, "position", 0, 7);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5));
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+    ::testing::Mock::VerifyAndClearExpectations(mock::opengl::glFunctionMock::instance().get());
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(5)).Times(1);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_NewBufferCreateNewVertexArray)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    auto attributeContext = addAttribute(openglContext, "position", 0, 7);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5))
+        .WillOnce(::testing::SetArgPointee<1>(6));
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Act
+    attributeContext->setBufferID(8);
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 2);
+    ASSERT_EQ(openglContext->getCurrentVertexArray(), 6);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_CaptureIndexBuffer)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    addAttribute(openglContext, "position", 0, 7);
+    auto indexBuffer = std::make_shared<artist::graphic::opengl::buffer::IndexBuffer>();
+    indexBuffer->setAllocation(std::make_shared<artist::graphic::opengl::buffer::BufferAllocation>(artist::graphic::opengl::buffer::BufferAllocation{11, 0, 64}));
+    openglContext->setIndexBuffer(indexBuffer);
+
+    // Expected call
+    ::testing::InSequence sequence;
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(5)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ARRAY_BUFFER, 7)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ARRAY_BUFFER, 0)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ELEMENT_ARRAY_BUFFER, 11)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(5)).Times(1);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().begin()->first.elementBufferId, 11);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_NoBufferedAttribute)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    addAttribute(openglContext, "position", 0, 0);
+    openglContext->setCurrentVertexArray(3);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEnableVertexAttribArray_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(5)).Times(2);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+    ASSERT_EQ(openglContext->getCurrentVertexArray(), 5);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_CaptureIndexBufferWithoutBufferedAttribute)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    auto indexBuffer = std::make_shared<artist::graphic::opengl::buffer::IndexBuffer>();
+    indexBuffer->setAllocation(std::make_shared<artist::graphic::opengl::buffer::BufferAllocation>(artist::graphic::opengl::buffer::BufferAllocation{11, 0, 64}));
+    openglContext->setIndexBuffer(indexBuffer);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5));
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ARRAY_BUFFER, 0)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindBuffer_mock(GL_ELEMENT_ARRAY_BUFFER, 11)).Times(1);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+    ASSERT_EQ(openglContext->getCurrentVertexArray(), 5);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_EvictVertexArrayOfReleasedBuffer)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    addAttribute(openglContext, "position", 0, 7);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillOnce(::testing::SetArgPointee<1>(5))
+        .WillOnce(::testing::SetArgPointee<1>(6));
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+    artist::graphic::opengl::buffer::BufferNames::release(7);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteVertexArrays_mock(1, ::testing::Pointee(5))).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock).Times(1);
+
+    // Act: a new buffer got the name of the released one
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+    ASSERT_EQ(openglContext->getCurrentVertexArray(), 6);
+    ASSERT_EQ(openglContext->getBufferEpoch(), artist::graphic::opengl::buffer::BufferNames::getEpoch());
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_EmptyCacheWhenFull)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    auto attributeContext = addAttribute(openglContext, "position", 0, 7);
+    ON_CALL(*mock::opengl::glFunctionMock::instance(), glGenVertexArrays_mock(1, ::testing::_))
+        .WillByDefault([vertexArray = GLuint{100}](GLsizei, GLuint *vertexArrays) mutable
+                       { *vertexArrays = vertexArray++; });
+    for (std::size_t i = 0; i < pass::OpenGLPassVertexArrayBinder<Classic>::MAX_VERTEX_ARRAYS; ++i)
+    {
+        attributeContext->setBufferOffset(static_cast<GLintptr>(i * 64));
+        pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+    }
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glDeleteVertexArrays_mock(static_cast<GLsizei>(pass::OpenGLPassVertexArrayBinder<Classic>::MAX_VERTEX_ARRAYS), ::testing::_)).Times(1);
+
+    // Act
+    attributeContext->setBufferOffset(static_cast<GLintptr>(pass::OpenGLPassVertexArrayBinder<Classic>::MAX_VERTEX_ARRAYS * 64));
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_SkipAttributeWithoutVertexFormat)
+{
+    // Arrange: as read from the program, bound but never set
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    auto attributeContext = addAttribute(openglContext, "position", 0, 7);
+    attributeContext->setGLSize(1);
+    attributeContext->setGLType(GL_FLOAT_VEC3);
+    attributeContext->setStride(0);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glEnableVertexAttribArray_mock).Times(0);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock).Times(0);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+
+    // Assert
+    ASSERT_EQ(openglContext->getVertexArrays().size(), 1);
+    ASSERT_TRUE(openglContext->getVertexArrays().begin()->first.bindings.empty());
+}
+
+TEST_F(PassVertexArrayBinderTests, BindVertexArray_SpecifyPointerMatchingFetch)
+{
+    // Arrange
+    auto openglContext = std::make_shared<context::OpenGLPassContext>();
+    auto boneContext = addAttribute(openglContext, "bones", 0, 7);
+    boneContext->setGLSize(4);
+    boneContext->setGLType(GL_UNSIGNED_INT);
+    boneContext->setStride(4 * sizeof(GLuint));
+    boneContext->setVertexFetch(artist::graphic::opengl::layout::VertexFetch::Integer);
+    auto positionContext = addAttribute(openglContext, "position", 1, 8);
+    positionContext->setGLType(GL_DOUBLE);
+    positionContext->setStride(3 * sizeof(double));
+    positionContext->setVertexFetch(artist::graphic::opengl::layout::VertexFetch::Double);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribIPointer_mock(0, 4, GL_UNSIGNED_INT, 4 * sizeof(GLuint), nullptr)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribLPointer_mock(1, 3, GL_DOUBLE, 3 * sizeof(double), nullptr)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glVertexAttribPointer_mock).Times(0);
+
+    // Act
+    pass::OpenGLPassVertexArrayBinder<Classic>::on(*openglContext);
+}
+
+#endif
@@ -22,18 +22,8 @@ TEST_F(ResetterTests, resetProgram_ValidContext)
     context->setCurrentPass(42);
 
     // Act
-    OpenGLPipelineResetter<Classic>::on(context);
+    OpenGLPipelineResetter<Classic>::on(*context);
 
     // Assert
     ASSERT_EQ(context->getCurrentPass(), -1);
 }
-
-TEST_F(ResetterTests, resetProgram_NullContext)
-{
-    // Arrange
-
-    // Act & Assert
-    expectSpecificError([]()
-                        { OpenGLPipelineResetter<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::NON_VALID_CONTEXT")));
-}
@@ -34,14 +34,5 @@ TEST_F(UserTests, useProgram_ValidContext)
     EXPECT_CALL(*pass, use()).Times(1);
 
     // Act
-    OpenGLPipelineUser<Classic>::on(context);
-}
-
-TEST_F(UserTests, useProgram_NullContext)
-{
-    // Arrange
-    // Act & Assert
-    expectSpecificError([]()
-                        { OpenGLPipelineUser<Classic>::on(nullptr); },
-                        artist::common::exception::TraceableException<std::runtime_error>(std::format("ERROR::SHADER::NON_VALID_CONTEXT")));
+    OpenGLPipelineUser<Classic>::on(*context);
 }
\ No newline at end of file
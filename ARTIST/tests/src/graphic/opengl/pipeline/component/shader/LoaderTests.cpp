@@ -36,7 +36,7 @@ TEST_F(LoaderTests, LoadShaderTest_callCreate)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCreateShader_mock(GL_VERTEX_SHADER)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(shaderContext));
+    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(*shaderContext));
 
     // Assert
 }
@@ -51,7 +51,7 @@ TEST_F(LoaderTests, LoadShaderTest_callShaderSource)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glShaderSource_mock(1, 1, ::testing::_, ::testing::_)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(shaderContext));
+    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(*shaderContext));
 
     // Assert
 }
@@ -66,7 +66,7 @@ TEST_F(LoaderTests, LoadShaderTest_callCompile)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glCompileShader_mock(1)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(shaderContext));
+    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(*shaderContext));
 
     // Assert
 }
@@ -81,7 +81,7 @@ TEST_F(LoaderTests, LoadShaderTest_callGetIv)
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glGetShaderiv_mock(1, ::testing::_, ::testing::_)).Times(1);
 
     // Act
-    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(shaderContext));
+    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(*shaderContext));
 
     // Assert
 }
@@ -95,7 +95,7 @@ TEST_F(LoaderTests, LoadShaderTest_setContextShaderId)
     // Except calls
 
     // Act
-    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(shaderContext));
+    ASSERT_NO_THROW(shader::OpenGLShaderLoader<Classic>::on(*shaderContext));
 
     // Assert
     ASSERT_EQ(shaderContext->getShaderID(), 1);
@@ -118,7 +118,7 @@ TEST_F(LoaderTests, LoadShaderFailureTest)
 
     // Act & Assert
     expectSpecificError([&shaderContext]()
-                        { shader::OpenGLShaderLoader<Classic>::on(shaderContext); },
+                        { shader::OpenGLShaderLoader<Classic>::on(*shaderContext); },
                         artist::common::exception::TraceableException<std::runtime_error>("ERROR::SHADER::COMPILATION_FAILED"));
 }
 
@@ -0,0 +1,170 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/registry/ResourceRegistry.hpp>
+#include <graphic/pipeline/MockAttribute.hpp>
+#include <graphic/pipeline/MockShader.hpp>
+#include <TestUtils.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::graphic::api;
+namespace context = artist::graphic::opengl::context;
+namespace pipeline = artist::graphic::pipeline;
+namespace registry = artist::graphic::opengl::registry;
+using MockShader = artist::mock::graphic::pipeline::MockShader<api::OpenGL>;
+using MockAttribute = artist::mock::graphic::pipeline::MockAttribute<api::OpenGL>;
+using artist::test::utils::expectSpecificError;
+
+class ResourceRegistryTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_shaderContext->setShaderID(5);
+        m_shader = std::make_shared<MockShader>();
+        ON_CALL(*m_shader, getContext()).WillByDefault(::testing::ReturnRef(m_shaderContext));
+        m_attribute = std::make_shared<MockAttribute>();
+        m_attribute->getContext()->setAttributeID(2);
+        m_attribute->getContext()->setBufferID(7);
+
+        m_pass->setPassID(3);
+        m_pass->setCurrentVertexArray(9);
+        m_pass->addShader(m_shader);
+        m_pass->addAttribute("position", m_attribute);
+        auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+        uniform->getContext()->setUniformID(13);
+        m_pass->addUniform("model", uniform);
+    }
+
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+
+    std::shared_ptr<context::OpenGLShaderContext> m_shaderContext = std::make_shared<context::OpenGLShaderContext>();
+    std::shared_ptr<MockShader> m_shader;
+    std::shared_ptr<MockAttribute> m_attribute;
+    std::shared_ptr<context::OpenGLPassContext> m_pass = std::make_shared<context::OpenGLPassContext>();
+    registry::ResourceRegistry m_registry;
+};
+
+TEST_F(ResourceRegistryTests, ImportPass)
+{
+    // Act
+    registry::PassHandle pass = m_registry.importPass(m_pass);
+
+    // Assert
+    ASSERT_TRUE(m_registry.isValid(pass));
+    ASSERT_EQ(m_registry.getPasses().get<0>(pass), 3);
+    ASSERT_EQ(m_registry.getShaders().column<0>()[0], 5);
+    ASSERT_EQ(m_registry.getAttributes().column<0>()[0], 2);
+    ASSERT_EQ(m_registry.getAttributes().column<1>()[0], "position");
+    ASSERT_EQ(m_registry.findUniform(pass, "model"), 13);
+    ASSERT_EQ(m_registry.findUniform(pass, "view"), -1);
+}
+
+TEST_F(ResourceRegistryTests, UsePassOfPipeline)
+{
+    // Arrange
+    registry::PassHandle passes[] = {m_registry.importPass(m_pass)};
+    registry::PipelineHandle pipeline = m_registry.createPipeline(passes);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUseProgram_mock(3)).Times(1);
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(9)).Times(1);
+
+    // Act
+    m_registry.use(pipeline, 0);
+
+    // Assert
+    ASSERT_EQ(m_registry.getPipelines().get<1>(pipeline), 0);
+    ASSERT_THROW(m_registry.use(pipeline, 1), std::out_of_range);
+}
+
+TEST_F(ResourceRegistryTests, UseVertexArrayCurrentWhenUsed)
+{
+    // Arrange
+    registry::PassHandle passes[] = {m_registry.importPass(m_pass)};
+    registry::PipelineHandle pipeline = m_registry.createPipeline(passes);
+    m_pass->setCurrentVertexArray(11);
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock(11)).Times(1);
+
+    // Act
+    m_registry.use(pipeline, 0);
+}
+
+TEST_F(ResourceRegistryTests, ThrowOnReleasedPassContext)
+{
+    // Arrange
+    registry::PassHandle passes[] = {m_registry.importPass(m_pass)};
+    registry::PipelineHandle pipeline = m_registry.createPipeline(passes);
+    m_pass.reset();
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glBindVertexArray_mock).Times(0);
+
+    // Act & Assert
+    expectSpecificError([this, pipeline]()
+                        { m_registry.use(pipeline, 0); },
+                        std::out_of_range("ERROR::RESOURCE_REGISTRY::STALE_PASS"));
+}
+
+TEST_F(ResourceRegistryTests, FindUniformAmongUniformsOfThePass)
+{
+    // Arrange
+    for (const char *name : {"view", "projection", "albedo"})
+    {
+        auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+        uniform->getContext()->setUniformID(static_cast<GLuint>(std::string_view(name).size()));
+        m_pass->addUniform(name, uniform);
+    }
+    registry::PassHandle other = m_registry.importPass(m_pass);
+    registry::PassHandle pass = m_registry.importPass(std::make_shared<context::OpenGLPassContext>());
+
+    // Act & Assert
+    ASSERT_EQ(m_registry.findUniform(other, "albedo"), 6);
+    ASSERT_EQ(m_registry.findUniform(other, "model"), 13);
+    ASSERT_EQ(m_registry.findUniform(other, "projection"), 10);
+    ASSERT_EQ(m_registry.findUniform(other, "view"), 4);
+    ASSERT_EQ(m_registry.findUniform(other, "normal"), -1);
+    ASSERT_EQ(m_registry.findUniform(pass, "model"), -1);
+}
+
+TEST_F(ResourceRegistryTests, DestroyPassWithItsResources)
+{
+    // Arrange
+    registry::PassHandle other = m_registry.importPass(m_pass);
+    registry::PassHandle pass = m_registry.importPass(m_pass);
+
+    // Act
+    bool destroyed = m_registry.destroyPass(pass);
+
+    // Assert
+    ASSERT_TRUE(destroyed);
+    ASSERT_FALSE(m_registry.isValid(pass));
+    ASSERT_EQ(m_registry.getShaders().size(), 1);
+    ASSERT_EQ(m_registry.getUniforms().size(), 1);
+    ASSERT_EQ(m_registry.getAttributes().size(), 1);
+    ASSERT_EQ(m_registry.getUniforms().column<2>()[0], other);
+}
+
+TEST_F(ResourceRegistryTests, ThrowOnStalePass)
+{
+    // Arrange
+    registry::PassHandle passes[] = {m_registry.importPass(m_pass)};
+    registry::PipelineHandle pipeline = m_registry.createPipeline(passes);
+    m_registry.destroyPass(passes[0]);
+
+    // Act & Assert
+    ASSERT_THROW(m_registry.use(pipeline, 0), std::out_of_range);
+    ASSERT_THROW(m_registry.createPipeline(passes), std::out_of_range);
+    ASSERT_THROW((void)m_registry.findUniform(passes[0], "model"), std::out_of_range);
+}
+
+#endif // __mock_gl__
@@ -0,0 +1,154 @@
+#ifdef __mock_gl__
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/pipeline/MockPass.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+#include <graphic/opengl/profile/Pipeline.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/User.hpp>
+#include <graphic/opengl/pipeline/component/pipeline/Resetter.hpp>
+#include <graphic/opengl/context/PipelineContext.hpp>
+#include <graphic/opengl/thread/RenderThread.hpp>
+
+namespace mock = artist::mock;
+namespace api = artist::graphic::api;
+namespace pipeline = artist::graphic::pipeline;
+using artist::graphic::opengl::profile::Pipeline::Classic;
+using artist::graphic::opengl::thread::RenderThread;
+using artist::mock::graphic::pipeline::opengl::MockPass;
+
+class RenderThreadTests : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+    }
+};
+
+TEST_F(RenderThreadTests, RunCommandsInOrderOnRenderThread)
+{
+    // Arrange
+    std::vector<int> order;
+    std::thread::id current;
+    std::thread::id executor;
+
+    // Act
+    {
+        RenderThread renderThread([&current]()
+                                  { current = std::this_thread::get_id(); });
+        for (int i = 0; i < 100; ++i)
+        {
+            renderThread.submit([&order, i]()
+                                { order.push_back(i); });
+        }
+        renderThread.submit([&executor]()
+                            { executor = std::this_thread::get_id(); });
+        renderThread.flush().get();
+    }
+
+    // Assert
+    ASSERT_EQ(order.size(), 100);
+    ASSERT_TRUE(std::ranges::is_sorted(order));
+    ASSERT_EQ(executor, current);
+    ASSERT_NE(executor, std::this_thread::get_id());
+}
+
+TEST_F(RenderThreadTests, DeliverResultsThroughFutures)
+{
+    // Arrange
+    RenderThread renderThread;
+
+    // Act
+    auto isRenderThread = renderThread.call([&renderThread]()
+                                            { return renderThread.isRenderThread(); });
+    auto failure = renderThread.call([]() -> int
+                                     { throw std::runtime_error("lost context"); });
+
+    // Assert
+    ASSERT_TRUE(isRenderThread.get());
+    ASSERT_FALSE(renderThread.isRenderThread());
+    ASSERT_THROW(failure.get(), std::runtime_error);
+}
+
+TEST_F(RenderThreadTests, RethrowErrorOfSubmittedCommand)
+{
+    // Arrange
+    RenderThread renderThread;
+
+    // Act
+    renderThread.submit([]()
+                        { throw std::runtime_error("lost context"); });
+    renderThread.flush().get();
+
+    // Assert
+    ASSERT_THROW(renderThread.rethrowError(), std::runtime_error);
+    ASSERT_NO_THROW(renderThread.rethrowError());
+}
+
+TEST_F(RenderThreadTests, WaitForFreeSlotsWhenQueueIsFull)
+{
+    // Arrange
+    int count = 0;
+
+    // Act
+    {
+        RenderThread renderThread({}, 2);
+        for (int i = 0; i < 1000; ++i)
+        {
+            renderThread.submit([&count]()
+                                { ++count; });
+        }
+    }
+
+    // Assert
+    ASSERT_EQ(count, 1000);
+}
+
+TEST_F(RenderThreadTests, SetUniformOnRenderThread)
+{
+    // Arrange
+    auto pass = std::make_shared<MockPass<api::OpenGL>>();
+    auto uniform = std::make_shared<pipeline::Uniform<api::OpenGL>>();
+    uniform->getContext()->setUniformID(4);
+    pass->getContext()->addUniform("scale", uniform);
+    std::thread::id caller;
+
+    // Expected call
+    EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniform1f_mock(4, 2.0f))
+        .WillOnce([&caller](GLint, GLfloat)
+                  { caller = std::this_thread::get_id(); });
+
+    // Act
+    RenderThread renderThread;
+    renderThread.withUniform<api::OpenGL>(pass, "scale", 2.0f);
+    renderThread.flush().get();
+
+    // Assert
+    ASSERT_EQ(caller, renderThread.getId());
+}
+
+TEST_F(RenderThreadTests, UsePipelineOnRenderThread)
+{
+    // Arrange
+    auto pass = std::make_shared<MockPass<api::OpenGL>>();
+    auto pipeline = std::make_shared<pipeline::Pipeline<api::OpenGL, Classic>>(std::initializer_list<std::shared_ptr<pipeline::IPass<api::OpenGL>>>{pass});
+
+    // Expected call
+    EXPECT_CALL(*pass, use()).Times(1);
+
+    // Act
+    RenderThread renderThread;
+    renderThread.use<api::OpenGL>(pipeline, 0);
+    renderThread.flush().get();
+
+    // Assert
+    ASSERT_EQ(pipeline->getContext()->getCurrentPass(), 0);
+}
+
+#endif // __mock_gl__
@@ -1,5 +1,6 @@
 #include <any>
 #include <iostream>
+#include <vector>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <graphic/opengl/profile/Attribute.hpp>
@@ -23,6 +24,8 @@ class AttributeTest : public ::testing::Test
 public:
     void TearDown() override
     {
+        mock::MockSetter<int>::reset();
+        mock::MockSetter<float>::reset();
     }
 };
 
@@ -68,6 +71,60 @@ TEST_F(AttributeTest, SetTest)
     ASSERT_NO_THROW(attribute.set(std::make_shared<int>(1)));
 }
 
+TEST_F(AttributeTest, SetValuesTest)
+{
+    // Arrange
+    auto attributeContext = std::make_shared<api::MockOpenGL::AttributeContext>();
+    std::vector<float> values{1.0f, 2.0f, 3.0f};
+
+    pipeline::Attribute<api::MockOpenGL, Classic> attribute(attributeContext);
+
+    // Expect calls
+    EXPECT_CALL(*mock::MockSetter<float>::instance(), mockOn(::testing::_)).Times(1);
+
+    // Act
+    ASSERT_NO_THROW(attribute.set<float>(values));
+
+    // Assert
+    ASSERT_EQ(attributeContext->getData().size(), values.size() * sizeof(float));
+    ASSERT_EQ(attributeContext->getData().data(), reinterpret_cast<const std::byte *>(values.data()));
+}
+
+TEST_F(AttributeTest, UpdateTest)
+{
+    // Arrange
+    auto attributeContext = std::make_shared<api::MockOpenGL::AttributeContext>();
+    std::vector<float> values(100, 0.0f);
+
+    pipeline::Attribute<api::MockOpenGL, Classic> attribute(attributeContext);
+    attribute.set<float>(values);
+    attributeContext->clearDirtyRanges();
+
+    // Expect calls
+    EXPECT_CALL(*mock::MockSetter<float>::instance(), mockOn(::testing::_)).Times(1);
+
+    // Act
+    values[10] = 1.0f;
+    ASSERT_NO_THROW(attribute.update<float>(values, 10, 1));
+
+    // Assert
+    ASSERT_EQ(attributeContext->getDirtyRanges().getRanges().size(), 1);
+    ASSERT_EQ(attributeContext->getDirtyRanges().getRanges()[0].offset, 10 * sizeof(float));
+    ASSERT_EQ(attributeContext->getDirtyRanges().getRanges()[0].size, sizeof(float));
+}
+
+TEST_F(AttributeTest, UpdateTest_OutOfRange)
+{
+    // Arrange
+    auto attributeContext = std::make_shared<api::MockOpenGL::AttributeContext>();
+    std::vector<float> values(4, 0.0f);
+
+    pipeline::Attribute<api::MockOpenGL, Classic> attribute(attributeContext);
+
+    // Act & Assert
+    EXPECT_THROW(attribute.update<float>(values, 3, 2), std::out_of_range);
+}
+
 TEST_F(AttributeTest, GetContextTest)
 {
     // Arrange
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <graphic/pipeline/DrawKey.hpp>
+#include <TestUtils.hpp>
+
+using artist::graphic::pipeline::DrawKeyField;
+using artist::graphic::pipeline::DrawKeyLayout;
+using artist::test::utils::expectSpecificError;
+
+TEST(DrawKeyTests, Opaque_ProgramBeforeMaterialBeforeDepth)
+{
+    // Arrange
+    const DrawKeyLayout layout = DrawKeyLayout::opaque();
+
+    // Act
+    const std::uint64_t nearProgram1 = layout.encode({.program = 1, .material = 0, .depth = 0.1f});
+    const std::uint64_t farProgram0 = layout.encode({.program = 0, .material = 9, .depth = 0.9f});
+    const std::uint64_t nearMaterial0 = layout.encode({.program = 1, .material = 0, .depth = 0.05f});
+
+    // Assert
+    ASSERT_LT(farProgram0, nearProgram1);
+    ASSERT_LT(nearMaterial0, nearProgram1);
+}
+
+TEST(DrawKeyTests, Transparent_FarthestFirst)
+{
+    // Arrange
+    const DrawKeyLayout layout = DrawKeyLayout::transparent();
+
+    // Act
+    const std::uint64_t nearDraw = layout.encode({.program = 0, .depth = 0.2f});
+    const std::uint64_t farDraw = layout.encode({.program = 5, .depth = 0.8f});
+
+    // Assert
+    ASSERT_LT(farDraw, nearDraw);
+}
+
+TEST(DrawKeyTests, DecodeFields)
+{
+    // Arrange
+    const DrawKeyLayout layout({{DrawKeyField::Pass, 2}, {DrawKeyField::Material, 8}, {DrawKeyField::Depth, 4}});
+
+    // Act
+    const std::uint64_t key = layout.encode({.pass = 3, .program = 7, .material = 0x1FF, .depth = 1.0f});
+
+    // Assert
+    ASSERT_EQ(layout.decode(key, DrawKeyField::Pass), 3);
+    ASSERT_EQ(layout.decode(key, DrawKeyField::Material), 0xFF);
+    ASSERT_EQ(layout.decode(key, DrawKeyField::Depth), 0xF);
+    ASSERT_EQ(layout.decode(key, DrawKeyField::Program), 0);
+    ASSERT_EQ(key << 14, 0); // Fields fill the key from its most significant bit
+}
+
+TEST(DrawKeyTests, ThrowOnLayoutOver64Bits)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { DrawKeyLayout({{DrawKeyField::Material, 40}, {DrawKeyField::Depth, 32}}); },
+                        std::invalid_argument("ERROR::DRAW_KEY::INVALID_LAYOUT"));
+}
+
+TEST(DrawKeyTests, ThrowOnRepeatedField)
+{
+    // Act & Assert
+    expectSpecificError([]()
+                        { DrawKeyLayout({{DrawKeyField::Program, 8}, {DrawKeyField::Program, 8}}); },
+                        std::invalid_argument("ERROR::DRAW_KEY::INVALID_LAYOUT"));
+}
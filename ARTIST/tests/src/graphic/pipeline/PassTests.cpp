@@ -13,6 +13,7 @@
 #include <graphic/opengl/pipeline/component/pass/MockUniformReader.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockAttributeReader.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockUser.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockVertexArrayBinder.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockFreer.hpp>
 #include <graphic/opengl/pipeline/component/pass/MockLoader.hpp>
 #include <graphic/pipeline/MockShader.hpp>
@@ -33,6 +34,7 @@ using mock::graphic::opengl::pipeline::component::pass::MockLoader;
 using mock::graphic::opengl::pipeline::component::pass::MockShaderAttacher;
 using mock::graphic::opengl::pipeline::component::pass::MockUniformReader;
 using mock::graphic::opengl::pipeline::component::pass::MockUser;
+using mock::graphic::opengl::pipeline::component::pass::MockVertexArrayBinder;
 using mock::graphic::pipeline::MockAttribute;
 using mock::graphic::pipeline::MockShader;
 using mock::graphic::pipeline::MockUniform;
@@ -50,6 +52,7 @@ public:
         MockShaderAttacher<Classic>::reset();
         MockUniformReader<Classic>::reset();
         MockUser<Classic>::reset();
+        MockVertexArrayBinder<Classic>::reset();
         MockAttributeReader<Classic>::reset();
     }
 };
@@ -76,8 +79,8 @@ TEST_F(PassTest, WithUniforms)
     pipeline::Pass<api::MockOpenGL, Classic> pass({mockShader});
 
     // Expect calls
-    EXPECT_CALL(*api::MockOpenGL::PassContext::UniformReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](std::shared_ptr<context::PassContext<api::MockOpenGL>> context)
-                                                                                                                                    { context->addUniform("test", mockUniform); }));
+    EXPECT_CALL(*api::MockOpenGL::PassContext::UniformReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](context::PassContext<api::MockOpenGL> &context)
+                                                                                                                                    { context.addUniform("test", mockUniform); }));
     EXPECT_CALL(*mock::opengl::glFunctionMock::instance(), glUniform1f_mock(::testing::_, ::testing::_)).Times(1);
 
     pass.load();
@@ -106,7 +109,9 @@ TEST_F(PassTest, UsePass)
     pipeline::Pass<api::MockOpenGL, Classic> pass({});
 
     // Expect calls
+    ::testing::InSequence sequence;
     EXPECT_CALL(*api::MockOpenGL::PassContext::User<Classic>::instance(), mockOn(::testing::_)).Times(1);
+    EXPECT_CALL(*api::MockOpenGL::PassContext::VertexArrayBinder<Classic>::instance(), mockOn(::testing::_)).Times(1);
 
     // Act
     ASSERT_NO_THROW(pass.use());
@@ -132,8 +137,8 @@ TEST_F(PassTest, GetUniforms)
     pipeline::Pass<api::MockOpenGL, Classic> pass({mockShader});
 
     // Expect calls
-    EXPECT_CALL(*api::MockOpenGL::PassContext::UniformReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](std::shared_ptr<context::PassContext<api::MockOpenGL>> context)
-                                                                                                                                    { context->addUniform("test", mockUniform); }));
+    EXPECT_CALL(*api::MockOpenGL::PassContext::UniformReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](context::PassContext<api::MockOpenGL> &context)
+                                                                                                                                    { context.addUniform("test", mockUniform); }));
 
     pass.load();
     // Act
@@ -149,8 +154,8 @@ TEST_F(PassTest, GetAttributes)
     pipeline::Pass<api::MockOpenGL, Classic> pass({mockShader});
 
     // Expect calls
-    EXPECT_CALL(*api::MockOpenGL::PassContext::AttributeReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](std::shared_ptr<context::PassContext<api::MockOpenGL>> context)
-                                                                                                                                      { context->addAttribute("test", mockAttribute); }));
+    EXPECT_CALL(*api::MockOpenGL::PassContext::AttributeReader<Classic>::instance(), mockOn(::testing::_)).WillOnce(::testing::Invoke([&](context::PassContext<api::MockOpenGL> &context)
+                                                                                                                                      { context.addAttribute("test", mockAttribute); }));
 
     pass.load();
     // Act
@@ -0,0 +1,163 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <graphic/pipeline/RenderGraph.hpp>
+#include <TestUtils.hpp>
+
+namespace pipeline = artist::graphic::pipeline;
+using artist::test::utils::expectSpecificError;
+
+class RenderGraphTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_backbuffer = m_graph.importResource("backbuffer");
+        m_scene = m_graph.createResource("scene");
+        m_bloom = m_graph.createResource("bloom");
+        m_graph.addPass("geometry", [this](pipeline::RenderGraphBuilder &builder)
+                        {
+                            ++m_setups;
+                            builder.write(m_scene); },
+                        [this]
+                        { m_executed.push_back("geometry"); });
+        m_graph.addPass("bloom", [this](pipeline::RenderGraphBuilder &builder)
+                        {
+                            builder.read(m_scene);
+                            builder.write(m_bloom); },
+                        [this]
+                        { m_executed.push_back("bloom"); });
+        m_graph.addPass("composite", [this](pipeline::RenderGraphBuilder &builder)
+                        {
+                            builder.read(m_scene);
+                            if (m_bloomEnabled)
+                            {
+                                builder.read(m_bloom);
+                            }
+                            builder.write(m_backbuffer); },
+                        [this]
+                        { m_executed.push_back("composite"); });
+    }
+
+    pipeline::RenderGraph m_graph;
+    pipeline::RenderGraphResource m_backbuffer = 0;
+    pipeline::RenderGraphResource m_scene = 0;
+    pipeline::RenderGraphResource m_bloom = 0;
+    bool m_bloomEnabled = false;
+    int m_setups = 0;
+    std::vector<std::string> m_executed;
+};
+
+TEST_F(RenderGraphTest, CullPassesWithUnusedOutputs)
+{
+    // Act
+    m_graph.execute();
+
+    // Assert
+    ASSERT_EQ(m_graph.getExecutionOrder(), (std::vector<std::size_t>{0, 2}));
+    ASSERT_EQ(m_executed, (std::vector<std::string>{"geometry", "composite"}));
+    ASSERT_FALSE(m_graph.getLifetime(m_bloom).isUsed());
+}
+
+TEST_F(RenderGraphTest, KeepOptionalPassOnceConsumed)
+{
+    // Arrange
+    m_graph.execute();
+    m_bloomEnabled = true;
+    m_graph.invalidate();
+    m_executed.clear();
+
+    // Act
+    m_graph.execute();
+
+    // Assert
+    ASSERT_EQ(m_executed, (std::vector<std::string>{"geometry", "bloom", "composite"}));
+    const auto &barriers = m_graph.getBarriers();
+    ASSERT_EQ(barriers.size(), 3);
+    ASSERT_EQ(barriers[0].resource, m_scene);
+    ASSERT_EQ(barriers[0].writer, 0);
+    ASSERT_EQ(barriers[0].reader, 1);
+    ASSERT_EQ(barriers[2].resource, m_bloom);
+    ASSERT_EQ(barriers[2].writer, 1);
+    ASSERT_EQ(barriers[2].reader, 2);
+}
+
+TEST_F(RenderGraphTest, CompileOnce)
+{
+    // Act
+    m_graph.execute();
+    m_graph.execute();
+    m_graph.execute();
+
+    // Assert
+    ASSERT_EQ(m_setups, 1);
+    ASSERT_EQ(m_executed.size(), 6);
+    ASSERT_TRUE(m_graph.isCompiled());
+}
+
+TEST_F(RenderGraphTest, RealizeAndReleaseTransientResources)
+{
+    // Arrange
+    m_bloomEnabled = true;
+    std::vector<std::string> events;
+    m_graph.setLifetimeHandlers([&events, this](pipeline::RenderGraphResource resource)
+                                { events.push_back("realize " + m_graph.getResourceName(resource)); },
+                                [&events, this](pipeline::RenderGraphResource resource)
+                                { events.push_back("release " + m_graph.getResourceName(resource)); });
+    m_graph.setBarrierHandler([&events, this](const pipeline::RenderGraphBarrier &barrier)
+                              { events.push_back("barrier " + m_graph.getResourceName(barrier.resource)); });
+
+    // Act
+    m_graph.execute();
+
+    // Assert
+    ASSERT_EQ(events, (std::vector<std::string>{"realize scene", "realize bloom", "barrier scene", "barrier scene", "barrier bloom", "release scene", "release bloom"}));
+    ASSERT_EQ(m_graph.getLifetime(m_scene).first, 0);
+    ASSERT_EQ(m_graph.getLifetime(m_scene).last, 2);
+    ASSERT_EQ(m_graph.getLifetime(m_bloom).first, 1);
+}
+
+TEST_F(RenderGraphTest, KeepPassWithSideEffect)
+{
+    // Arrange
+    m_graph.addPass("readback", [this](pipeline::RenderGraphBuilder &builder)
+                    {
+                        builder.read(m_bloom);
+                        builder.sideEffect(); },
+                    [this]
+                    { m_executed.push_back("readback"); });
+
+    // Act
+    m_graph.execute();
+
+    // Assert
+    ASSERT_EQ(m_executed, (std::vector<std::string>{"geometry", "bloom", "composite", "readback"}));
+}
+
+TEST_F(RenderGraphTest, ThrowOnReadBeforeWrite)
+{
+    // Arrange
+    auto history = m_graph.createResource("history");
+    m_graph.addPass("taa", [history](pipeline::RenderGraphBuilder &builder)
+                    { builder.read(history); },
+                    [] {});
+
+    // Act & Assert
+    expectSpecificError([this]()
+                        { m_graph.compile(); },
+                        std::runtime_error("ERROR::RENDER_GRAPH::READ_BEFORE_WRITE"));
+}
+
+TEST_F(RenderGraphTest, ThrowOnUnknownResource)
+{
+    // Arrange
+    m_graph.addPass("broken", [](pipeline::RenderGraphBuilder &builder)
+                    { builder.write(42); },
+                    [] {});
+
+    // Act & Assert
+    expectSpecificError([this]()
+                        { m_graph.compile(); },
+                        std::out_of_range("ERROR::RENDER_GRAPH::UNKNOWN_RESOURCE"));
+}
@@ -0,0 +1,118 @@
+#ifdef __mock_gl__
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <opengl/glFunctionMock.hpp>
+#include <graphic/pipeline/StaticPipeline.hpp>
+
+#include <graphic/opengl/profile/Pass.hpp>
+#include <graphic/opengl/validator/Validator.hpp>
+
+#include <graphic/opengl/pipeline/component/pass/MockShaderAttacher.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockUniformReader.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockAttributeReader.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockUser.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockVertexArrayBinder.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockFreer.hpp>
+#include <graphic/opengl/pipeline/component/pass/MockLoader.hpp>
+#include <graphic/pipeline/MockShader.hpp>
+#include <graphic/opengl/context/MockPassContext.hpp>
+#include <graphic/MockApi.hpp>
+
+namespace api = artist::mock::graphic::api;
+namespace pipeline = artist::graphic::pipeline;
+namespace mock = artist::mock;
+
+using mock::graphic::opengl::pipeline::component::pass::MockAttributeReader;
+using mock::graphic::opengl::pipeline::component::pass::MockFreer;
+using mock::graphic::opengl::pipeline::component::pass::MockLoader;
+using mock::graphic::opengl::pipeline::component::pass::MockShaderAttacher;
+using mock::graphic::opengl::pipeline::component::pass::MockUniformReader;
+using mock::graphic::opengl::pipeline::component::pass::MockUser;
+using mock::graphic::opengl::pipeline::component::pass::MockVertexArrayBinder;
+using mock::graphic::pipeline::MockShader;
+
+using artist::graphic::opengl::profile::Pass::Classic;
+
+using MockClassicPass = pipeline::Pass<api::MockOpenGL, Classic>;
+
+static_assert(pipeline::detail::StaticPassOf<api::MockOpenGL, MockClassicPass>);
+static_assert(!pipeline::detail::StaticPassOf<api::MockOpenGL, int>);
+
+class StaticPipelineTest : public ::testing::Test
+{
+public:
+    void TearDown() override
+    {
+        mock::opengl::glFunctionMock::reset();
+        MockFreer<Classic>::reset();
+        MockLoader<Classic>::reset();
+        MockShaderAttacher<Classic>::reset();
+        MockUniformReader<Classic>::reset();
+        MockUser<Classic>::reset();
+        MockVertexArrayBinder<Classic>::reset();
+        MockAttributeReader<Classic>::reset();
+    }
+
+protected:
+    static std::shared_ptr<MockClassicPass> makePass()
+    {
+        std::shared_ptr<pipeline::IShader<api::MockOpenGL>> shader = std::make_shared<MockShader<api::MockOpenGL>>();
+        return std::make_shared<MockClassicPass>(std::initializer_list{shader});
+    }
+
+    std::shared_ptr<MockClassicPass> m_first = makePass();
+    std::shared_ptr<MockClassicPass> m_second = makePass();
+};
+
+TEST_F(StaticPipelineTest, UsePass)
+{
+    // Arrange
+    pipeline::StaticPipeline<api::MockOpenGL, MockClassicPass, MockClassicPass> pipeline(m_first, m_second);
+
+    // Expect calls
+    EXPECT_CALL(*MockUser<Classic>::instance(), mockOn(::testing::Ref(*m_second->getContext()))).Times(1);
+    EXPECT_CALL(*MockVertexArrayBinder<Classic>::instance(), mockOn(::testing::Ref(*m_second->getContext()))).Times(1);
+
+    // Act
+    pipeline.use<1>();
+}
+
+TEST_F(StaticPipelineTest, RunPassesInOrder)
+{
+    // Arrange
+    pipeline::StaticPipeline<api::MockOpenGL, MockClassicPass, MockClassicPass> pipeline(m_first, m_second);
+    std::vector<std::size_t> drawn;
+    ::testing::InSequence sequence;
+
+    // Expect calls
+    EXPECT_CALL(*MockUser<Classic>::instance(), mockOn(::testing::Ref(*m_first->getContext()))).Times(1);
+    EXPECT_CALL(*MockUser<Classic>::instance(), mockOn(::testing::Ref(*m_second->getContext()))).Times(1);
+
+    // Act
+    pipeline.run([&drawn, this](auto index, MockClassicPass &pass)
+                 {
+                     drawn.push_back(index);
+                     ASSERT_EQ(&pass, index == 0 ? m_first.get() : m_second.get()); });
+
+    // Assert
+    ASSERT_EQ(drawn, (std::vector<std::size_t>{0, 1}));
+    ASSERT_EQ(pipeline.getPassesCount(), 2);
+    ASSERT_EQ(pipeline.forPass<1>(), m_second);
+}
+
+TEST_F(StaticPipelineTest, LoadEveryPass)
+{
+    // Arrange
+    pipeline::StaticPipeline<api::MockOpenGL, MockClassicPass, MockClassicPass> pipeline(m_first, m_second);
+
+    // Expect calls
+    EXPECT_CALL(*MockLoader<Classic>::instance(), mockOn(::testing::_)).Times(2);
+
+    // Act
+    pipeline.load();
+}
+
+#endif